@@ -11,7 +11,7 @@
 #include "UsdMaterialHandler.h"
 
 #include "UsdMaterial.h"
-#include "UsdMaterialValidator.h"
+#include "UsdMaterialValidationService.h"
 #include "UsdMxVersionUpgrade.h"
 
 #include <usdUfe/ufe/UsdUndoAddNewPrimCommand.h>
@@ -103,7 +103,9 @@ LookdevXUfe::ValidationLog::Ptr UsdMaterialHandler::validateMaterial(const Ufe::
         return nullptr;
     }
 
-    return UsdMaterialValidator(materialPrim).validate();
+    // Go through the validation service of the stage so that unchanged materials are not validated again every time the
+    // UI asks for their status.
+    return UsdMaterialValidationService::instance(prim.GetStage())->validate(materialPrim);
 }
 
 bool UsdMaterialHandler::isBackdropImpl(const Ufe::SceneItem::Ptr& item) const
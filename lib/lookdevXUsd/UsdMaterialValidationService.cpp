@@ -0,0 +1,444 @@
+//*****************************************************************************
+// Copyright (c) 2025 Autodesk, Inc.
+// All rights reserved.
+//
+// These coded instructions, statements, and computer programs contain
+// unpublished proprietary information written by Autodesk, Inc. and are
+// protected by Federal copyright law. They may not be disclosed to third
+// parties or copied or duplicated in any form, in whole or in part, without
+// the prior written consent of Autodesk, Inc.
+//*****************************************************************************
+#include "UsdMaterialValidationService.h"
+#include "UsdMaterialValidator.h"
+
+#include <usdUfe/ufe/Utils.h>
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/vt/dictionary.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/primRange.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace
+{
+
+void hashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// Hash what the validator looks at on a single prim: its type, schemas, custom data and the values, metadata and
+// connections of its authored attributes. Connection sources that are outside of the network are returned so their
+// content can be hashed too.
+void hashPrim(const UsdPrim& prim, const SdfPath& networkPath, size_t& hash, SdfPathVector& externalSources)
+{
+    hashCombine(hash, TfHash{}(prim.GetPath()));
+    hashCombine(hash, TfHash{}(prim.GetTypeName()));
+    for (auto&& schema : prim.GetAppliedSchemas())
+    {
+        hashCombine(hash, TfHash{}(schema));
+    }
+    hashCombine(hash, VtValue(prim.GetCustomData()).GetHash());
+
+    SdfPathVector sources;
+    for (auto&& attr : prim.GetAuthoredAttributes())
+    {
+        hashCombine(hash, TfHash{}(attr.GetName()));
+        hashCombine(hash, TfHash{}(attr.GetTypeName().GetAsToken()));
+        for (auto&& metadata : attr.GetAllAuthoredMetadata())
+        {
+            hashCombine(hash, TfHash{}(metadata.first));
+            hashCombine(hash, metadata.second.GetHash());
+        }
+
+        VtValue value;
+        if (attr.Get(&value))
+        {
+            hashCombine(hash, value.GetHash());
+        }
+
+        sources.clear();
+        attr.GetConnections(&sources);
+        for (auto&& source : sources)
+        {
+            hashCombine(hash, TfHash{}(source));
+            if (!source.HasPrefix(networkPath))
+            {
+                externalSources.push_back(source.GetPrimPath());
+            }
+        }
+    }
+}
+
+// Hash the content of the shading network of a material, including the prims outside of the material it is connected
+// to and the types of the ancestors of the material, which are part of the validation rules.
+size_t networkHash(const UsdShadeMaterial& material, SdfPathVector& dependencies)
+{
+    const auto materialPrim = material.GetPrim();
+    const auto& materialPath = materialPrim.GetPath();
+
+    size_t hash = 0;
+    for (auto parent = materialPrim.GetParent(); parent; parent = parent.GetParent())
+    {
+        hashCombine(hash, TfHash{}(parent.GetTypeName()));
+    }
+
+    SdfPathVector externalSources;
+    for (auto&& prim : UsdPrimRange(materialPrim))
+    {
+        hashPrim(prim, materialPath, hash, externalSources);
+    }
+
+    // Follow the connections leaving the material until no new prim is found.
+    std::unordered_set<SdfPath, SdfPath::Hash> visited;
+    while (!externalSources.empty())
+    {
+        auto sourcePath = externalSources.back();
+        externalSources.pop_back();
+        if (!visited.insert(sourcePath).second)
+        {
+            continue;
+        }
+
+        dependencies.push_back(sourcePath);
+        auto sourcePrim = materialPrim.GetStage()->GetPrimAtPath(sourcePath);
+        if (sourcePrim)
+        {
+            hashPrim(sourcePrim, materialPath, hash, externalSources);
+        }
+        else
+        {
+            hashCombine(hash, TfHash{}(sourcePath));
+        }
+    }
+    std::sort(dependencies.begin(), dependencies.end());
+
+    return hash;
+}
+
+} // namespace
+
+namespace LookdevXUsd
+{
+
+UsdMaterialValidationService::Ptr UsdMaterialValidationService::instance(const UsdStageWeakPtr& stage)
+{
+    static std::mutex servicesMutex;
+    static std::unordered_map<UsdStageWeakPtr, Ptr, TfHash> services;
+
+    if (!stage)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(servicesMutex);
+
+    // Drop the services of the stages that went away.
+    for (auto it = services.begin(); it != services.end();)
+    {
+        it = it->first ? std::next(it) : services.erase(it);
+    }
+
+    auto& service = services[stage];
+    if (!service)
+    {
+        service = std::make_shared<UsdMaterialValidationService>(stage);
+    }
+    return service;
+}
+
+UsdMaterialValidationService::UsdMaterialValidationService(const UsdStageWeakPtr& stage) : m_stage(stage)
+{
+    m_objectsChangedKey =
+        TfNotice::Register(TfCreateWeakPtr(this), &UsdMaterialValidationService::stageChanged, m_stage);
+}
+
+UsdMaterialValidationService::~UsdMaterialValidationService()
+{
+    TfNotice::Revoke(m_objectsChangedKey);
+}
+
+LookdevXUfe::ValidationLog::Ptr UsdMaterialValidationService::validate(const UsdShadeMaterial& material)
+{
+    if (!material || !TF_VERIFY(material.GetPrim().GetStage() == m_stage))
+    {
+        return nullptr;
+    }
+
+    auto results = validate(SdfPathVector{material.GetPath()});
+    return results.empty() ? nullptr : results.front().second;
+}
+
+UsdMaterialValidationService::Results UsdMaterialValidationService::validate(const SdfPathVector& materialPaths)
+{
+    struct PendingMaterial
+    {
+        UsdShadeMaterial material;
+        size_t resultIndex = 0;
+        size_t hash = 0;
+        SdfPathVector dependencies;
+        LookdevXUfe::ValidationLog::Ptr log;
+    };
+
+    Results results;
+    if (!m_stage)
+    {
+        return results;
+    }
+
+    results.reserve(materialPaths.size());
+    std::vector<PendingMaterial> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto&& path : materialPaths)
+        {
+            UsdShadeMaterial material(m_stage->GetPrimAtPath(path));
+            if (!material)
+            {
+                removeEntry(path);
+                continue;
+            }
+
+            auto it = m_cache.find(path);
+            if (it != m_cache.end() && !it->second.dirty)
+            {
+                results.emplace_back(path, it->second.log);
+                ++m_cacheHitCount;
+                continue;
+            }
+
+            results.emplace_back(path, nullptr);
+            pending.push_back({material, results.size() - 1});
+        }
+    }
+
+    if (pending.empty())
+    {
+        return results;
+    }
+
+    // Hashing a network is much cheaper than validating it and a lot of changes, like a resync of the root when a
+    // sublayer is added, do not actually modify the networks they dirty. Hashing only reads the stage, so the networks
+    // are hashed in parallel.
+    WorkParallelForN(pending.size(), [&pending](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            pending[i].hash = networkHash(pending[i].material, pending[i].dependencies);
+        }
+    });
+
+    std::vector<PendingMaterial*> toValidate;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto&& material : pending)
+        {
+            auto it = m_cache.find(material.material.GetPath());
+            if (it != m_cache.end() && it->second.log && it->second.hash == material.hash)
+            {
+                it->second.dirty = false;
+                results[material.resultIndex].second = it->second.log;
+                ++m_cacheHitCount;
+                continue;
+            }
+            toValidate.push_back(&material);
+        }
+    }
+
+    if (toValidate.empty())
+    {
+        return results;
+    }
+
+    // Resolving the UFE path of the stage requires access to the DCC scene, so do it once here instead of letting
+    // each validator do it from a worker thread. The validation itself only reads the stage and the Sdr registry,
+    // which is safe to query concurrently.
+    const Ufe::Path stagePath = UsdUfe::stagePath(m_stage);
+    WorkParallelForN(toValidate.size(), [&toValidate, &stagePath](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            toValidate[i]->log = UsdMaterialValidator(toValidate[i]->material, stagePath).validate();
+        }
+    });
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto* material : toValidate)
+    {
+        const auto& path = material->material.GetPath();
+        auto& entry = m_cache[path];
+        entry.hash = material->hash;
+        entry.dirty = false;
+        entry.log = material->log;
+        setDependencies(path, entry, std::move(material->dependencies));
+        results[material->resultIndex].second = material->log;
+        ++m_validationCount;
+    }
+
+    return results;
+}
+
+UsdMaterialValidationService::Results UsdMaterialValidationService::validateAll()
+{
+    if (!m_stage)
+    {
+        return {};
+    }
+
+    SdfPathVector materialPaths;
+    std::unordered_set<SdfPath, SdfPath::Hash> materials;
+    auto range = UsdPrimRange(m_stage->GetPseudoRoot());
+    for (auto it = range.begin(); it != range.end(); ++it)
+    {
+        if (it->IsA<UsdShadeMaterial>())
+        {
+            materialPaths.push_back(it->GetPath());
+            materials.insert(it->GetPath());
+            // Nothing below a material can be another material network to validate.
+            it.PruneChildren();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        SdfPathVector removedMaterials;
+        for (auto&& entry : m_cache)
+        {
+            if (!materials.count(entry.first))
+            {
+                removedMaterials.push_back(entry.first);
+            }
+        }
+        for (auto&& path : removedMaterials)
+        {
+            removeEntry(path);
+        }
+    }
+
+    return validate(materialPaths);
+}
+
+void UsdMaterialValidationService::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache.clear();
+    m_dependents.clear();
+}
+
+size_t UsdMaterialValidationService::cacheSize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cache.size();
+}
+
+size_t UsdMaterialValidationService::validationCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_validationCount;
+}
+
+size_t UsdMaterialValidationService::cacheHitCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cacheHitCount;
+}
+
+void UsdMaterialValidationService::stageChanged(const UsdNotice::ObjectsChanged& notice,
+                                                const UsdStageWeakPtr& /*sender*/)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_cache.empty())
+    {
+        return;
+    }
+
+    for (auto&& path : notice.GetResyncedPaths())
+    {
+        markDirty(path);
+    }
+    for (auto&& path : notice.GetChangedInfoOnlyPaths())
+    {
+        markDirty(path);
+    }
+}
+
+void UsdMaterialValidationService::markDirty(const SdfPath& changedPath)
+{
+    const auto primPath = changedPath.GetPrimPath();
+
+    // Materials at or below the changed prim.
+    for (auto it = m_cache.lower_bound(primPath); it != m_cache.end() && it->first.HasPrefix(primPath); ++it)
+    {
+        it->second.dirty = true;
+    }
+
+    // Material containing the changed prim.
+    for (auto path = primPath.GetParentPath(); !path.IsEmpty() && !path.IsAbsoluteRootPath();
+         path = path.GetParentPath())
+    {
+        auto it = m_cache.find(path);
+        if (it != m_cache.end())
+        {
+            it->second.dirty = true;
+            break;
+        }
+    }
+
+    // Materials connected to the changed prim from outside of their network.
+    for (auto it = m_dependents.lower_bound(primPath); it != m_dependents.end() && it->first.HasPrefix(primPath);
+         ++it)
+    {
+        for (auto&& materialPath : it->second)
+        {
+            auto entry = m_cache.find(materialPath);
+            if (entry != m_cache.end())
+            {
+                entry->second.dirty = true;
+            }
+        }
+    }
+}
+
+void UsdMaterialValidationService::removeEntry(const SdfPath& materialPath)
+{
+    auto it = m_cache.find(materialPath);
+    if (it == m_cache.end())
+    {
+        return;
+    }
+
+    setDependencies(materialPath, it->second, {});
+    m_cache.erase(it);
+}
+
+void UsdMaterialValidationService::setDependencies(const SdfPath& materialPath,
+                                                   CacheEntry& entry,
+                                                   SdfPathVector&& dependencies)
+{
+    for (auto&& dependency : entry.dependencies)
+    {
+        auto it = m_dependents.find(dependency);
+        if (it != m_dependents.end())
+        {
+            it->second.erase(materialPath);
+            if (it->second.empty())
+            {
+                m_dependents.erase(it);
+            }
+        }
+    }
+
+    entry.dependencies = std::move(dependencies);
+    for (auto&& dependency : entry.dependencies)
+    {
+        m_dependents[dependency].insert(materialPath);
+    }
+}
+
+} // namespace LookdevXUsd
@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright (c) 2025 Autodesk, Inc.
+// All rights reserved.
+//
+// These coded instructions, statements, and computer programs contain
+// unpublished proprietary information written by Autodesk, Inc. and are
+// protected by Federal copyright law. They may not be disclosed to third
+// parties or copied or duplicated in any form, in whole or in part, without
+// the prior written consent of Autodesk, Inc.
+//*****************************************************************************
+#pragma once
+
+#include "Export.h"
+
+#include <LookdevXUfe/ValidationLog.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdShade/material.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace LookdevXUsd
+{
+
+//! \brief Scene-level material validation service.
+/*!
+    Validates the materials of a stage in parallel and caches the validation log of each material along with a hash
+    of the content of its shading network. Stage changes only mark the networks they touch as dirty. A dirty network
+    is hashed again when next requested and only gets validated again if its content really changed.
+ */
+class UsdMaterialValidationService : public PXR_NS::TfWeakBase
+{
+public:
+    using Ptr = std::shared_ptr<UsdMaterialValidationService>;
+    using Results = std::vector<std::pair<PXR_NS::SdfPath, LookdevXUfe::ValidationLog::Ptr>>;
+
+    //! Get the validation service of a stage, creating it on first use.
+    LOOKDEVX_USD_EXPORT static Ptr instance(const PXR_NS::UsdStageWeakPtr& stage);
+
+    LOOKDEVX_USD_EXPORT explicit UsdMaterialValidationService(const PXR_NS::UsdStageWeakPtr& stage);
+    LOOKDEVX_USD_EXPORT ~UsdMaterialValidationService();
+
+    //@{
+    //! Delete the copy/move constructors assignment operators.
+    UsdMaterialValidationService(const UsdMaterialValidationService&) = delete;
+    UsdMaterialValidationService& operator=(const UsdMaterialValidationService&) = delete;
+    UsdMaterialValidationService(UsdMaterialValidationService&&) = delete;
+    UsdMaterialValidationService& operator=(UsdMaterialValidationService&&) = delete;
+    //@}
+
+    //! Validate a single material, reusing the cached log when its network did not change.
+    LOOKDEVX_USD_EXPORT LookdevXUfe::ValidationLog::Ptr validate(const PXR_NS::UsdShadeMaterial& material);
+
+    //! Validate the given materials in parallel. Paths that are not materials of the stage are skipped.
+    LOOKDEVX_USD_EXPORT Results validate(const PXR_NS::SdfPathVector& materialPaths);
+
+    //! Validate all the materials of the stage in parallel.
+    LOOKDEVX_USD_EXPORT Results validateAll();
+
+    //! Forget all cached results. Needed when something outside of the stage affecting validation, like the shader
+    //! registry, changes.
+    LOOKDEVX_USD_EXPORT void clear();
+
+    //@{
+    //! Statistics, mostly for testing and profiling.
+    [[nodiscard]] LOOKDEVX_USD_EXPORT size_t cacheSize() const;
+    [[nodiscard]] LOOKDEVX_USD_EXPORT size_t validationCount() const;
+    [[nodiscard]] LOOKDEVX_USD_EXPORT size_t cacheHitCount() const;
+    //@}
+
+private:
+    struct CacheEntry
+    {
+        size_t hash = 0;
+        bool dirty = false;
+        LookdevXUfe::ValidationLog::Ptr log;
+        // Prims outside of the material network that are connected to it.
+        PXR_NS::SdfPathVector dependencies;
+    };
+
+    void stageChanged(const PXR_NS::UsdNotice::ObjectsChanged& notice, const PXR_NS::UsdStageWeakPtr& sender);
+    void markDirty(const PXR_NS::SdfPath& changedPath);
+    void removeEntry(const PXR_NS::SdfPath& materialPath);
+    void setDependencies(const PXR_NS::SdfPath& materialPath, CacheEntry& entry, PXR_NS::SdfPathVector&& dependencies);
+
+    PXR_NS::UsdStageWeakPtr m_stage;
+    PXR_NS::TfNotice::Key m_objectsChangedKey;
+
+    mutable std::mutex m_mutex;
+    // Ordered so that all the cached materials below a resynced path form a single range.
+    std::map<PXR_NS::SdfPath, CacheEntry> m_cache;
+    // Materials depending on each external prim, ordered for the same reason.
+    std::map<PXR_NS::SdfPath, PXR_NS::SdfPathSet> m_dependents;
+
+    size_t m_validationCount = 0;
+    size_t m_cacheHitCount = 0;
+};
+
+} // namespace LookdevXUsd
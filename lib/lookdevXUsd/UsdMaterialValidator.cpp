@@ -24,6 +24,7 @@
 
 #include <map>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -472,13 +473,13 @@ void UsdMaterialValidator::validateComponentLocation(const LookdevXUfe::Attribut
     }
 }
 
-Ufe::Path UsdMaterialValidator::toUfe(const UsdStageWeakPtr& stage, const SdfPath& path)
+Ufe::Path UsdMaterialValidator::toUfe(const UsdStageWeakPtr& stage, const SdfPath& path) const
 {
-    auto stagePath = UsdUfe::stagePath(stage);
+    auto stagePath = (stage == m_material.GetPrim().GetStage()) ? m_stagePath : UsdUfe::stagePath(stage);
     return Ufe::Path::Segments{stagePath.getSegments()[0], UsdUfe::usdPathToUfePathSegment(path)};
 }
 
-Ufe::Path UsdMaterialValidator::toUfe(const UsdPrim& prim)
+Ufe::Path UsdMaterialValidator::toUfe(const UsdPrim& prim) const
 {
     return {toUfe(prim.GetStage(), prim.GetPath())};
 }
@@ -504,7 +505,13 @@ LookdevXUfe::Log::ConnectionInfo UsdMaterialValidator::toUfe(const UsdConnection
     return {toUfe(cnx.m_src), toUfe(cnx.m_dst)};
 }
 
-UsdMaterialValidator::UsdMaterialValidator(const UsdShadeMaterial& prim) : m_material(prim)
+UsdMaterialValidator::UsdMaterialValidator(const UsdShadeMaterial& prim)
+    : m_material(prim), m_stagePath(UsdUfe::stagePath(prim.GetPrim().GetStage()))
+{
+}
+
+UsdMaterialValidator::UsdMaterialValidator(const UsdShadeMaterial& prim, Ufe::Path stagePath)
+    : m_material(prim), m_stagePath(std::move(stagePath))
 {
 }
 
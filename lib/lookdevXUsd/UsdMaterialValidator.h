@@ -38,6 +38,9 @@ class UsdMaterialValidator
 {
 public:
     LOOKDEVX_USD_EXPORT explicit UsdMaterialValidator(const PXR_NS::UsdShadeMaterial& prim);
+    //! Use an already resolved UFE path for the stage of the material. Resolving the stage path requires access to the
+    //! DCC scene, so this is the constructor to use when validating from a worker thread.
+    LOOKDEVX_USD_EXPORT UsdMaterialValidator(const PXR_NS::UsdShadeMaterial& prim, Ufe::Path stagePath);
 
     LOOKDEVX_USD_EXPORT LookdevXUfe::ValidationLog::Ptr validate();
 
@@ -61,8 +64,8 @@ private:
         const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrName) const;
     LOOKDEVX_USD_EXPORT void validateComponentLocation(const LookdevXUfe::AttributeComponentInfo& attrInfo,
                                                        const std::string& errorDesc) const;
-    LOOKDEVX_USD_EXPORT static Ufe::Path toUfe(const PXR_NS::UsdStageWeakPtr& stage, const PXR_NS::SdfPath& path);
-    LOOKDEVX_USD_EXPORT static Ufe::Path toUfe(const PXR_NS::UsdPrim& prim);
+    LOOKDEVX_USD_EXPORT Ufe::Path toUfe(const PXR_NS::UsdStageWeakPtr& stage, const PXR_NS::SdfPath& path) const;
+    LOOKDEVX_USD_EXPORT Ufe::Path toUfe(const PXR_NS::UsdPrim& prim) const;
     LOOKDEVX_USD_EXPORT LookdevXUfe::AttributeComponentInfo toUfe(const PXR_NS::UsdAttribute& attrib) const;
     LOOKDEVX_USD_EXPORT LookdevXUfe::AttributeComponentInfo toUfe(const PXR_NS::UsdPrim& prim,
                                                                   const PXR_NS::TfToken& attrName) const;
@@ -71,6 +74,9 @@ private:
     const PXR_NS::UsdShadeMaterial& m_material;
     LookdevXUfe::ValidationLog::Ptr m_log;
 
+    // UFE path of the stage of the material, resolved once instead of for every reported item.
+    Ufe::Path m_stagePath;
+
     // Keep a stack of the current connection chain we are following. We can detect a cycle by taking the source
     // UsdShadeShader prim of the connection we are currently evaluating and traverse up the stack looking at the
     // UsdShadeShader prim of the destinations. If we have a match, then we have a cycle from the current connection up
@@ -182,6 +182,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kExportBlendShapesFlag,
         UsdMayaJobExportArgsTokens->exportBlendShapes.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kSparseBlendShapeTargetsFlag,
+        UsdMayaJobExportArgsTokens->sparseBlendShapeTargets.GetText(),
+        MSyntax::kBoolean);
     syntax.addFlag(
         kParentScopeFlag,
         UsdMayaJobExportArgsTokens->parentScope.GetText(),
@@ -248,6 +252,18 @@ MSyntax MayaUSDExportCommand::createSyntax()
         MSyntax::kBoolean);
     syntax.addFlag(
         kGeomSidednessFlag, UsdMayaJobExportArgsTokens->geomSidedness.GetText(), MSyntax::kString);
+    syntax.addFlag(
+        kCompactTimeSamplesFlag,
+        UsdMayaJobExportArgsTokens->compactTimeSamples.GetText(),
+        MSyntax::kString);
+    syntax.addFlag(
+        kCompactTimeSamplesToleranceFlag,
+        UsdMayaJobExportArgsTokens->compactTimeSamplesTolerance.GetText(),
+        MSyntax::kDouble);
+    syntax.addFlag(
+        kCollapseConstantTimeSamplesFlag,
+        UsdMayaJobExportArgsTokens->collapseConstantTimeSamples.GetText(),
+        MSyntax::kBoolean);
 
     syntax.addFlag(
         kCustomLayerData,
@@ -78,6 +78,7 @@ public:
     static constexpr auto kExportSkelsFlag = "skl";
     static constexpr auto kExportSkinFlag = "skn";
     static constexpr auto kExportBlendShapesFlag = "ebs";
+    static constexpr auto kSparseBlendShapeTargetsFlag = "sbt";
     static constexpr auto kParentScopeFlag = "psc"; // deprecated
     static constexpr auto kRootPrimFlag = "rpm";
     static constexpr auto kRootPrimTypeFlag = "rpt";
@@ -98,6 +99,9 @@ public:
     static constexpr auto kVerboseFlag = "v";
     static constexpr auto kStaticSingleSample = "sss";
     static constexpr auto kGeomSidednessFlag = "gs";
+    static constexpr auto kCompactTimeSamplesFlag = "cts";
+    static constexpr auto kCompactTimeSamplesToleranceFlag = "ctt";
+    static constexpr auto kCollapseConstantTimeSamplesFlag = "cct";
     static constexpr auto kApiSchemaFlag = "api";
     static constexpr auto kJobContextFlag = "jc";
     static constexpr auto kWorldspaceFlag = "wsp";
@@ -747,6 +747,8 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
           UsdMayaJobExportArgsTokens->none,
           { UsdMayaJobExportArgsTokens->auto_, UsdMayaJobExportArgsTokens->explicit_ }))
     , exportBlendShapes(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportBlendShapes))
+    , sparseBlendShapeTargets(
+          extractBoolean(userArgs, UsdMayaJobExportArgsTokens->sparseBlendShapeTargets))
     , exportVisibility(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportVisibility))
     , exportComponentTags(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportComponentTags))
     , exportStagesAsRefs(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->exportStagesAsRefs))
@@ -835,6 +837,15 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
           UsdMayaJobExportArgsTokens->geomSidedness,
           UsdMayaJobExportArgsTokens->derived,
           { UsdMayaJobExportArgsTokens->single, UsdMayaJobExportArgsTokens->double_ }))
+    , compactTimeSamples(extractToken(
+          userArgs,
+          UsdMayaJobExportArgsTokens->compactTimeSamples,
+          UsdMayaJobExportArgsTokens->none,
+          { UsdMayaJobExportArgsTokens->redundant, UsdMayaJobExportArgsTokens->linear }))
+    , compactTimeSamplesTolerance(
+          extractDouble(userArgs, UsdMayaJobExportArgsTokens->compactTimeSamplesTolerance, 0.0))
+    , collapseConstantTimeSamples(
+          extractBoolean(userArgs, UsdMayaJobExportArgsTokens->collapseConstantTimeSamples))
     , includeAPINames(extractTokenSet(userArgs, UsdMayaJobExportArgsTokens->apiSchema))
     , jobContextNames(extractTokenSet(userArgs, UsdMayaJobExportArgsTokens->jobContext))
     , excludeExportTypes(extractTokenSet(userArgs, UsdMayaJobExportArgsTokens->excludeExportTypes))
@@ -898,6 +909,8 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "exportSkels: " << TfStringify(exportArgs.exportSkels) << std::endl
         << "exportSkin: " << TfStringify(exportArgs.exportSkin) << std::endl
         << "exportBlendShapes: " << TfStringify(exportArgs.exportBlendShapes) << std::endl
+        << "sparseBlendShapeTargets: " << TfStringify(exportArgs.sparseBlendShapeTargets)
+        << std::endl
         << "exportVisibility: " << TfStringify(exportArgs.exportVisibility) << std::endl
         << "exportComponentTags: " << TfStringify(exportArgs.exportComponentTags) << std::endl
         << "exportStagesAsRefs: " << TfStringify(exportArgs.exportStagesAsRefs) << std::endl
@@ -942,6 +955,10 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "timeSamples: " << exportArgs.timeSamples.size() << " sample(s)" << std::endl
         << "staticSingleSample: " << TfStringify(exportArgs.staticSingleSample) << std::endl
         << "geomSidedness: " << TfStringify(exportArgs.geomSidedness) << std::endl
+        << "compactTimeSamples: " << TfStringify(exportArgs.compactTimeSamples) << std::endl
+        << "compactTimeSamplesTolerance: " << exportArgs.compactTimeSamplesTolerance << std::endl
+        << "collapseConstantTimeSamples: " << TfStringify(exportArgs.collapseConstantTimeSamples)
+        << std::endl
         << "usdModelRootOverridePath: " << exportArgs.usdModelRootOverridePath << std::endl;
 
     out << "melPerFrameCallback: " << exportArgs.melPerFrameCallback << std::endl
@@ -1190,6 +1207,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->exportSkin] = UsdMayaJobExportArgsTokens->none.GetString();
         d[UsdMayaJobExportArgsTokens->exportSkels] = UsdMayaJobExportArgsTokens->none.GetString();
         d[UsdMayaJobExportArgsTokens->exportBlendShapes] = false;
+        d[UsdMayaJobExportArgsTokens->sparseBlendShapeTargets] = false;
         d[UsdMayaJobExportArgsTokens->exportUVs] = true;
         d[UsdMayaJobExportArgsTokens->exportRelativeTextures]
             = UsdMayaJobExportArgsTokens->automatic.GetString();
@@ -1237,6 +1255,10 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = false;
         d[UsdMayaJobExportArgsTokens->geomSidedness]
             = UsdMayaJobExportArgsTokens->derived.GetString();
+        d[UsdMayaJobExportArgsTokens->compactTimeSamples]
+            = UsdMayaJobExportArgsTokens->none.GetString();
+        d[UsdMayaJobExportArgsTokens->compactTimeSamplesTolerance] = 0.0;
+        d[UsdMayaJobExportArgsTokens->collapseConstantTimeSamples] = false;
         d[UsdMayaJobExportArgsTokens->customLayerData] = std::vector<VtValue>();
         d[UsdMayaJobExportArgsTokens->metersPerUnit] = 0.0;
         d[UsdMayaJobExportArgsTokens->excludeExportTypes] = std::vector<VtValue>();
@@ -1305,6 +1327,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->exportSelected] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportSkels] = _string;
         d[UsdMayaJobExportArgsTokens->exportBlendShapes] = _boolean;
+        d[UsdMayaJobExportArgsTokens->sparseBlendShapeTargets] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportUVs] = _boolean;
         d[UsdMayaJobExportArgsTokens->exportRelativeTextures] = _string;
         d[UsdMayaJobExportArgsTokens->exportVisibility] = _boolean;
@@ -1345,6 +1368,9 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->verbose] = _boolean;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = _boolean;
         d[UsdMayaJobExportArgsTokens->geomSidedness] = _string;
+        d[UsdMayaJobExportArgsTokens->compactTimeSamples] = _string;
+        d[UsdMayaJobExportArgsTokens->compactTimeSamplesTolerance] = _double;
+        d[UsdMayaJobExportArgsTokens->collapseConstantTimeSamples] = _boolean;
         d[UsdMayaJobExportArgsTokens->excludeExportTypes] = _stringVector;
         d[UsdMayaJobExportArgsTokens->defaultPrim] = _string;
         d[UsdMayaJobExportArgsTokens->accessibilityLabel] = _string;
@@ -73,6 +73,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (defaultUSDFormat) \
     (eulerFilter) \
     (exportBlendShapes) \
+    (sparseBlendShapeTargets) \
     (exportCollectionBasedBindings) \
     (exportColorSets) \
     (exportMaterials) \
@@ -127,6 +128,9 @@ TF_DECLARE_PUBLIC_TOKENS(
     (verbose) \
     (staticSingleSample) \
     (geomSidedness)   \
+    (compactTimeSamples) \
+    (compactTimeSamplesTolerance) \
+    (collapseConstantTimeSamples) \
     (worldspace) \
     (writeDefaults) \
     (customLayerData) \
@@ -175,6 +179,10 @@ TF_DECLARE_PUBLIC_TOKENS(
     (derived)                             \
     (single)                              \
     ((double_, "double"))                 \
+    /* compactTimeSamples values */ \
+    /* (none) */ \
+    (redundant) \
+    (linear) \
     /* root prim type values */ \
     (scope) \
     (xform) \
@@ -266,6 +274,7 @@ struct UsdMayaJobExportArgs
     const TfToken     exportSkels;
     const TfToken     exportSkin;
     const bool        exportBlendShapes;
+    const bool        sparseBlendShapeTargets;
     const bool        exportVisibility;
     const bool        exportComponentTags;
     const bool        exportStagesAsRefs;
@@ -313,6 +322,9 @@ struct UsdMayaJobExportArgs
     const bool         verbose;
     const bool         staticSingleSample;
     const TfToken      geomSidedness;
+    const TfToken      compactTimeSamples;
+    const double       compactTimeSamplesTolerance;
+    const bool         collapseConstantTimeSamples;
     const TfToken::Set includeAPINames;
     const TfToken::Set jobContextNames;
     const TfToken::Set excludeExportTypes;
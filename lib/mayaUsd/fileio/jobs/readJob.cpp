@@ -16,6 +16,7 @@
 #include "readJob.h"
 
 #include <mayaUsd/fileio/chaser/importChaserRegistry.h>
+#include <mayaUsd/fileio/primReaderPrefetch.h>
 #include <mayaUsd/fileio/primReaderRegistry.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
 #include <mayaUsd/fileio/translators/translatorXformable.h>
@@ -965,7 +966,10 @@ bool UsdMaya_ReadJob::_DoImport(const UsdPrimRange& rootRange, const UsdPrim& us
 
 void UsdMaya_ReadJob::_ImportPrimRange(const UsdPrimRange& range, const UsdPrim& usdRootPrim)
 {
-    const int                     loopSize = std::distance(range.begin(), range.end());
+    // Walking the range to find the prims whose USD data can be read ahead of
+    // time also gives the number of steps for the progress bar.
+    UsdMayaPrimReaderPrefetch     prefetch(range, mArgs.timeInterval, mArgs.importInstances);
+    const int                     loopSize = prefetch.GetStepCount();
     MayaUsd::ProgressBarLoopScope instanceLoop(loopSize);
 
     _PrimReaderMap primReaderMap;
@@ -974,6 +978,7 @@ void UsdMaya_ReadJob::_ImportPrimRange(const UsdPrimRange& range, const UsdPrim&
         const UsdPrim&           prim = *primIt;
         UsdMayaPrimReaderContext readCtx(&mNewNodeRegistry);
         readCtx.SetTimeSampleMultiplier(mTimeSampleMultiplier);
+        readCtx.SetPrefetch(&prefetch);
 
         if (mArgs.importInstances && prim.IsInstance()) {
             _DoImportInstanceIt(primIt, usdRootPrim, readCtx, primReaderMap);
@@ -57,6 +57,7 @@
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/utils/autoUndoCommands.h>
 #include <mayaUsd/utils/progressBarScope.h>
+#include <mayaUsd/utils/timeSampleCompactor.h>
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/usd/sdf/variantSetSpec.h>
@@ -973,6 +974,25 @@ void UsdMaya_WriteJob::_FinishWriting()
 {
     MayaUsd::ProgressBarScope progressBar(2);
 
+    const TfToken& compaction = mJobCtx.mArgs.compactTimeSamples;
+    if (compaction != UsdMayaJobExportArgsTokens->none) {
+        TF_STATUS("Compacting time samples");
+        MayaUsd::TimeSampleCompactorOptions options;
+        options.tolerance = mJobCtx.mArgs.compactTimeSamplesTolerance;
+        options.linear = (compaction == UsdMayaJobExportArgsTokens->linear);
+        options.collapseConstant = mJobCtx.mArgs.collapseConstantTimeSamples;
+
+        const MayaUsd::TimeSampleCompactorStats stats
+            = MayaUsd::compactTimeSamples(mJobCtx.mStage->GetRootLayer(), options);
+        TF_STATUS(
+            "Removed %zu time samples of %zu attributes, %zu of them constant, saving about %zu "
+            "bytes",
+            stats.removedSamples,
+            stats.attributes,
+            stats.collapsedAttributes,
+            stats.bytesSaved);
+    }
+
     TF_STATUS("Saving stage");
     if (mJobCtx.mStage->GetRootLayer()->PermissionToSave()) {
         mJobCtx.mStage->GetRootLayer()->Save();
@@ -23,6 +23,7 @@ UsdMayaPrimReaderContext::UsdMayaPrimReaderContext(ObjectRegistry* pathNodeMap)
     : _prune(false)
     , _timeSampleMultiplier(1.0)
     , _pathNodeMap(pathNodeMap)
+    , _prefetch(nullptr)
 {
 }
 
@@ -95,4 +96,11 @@ void UsdMayaPrimReaderContext::SetTimeSampleMultiplier(double multiplier)
     _timeSampleMultiplier = multiplier;
 };
 
+UsdMayaPrimReaderPrefetch* UsdMayaPrimReaderContext::GetPrefetch() const { return _prefetch; }
+
+void UsdMayaPrimReaderContext::SetPrefetch(UsdMayaPrimReaderPrefetch* prefetch)
+{
+    _prefetch = prefetch;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -25,6 +25,8 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class UsdMayaPrimReaderPrefetch;
+
 /// \class UsdMayaPrimReaderContext
 /// \brief This class provides an interface for reader plugins to communicate
 /// state back to the core usd maya logic as well as retrieve information set by
@@ -94,6 +96,15 @@ public:
     MAYAUSD_CORE_PUBLIC
     void SetTimeSampleMultiplier(double multiplier);
 
+    /// \brief Returns the USD data prefetched by the read job for the prims
+    /// being imported, or nullptr if nothing was prefetched.
+    MAYAUSD_CORE_PUBLIC
+    UsdMayaPrimReaderPrefetch* GetPrefetch() const;
+
+    /// \brief Set the USD data prefetched for the prims being imported.
+    MAYAUSD_CORE_PUBLIC
+    void SetPrefetch(UsdMayaPrimReaderPrefetch* prefetch);
+
     ~UsdMayaPrimReaderContext() { }
 
 private:
@@ -104,6 +115,9 @@ private:
     // for undo/redo
     ObjectRegistry* _pathNodeMap;
 
+    // Not owned, the read job keeps it alive while the prims are read.
+    UsdMayaPrimReaderPrefetch* _prefetch;
+
     // Tracks new nodes. It is possible that a code branch will decide to work on a copy of the
     // context, so wrap the tracker in a shared pointer.
     std::shared_ptr<MayaObjectList> _trackedNewMayaNodes;
@@ -0,0 +1,155 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "primReaderPrefetch.h"
+
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdMayaPrimReaderPrefetch::UsdMayaPrimReaderPrefetch(
+    const UsdPrimRange& range,
+    const GfInterval&   frameRange,
+    bool                importInstances)
+    : _frameRange(frameRange)
+{
+    for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
+        ++_stepCount;
+        if (primIt.IsPostVisit()) {
+            continue;
+        }
+
+        // Instances are imported by duplicating their prototype, they are
+        // never read by a prim reader.
+        const UsdPrim& prim = *primIt;
+        if (importInstances && prim.IsInstance()) {
+            continue;
+        }
+
+        if (prim.IsA<UsdGeomMesh>()) {
+            _meshIndices.emplace(prim.GetPath(), _meshes.size());
+            _meshes.push_back({ UsdGeomMesh(prim) });
+        }
+    }
+}
+
+bool UsdMayaPrimReaderPrefetch::TakeMeshData(
+    const SdfPath&    path,
+    const GfInterval& frameRange,
+    MeshData*         data)
+{
+    if (!data || frameRange != _frameRange) {
+        return false;
+    }
+
+    auto found = _meshIndices.find(path);
+    if (found == _meshIndices.end()) {
+        return false;
+    }
+
+    const size_t index = found->second;
+    if (!_meshes[index].ready) {
+        // Meshes before the current batch were either taken or pruned by
+        // their readers, so the import has moved past them.
+        if (index < _batchBegin) {
+            return false;
+        }
+        _PrefetchBatch(index);
+    }
+
+    _MeshEntry& entry = _meshes[index];
+    *data = std::move(entry.data);
+    entry.data = MeshData();
+    entry.ready = false;
+    _meshIndices.erase(found);
+    return true;
+}
+
+void UsdMayaPrimReaderPrefetch::_PrefetchBatch(size_t first)
+{
+    // Release what was not taken from the previous batch, for example the
+    // meshes below a prim whose reader pruned its children.
+    for (size_t i = _batchBegin; i < _batchEnd; ++i) {
+        _meshes[i].data = MeshData();
+        _meshes[i].ready = false;
+    }
+
+    _batchBegin = first;
+    _batchEnd = std::min(first + kBatchSize, _meshes.size());
+
+    const GfInterval& frameRange = _frameRange;
+    WorkParallelForN(_batchEnd - _batchBegin, [this, &frameRange](size_t begin, size_t end) {
+        for (size_t i = _batchBegin + begin; i < _batchBegin + end; ++i) {
+            ReadMeshData(_meshes[i].mesh, frameRange, &_meshes[i].data);
+            _meshes[i].ready = true;
+        }
+    });
+}
+
+/* static */
+void UsdMayaPrimReaderPrefetch::ReadMeshData(
+    const UsdGeomMesh& mesh,
+    const GfInterval&  frameRange,
+    MeshData*          data)
+{
+    // Topologically varying meshes are not supported. The reader reports
+    // the error, so only record it here.
+    const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
+    data->varyingFaceVertexCounts = fvc.ValueMightBeTimeVarying();
+    if (!data->varyingFaceVertexCounts) {
+        fvc.Get(&data->faceVertexCounts, UsdTimeCode::EarliestTime());
+    }
+
+    const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
+    data->varyingFaceVertexIndices = fvi.ValueMightBeTimeVarying();
+    if (!data->varyingFaceVertexIndices) {
+        fvi.Get(&data->faceVertexIndices, UsdTimeCode::EarliestTime());
+    }
+
+    // If the frame range is non-empty, pick the first available sample in the
+    // frame range or default.
+    UsdTimeCode pointsTimeSample = UsdTimeCode::EarliestTime();
+    UsdTimeCode normalsTimeSample = UsdTimeCode::EarliestTime();
+    if (!frameRange.IsEmpty()) {
+        mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &data->pointsTimeSamples);
+        if (!data->pointsTimeSamples.empty()) {
+            pointsTimeSample = data->pointsTimeSamples.front();
+        }
+
+        std::vector<double> normalsTimeSamples;
+        mesh.GetNormalsAttr().GetTimeSamplesInInterval(frameRange, &normalsTimeSamples);
+        if (!normalsTimeSamples.empty()) {
+            normalsTimeSample = normalsTimeSamples.front();
+        }
+    }
+
+    mesh.GetPointsAttr().Get(&data->points, pointsTimeSample);
+
+    /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
+    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
+    if (primvar.HasValue()) {
+        primvar.ComputeFlattened(&data->normals, normalsTimeSample);
+        data->normalsInterpolation = primvar.GetInterpolation();
+    } else {
+        mesh.GetNormalsAttr().Get(&data->normals, normalsTimeSample);
+        data->normalsInterpolation = mesh.GetNormalsInterpolation();
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,110 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_PRIMREADERPREFETCH_H
+#define PXRUSDMAYA_PRIMREADERPREFETCH_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/interval.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdMayaPrimReaderPrefetch
+/// \brief Reads the USD data needed by prim readers for a range of prims ahead
+/// of time, in parallel.
+///
+/// Prim readers run one after the other on the main thread since they create
+/// Maya nodes, so resolving the values of large attributes (mesh topology,
+/// points and normals) is serialized with the node creation. The read job
+/// builds a prefetch for the range it imports: the constructor walks the range
+/// once, which also gives the number of steps of the import for its progress
+/// bar, and the data is then read in parallel, one batch of prims at a time,
+/// when a reader first asks for it. Only one batch is held at once, which
+/// bounds the memory used by staged data on large imports.
+class UsdMayaPrimReaderPrefetch
+{
+public:
+    /// USD-side data of a mesh, as read by TranslatorMeshRead.
+    struct MeshData
+    {
+        VtIntArray          faceVertexCounts;
+        VtIntArray          faceVertexIndices;
+        VtVec3fArray        points;
+        VtVec3fArray        normals;
+        TfToken             normalsInterpolation;
+        std::vector<double> pointsTimeSamples;
+        bool                varyingFaceVertexCounts = false;
+        bool                varyingFaceVertexIndices = false;
+    };
+
+    /// Number of meshes read in parallel at once.
+    static constexpr size_t kBatchSize = 256;
+
+    MAYAUSD_CORE_PUBLIC
+    UsdMayaPrimReaderPrefetch(
+        const UsdPrimRange& range,
+        const GfInterval&   frameRange,
+        bool                importInstances);
+
+    /// \brief Returns the number of iterations over the range, counting both
+    /// pre and post visits, without taking pruning into account.
+    size_t GetStepCount() const { return _stepCount; }
+
+    /// \brief Moves the prefetched data of the mesh at \p path into \p data.
+    ///
+    /// Returns false if the mesh is not part of the prefetched range, was read
+    /// for a different frame range or was already taken. The caller should then
+    /// read the data itself with ReadMeshData().
+    MAYAUSD_CORE_PUBLIC
+    bool TakeMeshData(const SdfPath& path, const GfInterval& frameRange, MeshData* data);
+
+    /// \brief Reads the data of \p mesh needed to import it over \p frameRange.
+    ///
+    /// Only reads the stage, so it is safe to call from worker threads.
+    MAYAUSD_CORE_PUBLIC
+    static void ReadMeshData(const UsdGeomMesh& mesh, const GfInterval& frameRange, MeshData* data);
+
+private:
+    struct _MeshEntry
+    {
+        UsdGeomMesh mesh;
+        MeshData    data;
+        bool        ready = false;
+    };
+
+    void _PrefetchBatch(size_t first);
+
+    GfInterval                                         _frameRange;
+    size_t                                             _stepCount = 0;
+    std::vector<_MeshEntry>                            _meshes;
+    std::unordered_map<SdfPath, size_t, SdfPath::Hash> _meshIndices;
+    // Range of _meshes holding prefetched data.
+    size_t _batchBegin = 0;
+    size_t _batchEnd = 0;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
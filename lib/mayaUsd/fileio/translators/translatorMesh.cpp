@@ -15,6 +15,7 @@
 //
 #include "translatorMesh.h"
 
+#include <mayaUsd/fileio/primReaderPrefetch.h>
 #include <mayaUsd/fileio/translators/translatorUtil.h>
 #include <mayaUsd/fileio/utils/meshReadUtils.h>
 #include <mayaUsd/fileio/utils/meshWriteUtils.h>
@@ -24,8 +25,6 @@
 #include <mayaUsd/undo/OpUndoItems.h>
 #include <mayaUsd/utils/util.h>
 
-#include <pxr/usd/usdGeom/primvarsAPI.h>
-
 #include <maya/MDGModifier.h>
 #include <maya/MDoubleArray.h>
 #include <maya/MFloatArray.h>
@@ -66,11 +65,18 @@ TranslatorMeshRead::TranslatorMeshRead(
     // ==============================================
     // construct a Maya mesh
     // ==============================================
-    VtIntArray faceVertexCounts;
-    VtIntArray faceVertexIndices;
+    // The read job prefetches the USD data of the meshes it imports in
+    // parallel. Read it here if this mesh was not prefetched.
+    UsdMayaPrimReaderPrefetch::MeshData meshData;
+    UsdMayaPrimReaderPrefetch*          prefetch = context ? context->GetPrefetch() : nullptr;
+    if (!prefetch || !prefetch->TakeMeshData(prim.GetPath(), frameRange, &meshData)) {
+        UsdMayaPrimReaderPrefetch::ReadMeshData(mesh, frameRange, &meshData);
+    }
 
-    const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
-    if (fvc.ValueMightBeTimeVarying()) {
+    VtIntArray& faceVertexCounts = meshData.faceVertexCounts;
+    VtIntArray& faceVertexIndices = meshData.faceVertexIndices;
+
+    if (meshData.varyingFaceVertexCounts) {
         // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
         // for the mesh, perhaps?  For now, better to give a more specific error
         TF_RUNTIME_ERROR(
@@ -78,12 +84,9 @@ TranslatorMeshRead::TranslatorMeshRead(
             "faceVertexCounts), which isn't currently supported. "
             "Skipping...",
             prim.GetPath().GetText());
-    } else {
-        fvc.Get(&faceVertexCounts, UsdTimeCode::EarliestTime());
     }
 
-    const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
-    if (fvi.ValueMightBeTimeVarying()) {
+    if (meshData.varyingFaceVertexIndices) {
         // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
         // for the mesh, perhaps?  For now, better to give a more specific error
         TF_RUNTIME_ERROR(
@@ -91,8 +94,6 @@ TranslatorMeshRead::TranslatorMeshRead(
             "faceVertexIndices), which isn't currently supported. "
             "Skipping...",
             prim.GetPath().GetText());
-    } else {
-        fvi.Get(&faceVertexIndices, UsdTimeCode::EarliestTime());
     }
 
     // Sanity Checks. If the vertex arrays are empty, skip this mesh
@@ -117,42 +118,13 @@ TranslatorMeshRead::TranslatorMeshRead(
         }
     }
 
-    // Gather points and normals
-    // If timeInterval is non-empty, pick the first available sample in the
-    // timeInterval or default.
-    VtVec3fArray        points;
-    VtVec3fArray        normals;
-    TfToken             normalsInterpolation;
-    UsdTimeCode         pointsTimeSample = UsdTimeCode::EarliestTime();
-    UsdTimeCode         normalsTimeSample = UsdTimeCode::EarliestTime();
-    std::vector<double> pointsTimeSamples;
-
-    if (!frameRange.IsEmpty()) {
-        mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &pointsTimeSamples);
-        if (!pointsTimeSamples.empty()) {
-            m_pointsNumTimeSamples = pointsTimeSamples.size();
-            pointsTimeSample = pointsTimeSamples.front();
-        }
-
-        std::vector<double> normalsTimeSamples;
-        mesh.GetNormalsAttr().GetTimeSamplesInInterval(frameRange, &normalsTimeSamples);
-        if (!normalsTimeSamples.empty()) {
-            normalsTimeSample = normalsTimeSamples.front();
-        }
-    }
-
-    mesh.GetPointsAttr().Get(&points, pointsTimeSample);
-
-    /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
-    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
-
-    if (primvar.HasValue()) {
-        primvar.ComputeFlattened(&normals, normalsTimeSample);
-        normalsInterpolation = primvar.GetInterpolation();
-    } else {
-        mesh.GetNormalsAttr().Get(&normals, normalsTimeSample);
-        normalsInterpolation = mesh.GetNormalsInterpolation();
-    }
+    // Points and normals are those of the first available sample in the frame
+    // range, or default.
+    VtVec3fArray&              points = meshData.points;
+    VtVec3fArray&              normals = meshData.normals;
+    const TfToken&             normalsInterpolation = meshData.normalsInterpolation;
+    const std::vector<double>& pointsTimeSamples = meshData.pointsTimeSamples;
+    m_pointsNumTimeSamples = pointsTimeSamples.size();
 
     if (points.empty()) {
         TF_RUNTIME_ERROR(
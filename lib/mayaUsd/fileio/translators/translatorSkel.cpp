@@ -23,6 +23,7 @@
 
 #include <pxr/base/tf/staticData.h>
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdSkel/skeleton.h>
 #include <pxr/usd/usdSkel/skeletonQuery.h>
 #include <pxr/usd/usdSkel/skinningQuery.h>
@@ -44,6 +45,9 @@
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 
+#include <algorithm>
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // There are a lot of nodes and connections that go into a basic skinning rig.
@@ -205,48 +209,85 @@ bool _SetAnimPlugData(
     return true;
 }
 
-/// Set animation on \p transformNode.
-/// The \p xforms holds transforms at each time, while the \p times
-/// array holds the corresponding times.
+/// Joint-major, structure-of-arrays buffer holding the decomposed
+/// translate/rotate/scale channels of a set of transforms over time.
+/// The samples of channel \p c of transform \p x are stored contiguously,
+/// so each channel can be handed to Maya as-is when creating anim curves.
+class _XformAnimChannels
+{
+public:
+    enum Channel
+    {
+        TranslateX = 0,
+        RotateX = 3,
+        ScaleX = 6,
+        NumChannels = 9
+    };
+
+    _XformAnimChannels(size_t numXforms, size_t numSamples)
+        : _numSamples(numSamples)
+        , _data(numXforms * NumChannels * numSamples, 0.0)
+    {
+        // Scales default to 1, matching the values used when a
+        // decomposition fails.
+        for (size_t x = 0; x < numXforms; ++x) {
+            for (int c = ScaleX; c < NumChannels; ++c) {
+                std::fill_n(GetChannel(x, c), numSamples, 1.0);
+            }
+        }
+    }
+
+    size_t GetNumSamples() const { return _numSamples; }
+
+    double* GetChannel(size_t xformIdx, int channel)
+    {
+        return _data.data() + (xformIdx * NumChannels + channel) * _numSamples;
+    }
+
+    /// Decompose \p xform into the channels of \p xformIdx at \p sample.
+    /// This only touches the memory of the given transform, so distinct
+    /// transforms may be decomposed concurrently.
+    void Decompose(size_t xformIdx, size_t sample, const GfMatrix4d& xform)
+    {
+        GfVec3d t, r, s;
+        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
+            for (int c = 0; c < 3; ++c) {
+                GetChannel(xformIdx, TranslateX + c)[sample] = t[c];
+                GetChannel(xformIdx, RotateX + c)[sample] = r[c];
+                GetChannel(xformIdx, ScaleX + c)[sample] = s[c];
+            }
+        }
+    }
+
+private:
+    size_t              _numSamples;
+    std::vector<double> _data;
+};
+
+/// Set animation on \p transformNode from the channels of \p xformIdx
+/// held in \p channels. The \p times array holds the time of each sample.
 bool _SetTransformAnim(
     MFnDependencyNode&              transformNode,
-    const std::vector<GfMatrix4d>&  xforms,
+    _XformAnimChannels&             channels,
+    size_t                          xformIdx,
     MTimeArray&                     times,
     const UsdMayaPrimReaderContext* context,
     bool                            applyEulerFilter)
 {
-    if (xforms.size() != times.length()) {
-        TF_WARN("xforms size [%zu] != times size [%du].", xforms.size(), times.length());
+    if (channels.GetNumSamples() != times.length()) {
+        TF_WARN(
+            "xforms size [%zu] != times size [%du].", channels.GetNumSamples(), times.length());
         return false;
     }
-    if (xforms.empty())
+    if (channels.GetNumSamples() == 0)
         return true;
 
-    MStatus status;
-
     const unsigned int numSamples = times.length();
 
     if (numSamples > 1) {
-        MDoubleArray translates[3]
-            = { MDoubleArray(numSamples), MDoubleArray(numSamples), MDoubleArray(numSamples) };
-        MDoubleArray rotates[3]
-            = { MDoubleArray(numSamples), MDoubleArray(numSamples), MDoubleArray(numSamples) };
-        MDoubleArray scales[3] = { MDoubleArray(numSamples, 1),
-                                   MDoubleArray(numSamples, 1),
-                                   MDoubleArray(numSamples, 1) };
-
-        // Decompose all transforms.
-        for (unsigned int i = 0; i < numSamples; ++i) {
-            const auto& xform = xforms[i];
-            GfVec3d     t, r, s;
-            if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
-                for (int c = 0; c < 3; ++c) {
-                    translates[c][i] = t[c];
-                    rotates[c][i] = r[c];
-                    scales[c][i] = s[c];
-                }
-            }
-        }
+        double* rotates[3] = { channels.GetChannel(xformIdx, _XformAnimChannels::RotateX),
+                               channels.GetChannel(xformIdx, _XformAnimChannels::RotateX + 1),
+                               channels.GetChannel(xformIdx, _XformAnimChannels::RotateX + 2) };
 
         if (applyEulerFilter) {
             MPlug                         rotOrder = transformNode.findPlug("rotateOrder");
@@ -254,7 +295,7 @@ bool _SetTransformAnim(
                 = static_cast<MEulerRotation::RotationOrder>(rotOrder.asInt());
 
             MEulerRotation last(rotates[0][0], rotates[1][0], rotates[2][0], order);
-            for (unsigned int i = 1; i < rotates[0].length(); ++i) {
+            for (unsigned int i = 1; i < numSamples; ++i) {
                 MEulerRotation current(rotates[0][i], rotates[1][i], rotates[2][i], order);
                 current.setToClosestSolution(last);
                 rotates[0][i] = current[0];
@@ -265,31 +306,58 @@ bool _SetTransformAnim(
         }
 
         for (int c = 0; c < 3; ++c) {
+            MDoubleArray translates(
+                channels.GetChannel(xformIdx, _XformAnimChannels::TranslateX + c), numSamples);
+            MDoubleArray rots(rotates[c], numSamples);
+            MDoubleArray scales(
+                channels.GetChannel(xformIdx, _XformAnimChannels::ScaleX + c), numSamples);
             if (!_SetAnimPlugData(
-                    transformNode, _MayaTokens->translates[c], translates[c], times, context)
-                || !_SetAnimPlugData(
-                    transformNode, _MayaTokens->rotates[c], rotates[c], times, context)
+                    transformNode, _MayaTokens->translates[c], translates, times, context)
+                || !_SetAnimPlugData(transformNode, _MayaTokens->rotates[c], rots, times, context)
                 || !_SetAnimPlugData(
-                    transformNode, _MayaTokens->scales[c], scales[c], times, context)) {
+                    transformNode, _MayaTokens->scales[c], scales, times, context)) {
                 return false;
             }
         }
     } else {
-        const auto& xform = xforms.front();
-        GfVec3d     t, r, s;
-        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
-            for (int c = 0; c < 3; ++c) {
-                if (!UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->translates[c], t[c])
-                    || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->rotates[c], r[c])
-                    || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->scales[c], s[c])) {
-                    return false;
-                }
+        for (int c = 0; c < 3; ++c) {
+            const double t = channels.GetChannel(xformIdx, _XformAnimChannels::TranslateX + c)[0];
+            const double r = channels.GetChannel(xformIdx, _XformAnimChannels::RotateX + c)[0];
+            const double s = channels.GetChannel(xformIdx, _XformAnimChannels::ScaleX + c)[0];
+            if (!UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->translates[c], t)
+                || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->rotates[c], r)
+                || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->scales[c], s)) {
+                return false;
             }
         }
     }
     return true;
 }
 
+/// Set animation on \p transformNode.
+/// The \p xforms holds transforms at each time, while the \p times
+/// array holds the corresponding times.
+bool _SetTransformAnim(
+    MFnDependencyNode&              transformNode,
+    const std::vector<GfMatrix4d>&  xforms,
+    MTimeArray&                     times,
+    const UsdMayaPrimReaderContext* context,
+    bool                            applyEulerFilter)
+{
+    if (xforms.size() != times.length()) {
+        TF_WARN("xforms size [%zu] != times size [%du].", xforms.size(), times.length());
+        return false;
+    }
+    if (xforms.empty())
+        return true;
+
+    _XformAnimChannels channels(1, xforms.size());
+    for (size_t i = 0; i < xforms.size(); ++i) {
+        channels.Decompose(0, i, xforms[i]);
+    }
+    return _SetTransformAnim(transformNode, channels, 0, times, context, applyEulerFilter);
+}
+
 void _GetJointAnimTimeSamples(
     const UsdSkelSkeletonQuery&  skelQuery,
     const UsdMayaPrimReaderArgs& args,
@@ -527,41 +595,62 @@ bool _CopyAnimFromSkel(
         }
     }
 
-    // Pre-sample all joint animation.
+    // Pre-sample all joint animation. Each time sample is independent, so
+    // they are computed in parallel.
+    const size_t                 numJoints = skelQuery.GetTopology().GetNumJoints();
     std::vector<VtMatrix4dArray> samples(usdTimes.size());
-    for (size_t i = 0; i < samples.size(); ++i) {
-        if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])) {
-            return false;
-        }
-        if (!jointContainerIsSkeleton) {
-            // We do not have a node to receive the local transforms of the
-            // Skeleton, so any local transforms on the Skeleton must be
-            // concatened onto the root joints instead.
-            for (size_t j = 0; j < skelQuery.GetTopology().GetNumJoints(); ++j) {
-                if (skelQuery.GetTopology().GetParent(j) < 0) {
-                    // This is a root joint. Concat by the local skel xform.
-                    samples[i][j] *= skelLocalXforms[i];
+    std::atomic<bool>            sampled { true };
+    WorkParallelForN(samples.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])
+                || samples[i].size() != numJoints) {
+                sampled = false;
+                return;
+            }
+            if (!jointContainerIsSkeleton) {
+                // We do not have a node to receive the local transforms of the
+                // Skeleton, so any local transforms on the Skeleton must be
+                // concatened onto the root joints instead.
+                GfMatrix4d* xforms = samples[i].data();
+                for (size_t j = 0; j < numJoints; ++j) {
+                    if (skelQuery.GetTopology().GetParent(j) < 0) {
+                        // This is a root joint. Concat by the local skel xform.
+                        xforms[j] *= skelLocalXforms[i];
+                    }
                 }
             }
         }
-    }
+    });
+    if (!sampled)
+        return false;
 
-    MFnDependencyNode jointDep;
+    // Transpose the samples into per-joint channels, decomposing each joint
+    // in parallel.
+    const size_t       numJointNodes = std::min(jointNodes.size(), numJoints);
+    _XformAnimChannels channels(numJointNodes, samples.size());
+    WorkParallelForN(numJointNodes, [&](size_t begin, size_t end) {
+        for (size_t jointIdx = begin; jointIdx < end; ++jointIdx) {
+            for (size_t i = 0; i < samples.size(); ++i) {
+                channels.Decompose(jointIdx, i, samples[i].cdata()[jointIdx]);
+            }
+        }
+    });
+    samples.clear();
 
-    std::vector<GfMatrix4d> xforms(samples.size());
+    MFnDependencyNode jointDep;
 
-    for (size_t jointIdx = 0; jointIdx < jointNodes.size(); ++jointIdx) {
+    for (size_t jointIdx = 0; jointIdx < numJointNodes; ++jointIdx) {
 
         if (!jointDep.setObject(jointNodes[jointIdx]))
             continue;
 
-        // Get the transforms of just this joint.
-        for (size_t i = 0; i < samples.size(); ++i) {
-            xforms[i] = samples[i][jointIdx];
-        }
-
         if (!_SetTransformAnim(
-                jointDep, xforms, mayaTimes, context, args.GetJobArguments().applyEulerFilter))
+                jointDep,
+                channels,
+                jointIdx,
+                mayaTimes,
+                context,
+                args.GetJobArguments().applyEulerFilter))
             return false;
     }
     return true;
@@ -0,0 +1,172 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "animCurveSampler.h"
+
+#include <maya/MFnAnimCurve.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MTime.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+bool _IsNumeric(const MPlug& plug)
+{
+    if (plug.isArray() || plug.isCompound()) {
+        return false;
+    }
+
+    switch (plug.attribute().apiType()) {
+    case MFn::kNumericAttribute:
+    case MFn::kDoubleAngleAttribute:
+    case MFn::kFloatAngleAttribute:
+    case MFn::kDoubleLinearAttribute:
+    case MFn::kFloatLinearAttribute: return true;
+    default: return false;
+    }
+}
+
+// How the value of a numeric plug changes over time.
+enum class _Source
+{
+    kStatic,
+    kAnimCurve,
+    kOther
+};
+
+_Source _GetSource(const MPlug& plug, MObject* animCurve)
+{
+    if (!plug.isDestination()) {
+        return _Source::kStatic;
+    }
+
+    *animCurve = UsdMayaAnimCurveSampler::GetDrivingAnimCurve(plug);
+    return animCurve->isNull() ? _Source::kOther : _Source::kAnimCurve;
+}
+
+} // namespace
+
+/* static */
+MObject UsdMayaAnimCurveSampler::GetDrivingAnimCurve(const MPlug& plug)
+{
+    const MPlug source = plug.source();
+    if (source.isNull()) {
+        return MObject::kNullObj;
+    }
+
+    MObject node = source.node();
+    switch (node.apiType()) {
+    case MFn::kAnimCurveTimeToAngular:
+    case MFn::kAnimCurveTimeToDistance:
+    case MFn::kAnimCurveTimeToUnitless: break;
+    default: return MObject::kNullObj;
+    }
+
+    // A curve whose input is connected is evaluated at the value of its input,
+    // which is only the current time when it comes straight from a time node.
+    const MPlug input = MFnDependencyNode(node).findPlug("input", true);
+    if (input.isNull()) {
+        return MObject::kNullObj;
+    }
+    if (input.isDestination() && !input.source().node().hasFn(MFn::kTime)) {
+        return MObject::kNullObj;
+    }
+
+    return node;
+}
+
+/* static */
+bool UsdMayaAnimCurveSampler::CanSample(const MPlug& plug)
+{
+    MObject animCurve;
+    if (!plug.isCompound()) {
+        return _IsNumeric(plug) && _GetSource(plug, &animCurve) == _Source::kAnimCurve;
+    }
+
+    if (plug.isArray() || plug.isDestination()) {
+        return false;
+    }
+
+    bool               hasAnimCurve = false;
+    const unsigned int numChildren = plug.numChildren();
+    for (unsigned int c = 0; c < numChildren; ++c) {
+        const MPlug child = plug.child(c);
+        if (!_IsNumeric(child)) {
+            return false;
+        }
+
+        switch (_GetSource(child, &animCurve)) {
+        case _Source::kStatic: break;
+        case _Source::kAnimCurve: hasAnimCurve = true; break;
+        case _Source::kOther: return false;
+        }
+    }
+    return hasAnimCurve;
+}
+
+/* static */
+bool UsdMayaAnimCurveSampler::Sample(
+    const MPlug&               plug,
+    const std::vector<double>& frames,
+    std::vector<double>*       values)
+{
+    values->clear();
+    if (!CanSample(plug)) {
+        return false;
+    }
+
+    std::vector<MPlug> channels;
+    if (plug.isCompound()) {
+        const unsigned int numChildren = plug.numChildren();
+        for (unsigned int c = 0; c < numChildren; ++c) {
+            channels.push_back(plug.child(c));
+        }
+    } else {
+        channels.push_back(plug);
+    }
+
+    std::vector<MTime> times;
+    times.reserve(frames.size());
+    for (double frame : frames) {
+        times.emplace_back(frame, MTime::uiUnit());
+    }
+
+    // Fill the values one channel at a time, so that each curve is walked
+    // through once in increasing time order.
+    const size_t numChannels = channels.size();
+    values->resize(frames.size() * numChannels);
+    for (size_t c = 0; c < numChannels; ++c) {
+        MObject animCurve;
+        if (_GetSource(channels[c], &animCurve) == _Source::kStatic) {
+            const double value = channels[c].asDouble();
+            for (size_t f = 0; f < times.size(); ++f) {
+                (*values)[f * numChannels + c] = value;
+            }
+            continue;
+        }
+
+        MFnAnimCurve curveFn(animCurve);
+        for (size_t f = 0; f < times.size(); ++f) {
+            double value = 0.0;
+            curveFn.evaluate(times[f], value);
+            (*values)[f * numChannels + c] = value;
+        }
+    }
+
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,70 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_ANIM_CURVE_SAMPLER_H
+#define PXRUSDMAYA_ANIM_CURVE_SAMPLER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/pxr.h>
+
+#include <maya/MObject.h>
+#include <maya/MPlug.h>
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// This struct contains helpers to sample plugs driven directly by animation
+/// curves.
+///
+/// Evaluating an animation curve does not depend on the current time, so such
+/// plugs can be sampled over a whole frame range without changing the current
+/// time, which evaluates the whole scene at every frame.
+struct UsdMayaAnimCurveSampler
+{
+    /// Returns the time-driven animation curve directly connected to \p plug,
+    /// or a null object if \p plug is not driven by one. Curves whose input is
+    /// connected to anything but a time node, such as driven keys, are not
+    /// time-driven.
+    MAYAUSD_CORE_PUBLIC
+    static MObject GetDrivingAnimCurve(const MPlug& plug);
+
+    /// Returns whether the value of \p plug only changes over time through the
+    /// animation curves directly connected to it, so that it can be sampled
+    /// without changing the current time.
+    ///
+    /// \p plug must be a numeric plug or a compound of numeric plugs. The
+    /// children of a compound must each be driven by an animation curve or not
+    /// be connected, and at least one of them must be driven.
+    MAYAUSD_CORE_PUBLIC
+    static bool CanSample(const MPlug& plug);
+
+    /// Samples \p plug at each of the \p frames, given in the current UI time
+    /// unit, without changing the current time.
+    ///
+    /// Values are in Maya internal units, like MPlug::asDouble(). For compound
+    /// plugs, the values of the children at each frame are consecutive, so
+    /// \p values holds frames.size() times the number of children values.
+    ///
+    /// Returns false, leaving \p values empty, if \p plug cannot be sampled.
+    MAYAUSD_CORE_PUBLIC
+    static bool
+    Sample(const MPlug& plug, const std::vector<double>& frames, std::vector<double>* values);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
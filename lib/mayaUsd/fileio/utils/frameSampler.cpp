@@ -0,0 +1,141 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "frameSampler.h"
+
+#include <pxr/base/tf/diagnostic.h>
+
+#include <algorithm>
+#include <cmath>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Fraction of a tick under which times are considered the same.
+constexpr double kTickEpsilon = 1e-6;
+
+// Number of ticks of length \p tickLength from \p first to \p last included.
+size_t _NumTicks(double first, double last, double tickLength)
+{
+    if (last < first) {
+        return 0;
+    }
+    return static_cast<size_t>(std::floor((last - first) / tickLength + kTickEpsilon)) + 1;
+}
+
+// Snaps \p time to \p target if they are within a fraction of a tick.
+double _Snap(double time, double target, double tickLength)
+{
+    return std::abs(time - target) < kTickEpsilon * tickLength ? target : time;
+}
+
+// Snaps \p time to the last frame of the range or to a whole frame, if it is
+// within a fraction of a tick of it.
+double _SnapTickTime(double time, double lastFrame, double tickLength)
+{
+    time = _Snap(time, lastFrame, tickLength);
+    return _Snap(time, std::round(time), tickLength);
+}
+
+} // namespace
+
+/* static */
+std::vector<double> UsdMayaFrameSampler::GetTimeSamples(
+    const GfInterval&       frameRange,
+    const std::set<double>& subframeOffsets,
+    double                  stride)
+{
+    std::vector<double> samples;
+
+    // Error if stride is <= 0.0.
+    if (stride <= 0.0) {
+        TF_RUNTIME_ERROR("stride (%f) is not greater than 0", stride);
+        return samples;
+    }
+
+    // Only warn if subframe offsets are outside the stride. Resulting time
+    // samples are still sane.
+    for (const double t : subframeOffsets) {
+        if (t <= -stride) {
+            TF_WARN("subframe offset (%f) <= -stride (-%f)", t, stride);
+        } else if (t >= stride) {
+            TF_WARN("subframe offset (%f) >= stride (%f)", t, stride);
+        }
+    }
+
+    // Early-out if this is an empty range.
+    if (frameRange.IsEmpty()) {
+        return samples;
+    }
+
+    if (!frameRange.IsFinite()) {
+        TF_RUNTIME_ERROR("frame range is not finite");
+        return samples;
+    }
+
+    // Iterate over all possible times and sample offsets.
+    static const std::set<double> zeroOffset = { 0.0 };
+    const std::set<double>& actualOffsets = subframeOffsets.empty() ? zeroOffset : subframeOffsets;
+    const double            firstFrame = frameRange.GetMin();
+    const double            lastFrame = frameRange.GetMax();
+    const size_t            numTicks = _NumTicks(firstFrame, lastFrame, stride);
+    samples.reserve(numTicks * actualOffsets.size());
+    for (size_t tick = 0; tick < numTicks; ++tick) {
+        const double time = _SnapTickTime(firstFrame + tick * stride, lastFrame, stride);
+        if (!frameRange.Contains(time)) {
+            continue;
+        }
+        for (const double offset : actualOffsets) {
+            samples.push_back(_SnapTickTime(time + offset, lastFrame, stride));
+        }
+    }
+
+    // Need to sort list before returning to make sure it's in time order.
+    // This is mainly important for if there's a subframe offset outside the
+    // interval (-stride, stride), which can also land on other samples.
+    std::sort(samples.begin(), samples.end());
+    samples.erase(
+        std::unique(
+            samples.begin(),
+            samples.end(),
+            [](double a, double b) { return b - a < kTickEpsilon; }),
+        samples.end());
+    return samples;
+}
+
+/* static */
+std::vector<double> UsdMayaFrameSampler::GetSubframeTimeSamples(
+    double       firstFrame,
+    double       lastFrame,
+    unsigned int subSamples)
+{
+    // Each frame is cut into the same subframe offsets, so that subframes line
+    // up across frames and across exports.
+    const unsigned int numSubframes = std::max(1u, subSamples);
+    const double       tickLength = 1.0 / numSubframes;
+    const size_t       numTicks = _NumTicks(firstFrame, lastFrame, tickLength);
+
+    std::vector<double> samples;
+    samples.reserve(numTicks);
+    for (size_t tick = 0; tick < numTicks; ++tick) {
+        const double frame = firstFrame + static_cast<double>(tick / numSubframes);
+        const double offset = static_cast<double>(tick % numSubframes) / numSubframes;
+        samples.push_back(_SnapTickTime(frame + offset, lastFrame, tickLength));
+    }
+    return samples;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,80 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_FRAME_SAMPLER_H
+#define PXRUSDMAYA_FRAME_SAMPLER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/interval.h>
+#include <pxr/pxr.h>
+
+#include <set>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// This struct contains helpers to compute the times at which exports sample
+/// the scene.
+///
+/// Times are computed from integer ticks, each one from the start of the range,
+/// rather than by adding up increments, so that the error does not accumulate
+/// over long ranges. Times within a millionth of a tick of a whole frame are
+/// snapped to it, so that every export samples whole frames at the exact same
+/// time codes, which value clips and merged layers rely on.
+struct UsdMayaFrameSampler
+{
+    /// Gets an ordered list of frame samples for the given \p frameRange,
+    /// every \p stride frames, and computing extra subframe samples using
+    /// \p subframeOffsets.
+    ///
+    /// \p subframeOffsets is treated as a set of offsets from each sampled
+    /// frame; empty \p subframeOffsets is equivalent to {0.0}, which means to
+    /// only add one frame sample per stride. Samples closer than a millionth
+    /// of a frame are merged.
+    ///
+    /// Raises a runtime error and returns an empty list of time samples if
+    /// \p stride is not greater than 0, or \p frameRange is not finite.
+    /// Warns if any \p subframeOffsets fall outside of the open interval
+    /// (-\p stride, +\p stride), but returns a valid result in that case,
+    /// ensuring that the returned list is sorted.
+    ///
+    /// Example: frameRange = [1, 5], subframeOffsets = {0.0, 0.9}, stride = 2.0
+    ///     This gives the time samples [1, 1.9, 3, 3.9, 5, 5.9].
+    ///     Note that the \p subframeOffsets allows the last frame to go
+    ///     _outside_ the specified \p frameRange.
+    MAYAUSD_CORE_PUBLIC
+    static std::vector<double> GetTimeSamples(
+        const GfInterval&       frameRange,
+        const std::set<double>& subframeOffsets,
+        double                  stride = 1.0);
+
+    /// Gets an ordered list of \p subSamples evenly spaced samples per frame,
+    /// from \p firstFrame to \p lastFrame included. Zero \p subSamples is
+    /// equivalent to one.
+    ///
+    /// Unlike GetTimeSamples(), no sample goes past \p lastFrame. Returns an
+    /// empty list if \p lastFrame is before \p firstFrame.
+    ///
+    /// Example: firstFrame = 1, lastFrame = 2, subSamples = 3
+    ///     This gives the time samples [1, 1.333.., 1.666.., 2].
+    MAYAUSD_CORE_PUBLIC
+    static std::vector<double>
+    GetSubframeTimeSamples(double firstFrame, double lastFrame, unsigned int subSamples);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
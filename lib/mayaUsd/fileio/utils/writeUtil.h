@@ -291,6 +291,8 @@ struct UsdMayaWriteUtil
     ///     This gives the time samples [1, 1.9, 3, 3.9, 5, 5.9].
     ///     Note that the \p subframeOffsets allows the last frame to go
     ///     _outside_ the specified \p frameRange.
+    ///
+    /// \see UsdMayaFrameSampler::GetTimeSamples(), which this forwards to.
     MAYAUSD_CORE_PUBLIC
     static std::vector<double> GetTimeSamples(
         const GfInterval&       frameRange,
@@ -14,10 +14,15 @@
 //
 #include "xformStack.h"
 
+#include <mayaUsd/utils/hash.h>
+
 #include <pxr/base/tf/declarePtrs.h>
 #include <pxr/base/tf/stringUtils.h>
 
+#include <atomic>
 #include <exception>
+#include <mutex>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -134,6 +139,113 @@ UsdMayaXformStack::TokenIndexPairMap _buildOpNamesToIdxs(
     return result;
 }
 
+size_t _nextStackId()
+{
+    static std::atomic<size_t> nextId(0);
+    return ++nextId;
+}
+
+// Key of the matching cache: the stacks matched against, in order, followed
+// by the name and type of each xform op, in order. Stacks are identified by
+// an id that is never reused, so that a stack allocated where a destroyed one
+// was cannot see its results.
+struct _MatchingKey
+{
+    std::vector<size_t>                                    stackIds;
+    std::vector<std::pair<TfToken, UsdGeomXformOp::Type>> ops;
+
+    bool operator==(const _MatchingKey& other) const
+    {
+        return stackIds == other.stackIds && ops == other.ops;
+    }
+};
+
+struct _MatchingKeyHash
+{
+    size_t operator()(const _MatchingKey& key) const
+    {
+        size_t seed = key.ops.size();
+        for (size_t stackId : key.stackIds) {
+            MayaUsd::hash_combine(seed, stackId);
+        }
+        for (const auto& op : key.ops) {
+            MayaUsd::hash_combine(seed, op.first.Hash());
+            MayaUsd::hash_combine(seed, static_cast<int>(op.second));
+        }
+        return seed;
+    }
+};
+
+// Matching only depends on the names and types of the xform ops, and assets
+// use a handful of distinct xform op orders over many prims, so the results
+// are shared by all the prims, whichever thread they are translated from.
+class _MatchingCache
+{
+public:
+    static _MatchingCache& Get()
+    {
+        static _MatchingCache cache;
+        return cache;
+    }
+
+    bool Find(const _MatchingKey& key, UsdMayaXformStack::OpClassList* result)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto                  found = _results.find(key);
+        if (found == _results.end()) {
+            ++_misses;
+            return false;
+        }
+        ++_hits;
+        *result = found->second;
+        return true;
+    }
+
+    void Insert(const _MatchingKey& key, const UsdMayaXformStack::OpClassList& result)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _results.emplace(key, result);
+    }
+
+    UsdMayaXformStack::MatchingCacheStats GetStats() const
+    {
+        UsdMayaXformStack::MatchingCacheStats stats;
+        stats.hits = _hits;
+        stats.misses = _misses;
+        return stats;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _results.clear();
+        _hits = 0;
+        _misses = 0;
+    }
+
+private:
+    using _Results
+        = std::unordered_map<_MatchingKey, UsdMayaXformStack::OpClassList, _MatchingKeyHash>;
+
+    std::mutex          _mutex;
+    _Results            _results;
+    std::atomic<size_t> _hits { 0 };
+    std::atomic<size_t> _misses { 0 };
+};
+
+_MatchingKey _makeMatchingKey(
+    std::vector<size_t>&&              stackIds,
+    const std::vector<UsdGeomXformOp>& xformops)
+{
+    _MatchingKey key;
+    key.stackIds = std::move(stackIds);
+    key.ops.reserve(xformops.size());
+    for (const UsdGeomXformOp& xformOp : xformops) {
+        key.ops.emplace_back(xformOp.GetName(), xformOp.GetOpType());
+    }
+    return key;
+}
+
 } // namespace
 
 class UsdMayaXformOpClassification::_Data : public TfRefBase
@@ -285,6 +397,7 @@ public:
         , m_attrNamesToIdxs(_buildAttrNamesToIdxs(m_ops, m_inversionMap))
         , m_opNamesToIdxs(_buildOpNamesToIdxs(m_ops, m_inversionMap))
         , m_nameMatters(nameMatters)
+        , m_id(_nextStackId())
     {
         // Verify that all inversion twins are of same type, and exactly one is marked
         // as the inverted twin
@@ -349,6 +462,9 @@ public:
     UsdMayaXformStack::TokenIndexPairMap m_opNamesToIdxs;
 
     bool m_nameMatters = true;
+
+    // Identifies the stack in the matching cache.
+    const size_t m_id;
 };
 
 UsdMayaXformStack::UsdMayaXformStack(
@@ -427,10 +543,23 @@ const UsdMayaXformStack::OpClassPair UsdMayaXformStack::FindOpPair(const TfToken
 UsdMayaXformStack::OpClassList
 UsdMayaXformStack::MatchingSubstack(const std::vector<UsdGeomXformOp>& xformops) const
 {
-    static const UsdMayaXformStack::OpClassList _NO_MATCH;
-
     if (xformops.empty())
-        return _NO_MATCH;
+        return UsdMayaXformStack::OpClassList();
+
+    const _MatchingKey key = _makeMatchingKey({ _sharedData->m_id }, xformops);
+
+    UsdMayaXformStack::OpClassList ret;
+    if (!_MatchingCache::Get().Find(key, &ret)) {
+        ret = _MatchingSubstack(xformops);
+        _MatchingCache::Get().Insert(key, ret);
+    }
+    return ret;
+}
+
+UsdMayaXformStack::OpClassList
+UsdMayaXformStack::_MatchingSubstack(const std::vector<UsdGeomXformOp>& xformops) const
+{
+    static const UsdMayaXformStack::OpClassList _NO_MATCH;
 
     UsdMayaXformStack::OpClassList ret;
 
@@ -557,16 +686,36 @@ UsdMayaXformStack::OpClassList UsdMayaXformStack::FirstMatchingSubstack(
         return UsdMayaXformStack::OpClassList();
     }
 
+    std::vector<size_t> stackIds;
+    stackIds.reserve(stacks.size());
     for (auto& stackPtr : stacks) {
-        std::vector<UsdMayaXformStack::OpClass> stackOps = stackPtr->MatchingSubstack(xformops);
+        stackIds.push_back(stackPtr->_sharedData->m_id);
+    }
+    const _MatchingKey key = _makeMatchingKey(std::move(stackIds), xformops);
+
+    UsdMayaXformStack::OpClassList stackOps;
+    if (_MatchingCache::Get().Find(key, &stackOps)) {
+        return stackOps;
+    }
+
+    for (auto& stackPtr : stacks) {
+        stackOps = stackPtr->_MatchingSubstack(xformops);
         if (!stackOps.empty()) {
-            return stackOps;
+            break;
         }
     }
 
-    return UsdMayaXformStack::OpClassList();
+    _MatchingCache::Get().Insert(key, stackOps);
+    return stackOps;
 }
 
+UsdMayaXformStack::MatchingCacheStats UsdMayaXformStack::GetMatchingCacheStats()
+{
+    return _MatchingCache::Get().GetStats();
+}
+
+void UsdMayaXformStack::ClearMatchingCache() { _MatchingCache::Get().Clear(); }
+
 const UsdMayaXformStack& UsdMayaXformStack::MayaStack()
 {
     static UsdMayaXformStack mayaStack(
@@ -255,6 +255,9 @@ public:
     /// This returns a vector of the matching XformOpDefinitions in this stack. The
     /// size of this vector will be 0 if no complete match is found, or xformops.size()
     /// if a complete match is found.
+    ///
+    /// Results are cached by the names and types of the xform ops, so matching
+    /// the same xform op order again only costs a lookup.
     MAYAUSD_CORE_PUBLIC
     OpClassList MatchingSubstack(const std::vector<UsdGeomXformOp>& xformops) const;
 
@@ -316,14 +319,35 @@ public:
     ///
     /// Returns the first non-empty result it finds; if all stacks
     /// return an empty vector, an empty vector is returned.
+    /// Like MatchingSubstack, the result is cached for the given list of stacks.
     MAYAUSD_CORE_PUBLIC
     static OpClassList FirstMatchingSubstack(
         const std::vector<UsdMayaXformStack const*>& stacks,
         const std::vector<UsdGeomXformOp>&           xformops);
 
+    /// \brief Number of lookups in the cache of matching substacks that found
+    /// a result, and that had to run the matching.
+    struct MatchingCacheStats
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+    };
+
+    /// \brief Returns the hit and miss counts of the matching substack cache
+    /// since it was last cleared.
+    MAYAUSD_CORE_PUBLIC
+    static MatchingCacheStats GetMatchingCacheStats();
+
+    /// \brief Clears the matching substack cache and its hit and miss counts.
+    MAYAUSD_CORE_PUBLIC
+    static void ClearMatchingCache();
+
 private:
     class _Data;
 
+    // Matches the xform ops against this stack, without going through the cache.
+    OpClassList _MatchingSubstack(const std::vector<UsdGeomXformOp>& xformops) const;
+
     // Because this is an immutable type, we keep a pointer to shared
     // data; this allows us to only have overhead associated with
     // a RefPtr, while having easy-python-wrapping (without overhead
@@ -0,0 +1,269 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "asyncStageLoader.h"
+
+#include <mayaUsd/nodes/proxyShapeBase.h>
+#include <mayaUsd/utils/progressBarScope.h>
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/ar/resolver.h>
+
+#include <maya/MGlobal.h>
+#include <maya/MPlug.h>
+#include <maya/MString.h>
+#include <maya/MTimerMessage.h>
+
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace MAYAUSD_NS_DEF {
+
+MAYAUSD_VERIFY_CLASS_NOT_MOVE_OR_COPY(AsyncStageLoader);
+
+struct AsyncStageLoader::State
+{
+    std::atomic<bool> done { false };
+    std::atomic<bool> cancelled { false };
+
+    // Notified by the worker thread when it sets done.
+    std::mutex              doneMutex;
+    std::condition_variable doneCondition;
+
+    // Written by the worker thread before it sets done.
+    UsdStageRefPtr stage;
+};
+
+namespace {
+
+// Period of the main-thread timer checking on the load, in seconds.
+constexpr float kTimerPeriod = 0.1f;
+
+// The duration of a load is unknown, so the progress bar approaches its end
+// exponentially, covering about two thirds of the remaining range every
+// kProgressTimeConstant seconds.
+constexpr int    kProgressSteps = 100;
+constexpr double kProgressTimeConstant = 10.0;
+
+using StatePtr = std::shared_ptr<AsyncStageLoader::State>;
+
+struct Worker
+{
+    StatePtr    state;
+    std::thread thread;
+};
+
+std::mutex& workersMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Worker threads outlive the loaders that are destroyed while loading, so they
+// are kept here to be joined when they are done, or when the plugin unloads.
+std::vector<Worker>& workers()
+{
+    static std::vector<Worker> workers;
+    return workers;
+}
+
+void load(const StatePtr& state, const AsyncStageLoader::Request& request)
+{
+    TRACE_FUNCTION();
+
+    // Note: no UsdStageCacheContext is active on the worker thread, so the
+    //       stage is not inserted in any stage cache. The proxy shape inserts
+    //       it in its stage cache on the main thread when it takes it.
+    if (!state->cancelled) {
+#if AR_VERSION == 1
+        // As done by the proxy shape before opening its stage synchronously.
+        ArGetResolver().ConfigureResolverForAsset(request.filePath);
+#endif
+
+        SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(request.filePath);
+        if (rootLayer && !state->cancelled) {
+            UsdStageRefPtr stage = request.sessionLayer
+                ? UsdStage::Open(rootLayer, request.sessionLayer, request.loadSet)
+                : UsdStage::Open(rootLayer, request.loadSet);
+            if (!state->cancelled) {
+                state->stage = std::move(stage);
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state->doneMutex);
+        state->done = true;
+    }
+    state->doneCondition.notify_all();
+}
+
+} // namespace
+
+AsyncStageLoader::AsyncStageLoader(const MObject& shape, const Request& request)
+    : _request(request)
+    , _shape(shape)
+    , _state(std::make_shared<State>())
+    , _startTime(std::chrono::steady_clock::now())
+{
+    // The placeholder is read-only so that nothing gets authored in it and
+    // then lost, or saved with the Maya scene, when the real stage arrives.
+    SdfLayerRefPtr placeholderLayer = SdfLayer::CreateAnonymous("asyncStageLoaderPlaceholder");
+    placeholderLayer->SetPermissionToEdit(false);
+    _placeholder = UsdStage::Open(placeholderLayer, UsdStage::LoadNone);
+    _placeholder->GetSessionLayer()->SetPermissionToEdit(false);
+
+    {
+        std::lock_guard<std::mutex> lock(workersMutex());
+
+        // Reap the workers of previous loads.
+        std::vector<Worker>& allWorkers = workers();
+        for (auto iter = allWorkers.begin(); iter != allWorkers.end();) {
+            if (iter->state->done) {
+                iter->thread.join();
+                iter = allWorkers.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+
+        allWorkers.push_back({ _state, std::thread(load, _state, _request) });
+    }
+
+    MStatus status;
+    _timerCallbackId = MTimerMessage::addTimerCallback(kTimerPeriod, onTimer, this, &status);
+    CHECK_MSTATUS(status);
+}
+
+AsyncStageLoader::~AsyncStageLoader() { cancel(); }
+
+bool AsyncStageLoader::isLoading() const { return !_state->done && !_state->cancelled; }
+
+bool AsyncStageLoader::isCancelled() const { return _state->cancelled; }
+
+UsdStageRefPtr AsyncStageLoader::takeStage()
+{
+    if (!_state->done || _state->cancelled) {
+        return nullptr;
+    }
+    return std::move(_state->stage);
+}
+
+void AsyncStageLoader::cancel()
+{
+    stop();
+    if (_state->cancelled) {
+        return;
+    }
+
+    _state->cancelled = true;
+    if (!_state->done) {
+        MGlobal::displayInfo(
+            MString("Cancelled the loading of the USD stage ") + _request.filePath.c_str());
+    }
+}
+
+void AsyncStageLoader::wait()
+{
+    if (_state->cancelled) {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_state->doneMutex);
+        _state->doneCondition.wait(lock, [this]() { return _state->done.load(); });
+    }
+    update();
+}
+
+/* static */
+void AsyncStageLoader::waitForAll()
+{
+    std::lock_guard<std::mutex> lock(workersMutex());
+    for (Worker& worker : workers()) {
+        worker.state->cancelled = true;
+    }
+    for (Worker& worker : workers()) {
+        worker.thread.join();
+    }
+    workers().clear();
+}
+
+/* static */
+void AsyncStageLoader::onTimer(float, float, void* clientData)
+{
+    static_cast<AsyncStageLoader*>(clientData)->update();
+}
+
+void AsyncStageLoader::update()
+{
+    if (_state->done) {
+        // Only dirty the proxy shape once, whether the load completion is
+        // noticed by the timer or by wait().
+        if (_timerCallbackId == 0) {
+            return;
+        }
+        stop();
+
+        // Dirty the proxy shape so that its next compute takes the loaded
+        // stage, as the layer manager does after loading layers.
+        if (_shape.isValid()) {
+            MPlug recomputePlug(_shape.object(), MayaUsdProxyShapeBase::recomputeLayersAttr);
+            recomputePlug.setInt64(recomputePlug.asInt64() + 1);
+        }
+        return;
+    }
+
+    if (!_progress) {
+        _progress = std::make_unique<ProgressBarScope>(
+            true,
+            true,
+            kProgressSteps,
+            MString("Loading USD stage ") + _request.filePath.c_str());
+    }
+
+    if (_progress->isInterruptRequested()) {
+        cancel();
+        return;
+    }
+
+    const double elapsed
+        = std::chrono::duration<double>(std::chrono::steady_clock::now() - _startTime).count();
+    const int steps = static_cast<int>(
+        (kProgressSteps - 1) * (1.0 - std::exp(-elapsed / kProgressTimeConstant)));
+    if (steps > _progressSteps) {
+        _progress->advance(steps - _progressSteps);
+        _progressSteps = steps;
+    }
+}
+
+void AsyncStageLoader::stop()
+{
+    if (_timerCallbackId != 0) {
+        MMessage::removeCallback(_timerCallbackId);
+        _timerCallbackId = 0;
+    }
+    _progress.reset();
+}
+
+} // namespace MAYAUSD_NS_DEF
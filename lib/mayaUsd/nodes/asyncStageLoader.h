@@ -0,0 +1,127 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_ASYNC_STAGE_LOADER_H
+#define MAYAUSD_ASYNC_STAGE_LOADER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <maya/MMessage.h>
+#include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace MAYAUSD_NS_DEF {
+
+class ProgressBarScope;
+
+/// \class AsyncStageLoader
+/// \brief Opens the USD stage of a proxy shape on a worker thread.
+///
+/// Opening a large stage blocks the DG compute of the proxy shape for as long
+/// as it takes to read the root layer and compose the stage. When a proxy shape
+/// loads its stage asynchronously, its compute outputs the empty placeholder
+/// stage of the loader right away while a worker thread opens the real stage.
+///
+/// A timer on the main thread reports the load in the Maya progress bar, where
+/// it can be interrupted with the escape key, and dirties the proxy shape once
+/// the stage is ready. The next compute of the proxy shape then takes the stage
+/// from the loader and swaps it in. Code that needs the stage right away, such
+/// as scripts and the Maya scene save, calls wait() instead of waiting for the
+/// timer.
+///
+/// UsdStage::Open cannot be interrupted, so cancelling a load lets the worker
+/// finish and discards its stage.
+class MAYAUSD_CORE_PUBLIC AsyncStageLoader
+{
+public:
+    /// \brief The arguments of UsdStage::Open for the stage to load.
+    struct Request
+    {
+        std::string                      filePath;
+        PXR_NS::SdfLayerRefPtr           sessionLayer;
+        PXR_NS::UsdStage::InitialLoadSet loadSet;
+
+        bool operator==(const Request& other) const
+        {
+            return filePath == other.filePath && sessionLayer == other.sessionLayer
+                && loadSet == other.loadSet;
+        }
+    };
+
+    /// \brief State of a load, shared with its worker thread. Implementation detail.
+    struct State;
+
+    /// \brief Start loading the stage of the proxy shape \p shape.
+    AsyncStageLoader(const MObject& shape, const Request& request);
+
+    /// \brief Cancel the load if it is still running.
+    ~AsyncStageLoader();
+
+    MAYAUSD_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(AsyncStageLoader);
+
+    const Request& request() const { return _request; }
+
+    /// \brief The empty stage to use while the stage is loading.
+    const PXR_NS::UsdStageRefPtr& placeholder() const { return _placeholder; }
+
+    /// \brief Returns true while the worker thread has not completed nor been cancelled.
+    bool isLoading() const;
+
+    /// \brief Returns true if the load was cancelled.
+    bool isCancelled() const;
+
+    /// \brief Take the loaded stage. Returns null if the load is not complete,
+    /// was cancelled or failed.
+    PXR_NS::UsdStageRefPtr takeStage();
+
+    /// \brief Stop reporting progress and discard the stage when it is loaded.
+    void cancel();
+
+    /// \brief Block until the worker thread is done, then dirty the proxy shape
+    ///        so that its next compute takes the loaded stage. Does nothing if
+    ///        the load was cancelled.
+    void wait();
+
+    /// \brief Cancel all loads and wait for their worker threads to exit.
+    ///        Must be called before the plugin is unloaded.
+    static void waitForAll();
+
+private:
+    static void onTimer(float elapsedTime, float lastTime, void* clientData);
+
+    void update();
+    void stop();
+
+    const Request                         _request;
+    const MObjectHandle                   _shape;
+    PXR_NS::UsdStageRefPtr                _placeholder;
+    std::shared_ptr<State>                _state;
+    std::unique_ptr<ProgressBarScope>     _progress;
+    int                                   _progressSteps { 0 };
+    std::chrono::steady_clock::time_point _startTime;
+    MCallbackId                           _timerCallbackId { 0 };
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif
@@ -742,7 +742,16 @@ bool LayerDatabase::getProxiesToSave(bool isExport, bool* hasAnyProxy)
                 *hasAnyProxy = true;
 
             MayaUsdProxyShapeBase* pShape = static_cast<MayaUsdProxyShapeBase*>(fn.userNode());
-            UsdStageRefPtr         stage = pShape ? pShape->getUsdStage() : nullptr;
+
+            // Finish any asynchronous load of the stage, so that the loaded stage
+            // gets saved instead of the placeholder. When the load was cancelled,
+            // only the placeholder exists: there is nothing to save and the file
+            // path of the proxy shape is enough to load the stage again.
+            if (pShape && !pShape->waitForStageLoad()) {
+                continue;
+            }
+
+            UsdStageRefPtr stage = pShape ? pShape->getUsdStage() : nullptr;
             if (!stage) {
                 continue;
             }
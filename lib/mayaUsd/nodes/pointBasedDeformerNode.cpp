@@ -16,14 +16,15 @@
 #include "pointBasedDeformerNode.h"
 
 #include <mayaUsd/nodes/stageData.h>
+#include <mayaUsd/utils/attributeReadAheadCache.h>
 
-#include <pxr/base/gf/math.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
@@ -31,9 +32,11 @@
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/pointBased.h>
 
+#include <maya/MArrayDataHandle.h>
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
 #include <maya/MFnData.h>
+#include <maya/MFnNumericAttribute.h>
 #include <maya/MFnPluginData.h>
 #include <maya/MFnStringData.h>
 #include <maya/MFnTypedAttribute.h>
@@ -43,6 +46,7 @@
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 #include <maya/MPoint.h>
+#include <maya/MPointArray.h>
 #include <maya/MPxDeformerNode.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
@@ -50,6 +54,7 @@
 #include <maya/MTypeId.h>
 
 #include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -65,6 +70,51 @@ const MString UsdMayaPointBasedDeformerNode::typeName(
 MObject UsdMayaPointBasedDeformerNode::inUsdStageAttr;
 MObject UsdMayaPointBasedDeformerNode::primPathAttr;
 MObject UsdMayaPointBasedDeformerNode::timeAttr;
+MObject UsdMayaPointBasedDeformerNode::interpolateSamplesAttr;
+
+namespace {
+
+// Below this number of points, deforming in parallel costs more than it saves.
+constexpr size_t kParallelDeformThreshold = 16384;
+
+template <class Fn> void _ForEachPointRange(size_t numPoints, const Fn& fn)
+{
+    if (numPoints < kParallelDeformThreshold) {
+        fn(0, numPoints);
+    } else {
+        WorkParallelForN(numPoints, fn);
+    }
+}
+
+// Get the points of the two time samples bracketing the given time, and where
+// the time lies between them. Returns false if the time is not strictly between
+// two samples, or if the samples do not have the same number of points.
+bool _GetBracketingPoints(
+    const UsdAttribute& pointsAttr,
+    double              time,
+    VtVec3fArray*       lowerPoints,
+    VtVec3fArray*       upperPoints,
+    float*              alpha)
+{
+    double lower = 0.0;
+    double upper = 0.0;
+    bool   hasTimeSamples = false;
+    if (!pointsAttr.GetBracketingTimeSamples(time, &lower, &upper, &hasTimeSamples)
+        || !hasTimeSamples || lower >= upper) {
+        return false;
+    }
+
+    UsdMayaAttributeReadAheadCache& cache = UsdMayaAttributeReadAheadCache::GetInstance();
+    if (!cache.Get(pointsAttr, lower, lowerPoints) || !cache.Get(pointsAttr, upper, upperPoints)
+        || lowerPoints->size() != upperPoints->size()) {
+        return false;
+    }
+
+    *alpha = static_cast<float>((time - lower) / (upper - lower));
+    return true;
+}
+
+} // namespace
 
 /* static */
 void* UsdMayaPointBasedDeformerNode::creator() { return new UsdMayaPointBasedDeformerNode(); }
@@ -105,12 +155,21 @@ MStatus UsdMayaPointBasedDeformerNode::initialize()
     status = addAttribute(timeAttr);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
+    MFnNumericAttribute numericAttrFn;
+    interpolateSamplesAttr = numericAttrFn.create(
+        "interpolateSamples", "isp", MFnNumericData::kBoolean, 0.0, &status);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+    status = addAttribute(interpolateSamplesAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+
     status = attributeAffects(inUsdStageAttr, outputGeom);
     CHECK_MSTATUS_AND_RETURN_IT(status);
     status = attributeAffects(primPathAttr, outputGeom);
     CHECK_MSTATUS_AND_RETURN_IT(status);
     status = attributeAffects(timeAttr, outputGeom);
     CHECK_MSTATUS_AND_RETURN_IT(status);
+    status = attributeAffects(interpolateSamplesAttr, outputGeom);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
 
     return status;
 }
@@ -161,29 +220,105 @@ MStatus UsdMayaPointBasedDeformerNode::deform(
     CHECK_MSTATUS_AND_RETURN_IT(status);
     const float envelope = envelopeHandle.asFloat();
 
+    const MDataHandle interpolateSamplesHandle = block.inputValue(interpolateSamplesAttr, &status);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+
+    const UsdAttribute pointsAttr = usdPointBased.GetPointsAttr();
+
     VtVec3fArray usdPoints;
-    if (!usdPointBased.GetPointsAttr().Get(&usdPoints, usdTime) || usdPoints.empty()) {
+    VtVec3fArray nextUsdPoints;
+    float        sampleAlpha = 0.0f;
+    bool         interpolate = false;
+    if (interpolateSamplesHandle.asBool()) {
+        interpolate = _GetBracketingPoints(
+            pointsAttr, usdTime.GetValue(), &usdPoints, &nextUsdPoints, &sampleAlpha);
+    }
+    // Reading the points through the read-ahead cache lets playback be served
+    // from memory instead of waiting on the file for every frame.
+    if (!interpolate
+        && !UsdMayaAttributeReadAheadCache::GetInstance().Get(pointsAttr, usdTime, &usdPoints)) {
+        return MS::kFailure;
+    }
+    if (usdPoints.empty()) {
         return MS::kFailure;
     }
 
+    // Walking the iterator for the indices alone is cheap, unlike getting and
+    // setting the positions one point at a time, which is done in bulk instead.
+    std::vector<int> indices;
+    indices.reserve(iter.exactCount());
     for (; !iter.isDone(); iter.next()) {
-        const int index = iter.index();
-        if (index < 0 || static_cast<size_t>(index) >= usdPoints.size()) {
-            continue;
+        indices.push_back(iter.index());
+    }
+    iter.reset();
+
+    if (indices.empty()) {
+        return status;
+    }
+
+    MPointArray positions;
+    status = iter.allPositions(positions);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+    if (positions.length() != indices.size()) {
+        return MS::kFailure;
+    }
+
+    // Deformers created on import have no painted weights, so the per-point
+    // weight lookup can usually be skipped.
+    std::vector<float> pointWeights;
+    if (_HasPaintedWeights(block, multiIndex)) {
+        pointWeights.resize(indices.size());
+        for (size_t i = 0u; i < indices.size(); ++i) {
+            pointWeights[i] = weightValue(block, multiIndex, indices[i]);
         }
+    }
 
-        const MPoint mayaPoint = iter.position();
-        const float  weight = weightValue(block, multiIndex, index);
+    const size_t   numUsdPoints = usdPoints.size();
+    const GfVec3f* usdPointsData = usdPoints.cdata();
+    const GfVec3f* nextUsdPointsData = interpolate ? nextUsdPoints.cdata() : nullptr;
+    const float*   weightsData = pointWeights.empty() ? nullptr : pointWeights.data();
+    const int*     indicesData = indices.data();
+    MPoint*        positionsData = &positions[0];
+
+    _ForEachPointRange(indices.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const int index = indicesData[i];
+            if (index < 0 || static_cast<size_t>(index) >= numUsdPoints) {
+                continue;
+            }
+
+            GfVec3f usdPoint = usdPointsData[index];
+            if (nextUsdPointsData) {
+                usdPoint += sampleAlpha * (nextUsdPointsData[index] - usdPoint);
+            }
+
+            const double blend = envelope * (weightsData ? weightsData[i] : 1.0f);
+            MPoint&      mayaPoint = positionsData[i];
+            mayaPoint.x = (1.0 - blend) * mayaPoint.x + blend * usdPoint[0];
+            mayaPoint.y = (1.0 - blend) * mayaPoint.y + blend * usdPoint[1];
+            mayaPoint.z = (1.0 - blend) * mayaPoint.z + blend * usdPoint[2];
+        }
+    });
 
-        const GfVec3f& usdPoint = usdPoints[static_cast<size_t>(index)];
+    return iter.setAllPositions(positions);
+}
 
-        const GfVec3f deformedPoint = GfLerp<GfVec3f>(
-            weight * envelope, GfVec3f(mayaPoint[0], mayaPoint[1], mayaPoint[2]), usdPoint);
+bool UsdMayaPointBasedDeformerNode::_HasPaintedWeights(MDataBlock& block, unsigned int multiIndex)
+    const
+{
+    MStatus          status;
+    MArrayDataHandle weightListHandle = block.inputArrayValue(weightList, &status);
+    if (!status || !weightListHandle.jumpToElement(multiIndex)) {
+        return false;
+    }
 
-        iter.setPosition(MPoint(deformedPoint[0], deformedPoint[1], deformedPoint[2]));
+    MDataHandle weightsHandle = weightListHandle.inputValue(&status).child(weights);
+    if (!status) {
+        return false;
     }
 
-    return status;
+    MArrayDataHandle weightsArrayHandle(weightsHandle, &status);
+    return status && weightsArrayHandle.elementCount() > 0u;
 }
 
 UsdMayaPointBasedDeformerNode::UsdMayaPointBasedDeformerNode()
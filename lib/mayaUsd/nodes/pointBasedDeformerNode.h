@@ -52,6 +52,10 @@ TF_DECLARE_PUBLIC_TOKENS(
 /// the deformer runs, it will read the points attribute of the prim at that
 /// time sample and use the positions to modify the positions of the geometry
 /// being deformed.
+///
+/// When the interpolateSamples attribute is on, the positions at a time between
+/// two time samples are linearly interpolated from the bracketing samples,
+/// whatever the interpolation mode of the stage.
 class UsdMayaPointBasedDeformerNode : public MPxDeformerNode
 {
 public:
@@ -67,6 +71,8 @@ public:
     static MObject primPathAttr;
     MAYAUSD_CORE_PUBLIC
     static MObject timeAttr;
+    MAYAUSD_CORE_PUBLIC
+    static MObject interpolateSamplesAttr;
 
     MAYAUSD_CORE_PUBLIC
     static void* creator();
@@ -82,6 +88,8 @@ public:
 
 private:
     UsdMayaPointBasedDeformerNode();
+
+    bool _HasPaintedWeights(MDataBlock& block, unsigned int multiIndex) const;
     ~UsdMayaPointBasedDeformerNode() override;
 
     UsdMayaPointBasedDeformerNode(const UsdMayaPointBasedDeformerNode&);
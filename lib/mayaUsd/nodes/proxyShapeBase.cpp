@@ -20,6 +20,7 @@
 #include <mayaUsd/fileio/utils/readUtil.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/listeners/proxyShapeNotice.h>
+#include <mayaUsd/nodes/asyncStageLoader.h>
 #include <mayaUsd/nodes/layerManager.h>
 #include <mayaUsd/nodes/proxyShapeStageExtraData.h>
 #include <mayaUsd/nodes/stageData.h>
@@ -179,6 +180,7 @@ MObject MayaUsdProxyShapeBase::outStageCacheIdAttr;
 MObject MayaUsdProxyShapeBase::variantFallbacksAttr;
 MObject MayaUsdProxyShapeBase::layerManagerAttr;
 MObject MayaUsdProxyShapeBase::recomputeLayersAttr;
+MObject MayaUsdProxyShapeBase::loadStageAsyncAttr;
 
 namespace {
 // utility function to extract the tag name from an anonymous layer.
@@ -512,6 +514,14 @@ MStatus MayaUsdProxyShapeBase::initialize()
     retValue = addAttribute(recomputeLayersAttr);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
 
+    loadStageAsyncAttr = numericAttrFn.create(
+        "loadStageAsync", "lsa", MFnNumericData::kBoolean, 0.0, &retValue);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    numericAttrFn.setKeyable(false);
+    numericAttrFn.setAffectsAppearance(true);
+    retValue = addAttribute(loadStageAsyncAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
     //
     // add attribute dependencies
     //
@@ -580,6 +590,13 @@ MStatus MayaUsdProxyShapeBase::initialize()
     retValue = attributeAffects(recomputeLayersAttr, inStageDataCachedAttr);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
 
+    retValue = attributeAffects(loadStageAsyncAttr, inStageDataCachedAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    retValue = attributeAffects(loadStageAsyncAttr, outStageDataAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    retValue = attributeAffects(loadStageAsyncAttr, outStageCacheIdAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
     return retValue;
 }
 
@@ -1002,6 +1019,37 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
             TF_DEBUG(USDMAYA_PROXYSHAPEBASE)
                 .Msg("ProxyShapeBase::loadStage called for the usd file: %s\n", fileString.c_str());
 
+            // While the stage loads on a worker thread, output an empty placeholder
+            // stage and skip all the stage setup below, which is done when the
+            // loaded stage is swapped in.
+            //
+            // Note: the global variant fallbacks are only set for the duration of
+            //       this compute and the unshared stage is composed on top of the
+            //       shared one, so these cases are always loaded synchronously.
+            if (sharableStage && fallbacks.empty()) {
+                if (UsdStageRefPtr placeholder
+                    = computeAsyncStagePlaceholder(dataBlock, fileString, loadSet)) {
+                    MFnPluginData pluginDataFn;
+                    pluginDataFn.create(MayaUsdStageData::mayaTypeId, &retValue);
+                    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
+                    MayaUsdStageData* stageData
+                        = reinterpret_cast<MayaUsdStageData*>(pluginDataFn.data(&retValue));
+                    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
+                    stageData->stage = placeholder;
+                    stageData->primPath = placeholder->GetPseudoRoot().GetPath();
+
+                    MDataHandle inDataCachedHandle
+                        = dataBlock.outputValue(inStageDataCachedAttr, &retValue);
+                    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
+                    inDataCachedHandle.set(stageData);
+                    inDataCachedHandle.setClean();
+                    return MS::kSuccess;
+                }
+            }
+
             // == Load the Stage
 
             {
@@ -1287,6 +1335,86 @@ MStatus MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
     return MS::kSuccess;
 }
 
+UsdStageRefPtr MayaUsdProxyShapeBase::computeAsyncStagePlaceholder(
+    MDataBlock&              dataBlock,
+    const std::string&       fileString,
+    UsdStage::InitialLoadSet loadSet)
+{
+    MStatus    retValue;
+    const bool loadAsync = dataBlock.inputValue(loadStageAsyncAttr, &retValue).asBool();
+    if (!retValue || !loadAsync || fileString.empty()
+        || SdfLayer::IsAnonymousLayerIdentifier(fileString)) {
+        _asyncStageLoader.reset();
+        return nullptr;
+    }
+
+    MayaUsd::AsyncStageLoader::Request request;
+    request.filePath = fileString;
+    request.sessionLayer = computeSessionLayer(dataBlock);
+    request.loadSet = loadSet;
+
+    UsdStageCache& stageCache
+        = UsdMayaStageCache::Get(loadSet, UsdMayaStageCache::ShareMode::Shared);
+
+    if (_asyncStageLoader && _asyncStageLoader->request() == request) {
+        if (_asyncStageLoader->isLoading() || _asyncStageLoader->isCancelled()) {
+            return _asyncStageLoader->placeholder();
+        }
+
+        // The load is complete. Once in the stage cache, the loaded stage is
+        // found right away by UsdStage::Open. If the load failed, opening the
+        // stage again reports the errors.
+        if (UsdStageRefPtr stage = _asyncStageLoader->takeStage()) {
+            stageCache.Insert(stage);
+        }
+        _asyncStageLoader.reset();
+        return nullptr;
+    }
+    _asyncStageLoader.reset();
+
+    // There is nothing to wait for if the layers were saved in the Maya scene
+    // or if the stage is already open.
+    if (computeRootLayer(dataBlock, fileString)) {
+        return nullptr;
+    }
+    if (SdfLayerRefPtr rootLayer = SdfLayer::Find(fileString)) {
+        const bool isOpen = request.sessionLayer
+            ? bool(stageCache.FindOneMatching(rootLayer, request.sessionLayer))
+            : bool(stageCache.FindOneMatching(rootLayer));
+        if (isOpen) {
+            return nullptr;
+        }
+    }
+
+    _asyncStageLoader = std::make_unique<MayaUsd::AsyncStageLoader>(thisMObject(), request);
+    return _asyncStageLoader->placeholder();
+}
+
+bool MayaUsdProxyShapeBase::isStageLoading() const
+{
+    return _asyncStageLoader && _asyncStageLoader->isLoading();
+}
+
+void MayaUsdProxyShapeBase::cancelStageLoad()
+{
+    if (_asyncStageLoader) {
+        _asyncStageLoader->cancel();
+    }
+}
+
+bool MayaUsdProxyShapeBase::waitForStageLoad()
+{
+    if (!_asyncStageLoader) {
+        return true;
+    }
+    if (_asyncStageLoader->isCancelled()) {
+        return false;
+    }
+
+    _asyncStageLoader->wait();
+    return true;
+}
+
 UsdStageRefPtr MayaUsdProxyShapeBase::getUnsharedStage(UsdStage::InitialLoadSet loadSet)
 {
     // The unshared stages are *also* kept in a stage cache so that we can find them
@@ -41,6 +41,7 @@
 #include <ufe/ufe.h>
 
 #include <map>
+#include <memory>
 
 UFE_NS_DEF { class Path; }
 
@@ -53,6 +54,7 @@ UFE_NS_DEF { class Path; }
 #include <mayaUsd/utils/mayaNodeTypeObserver.h>
 
 namespace MAYAUSD_NS_DEF {
+class AsyncStageLoader;
 class LayerManager;
 }
 
@@ -156,6 +158,10 @@ public:
     MAYAUSD_CORE_PUBLIC
     static MObject recomputeLayersAttr;
 
+    // Open the stage of the file path on a worker thread.
+    MAYAUSD_CORE_PUBLIC
+    static MObject loadStageAsyncAttr;
+
     /// Delegate function for computing the closest point and surface normal
     /// on the proxy shape to a given ray.
     /// The input ray, output point, and output normal should be in the
@@ -335,6 +341,24 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool isIncomingLayer(const std::string& layerIdentifier) const;
 
+    /// Returns true while the stage is being loaded asynchronously, in which
+    /// case the stage of the proxy shape is an empty placeholder.
+    MAYAUSD_CORE_PUBLIC
+    bool isStageLoading() const;
+
+    /// Cancel the asynchronous load of the stage, if any. The proxy shape keeps
+    /// its placeholder stage until the file path changes or the stage is loaded
+    /// synchronously.
+    MAYAUSD_CORE_PUBLIC
+    void cancelStageLoad();
+
+    /// Block until the asynchronous load of the stage, if any, is complete. The
+    /// loaded stage is swapped in by the next evaluation of the stage. Returns
+    /// false if the load was cancelled, in which case the stage of the proxy
+    /// shape is still the placeholder.
+    MAYAUSD_CORE_PUBLIC
+    bool waitForStageLoad();
+
     /// Returns the observer for all proxy shapes instance.
     MAYAUSD_CORE_PUBLIC
     static MayaUsd::MayaNodeTypeObserver& getProxyShapesObserver();
@@ -428,6 +452,11 @@ private:
     MStatus computeOutStageData(MDataBlock& dataBlock);
     MStatus computeOutStageCacheId(MDataBlock& dataBlock);
 
+    UsdStageRefPtr computeAsyncStagePlaceholder(
+        MDataBlock&              dataBlock,
+        const std::string&       fileString,
+        UsdStage::InitialLoadSet loadSet);
+
     void updateShareMode(
         const UsdStageRefPtr&    sharedUsdStage,
         const UsdStageRefPtr&    unsharedUsdStage,
@@ -509,6 +538,9 @@ private:
 
     MCallbackId _preSaveCallbackId = 0;
 
+    // Asynchronous load of the stage, kept until the loaded stage is swapped in.
+    std::unique_ptr<MayaUsd::AsyncStageLoader> _asyncStageLoader;
+
 #ifdef WANT_ADSK_USD_EDIT_FORWARD_BUILD
     std::shared_ptr<AdskUsdEditForward::Forwarder> _forwarder;
 #endif
@@ -15,6 +15,7 @@
 //
 #include "proxyShapePlugin.h"
 
+#include <mayaUsd/nodes/asyncStageLoader.h>
 #include <mayaUsd/nodes/hdImagingShape.h>
 #include <mayaUsd/nodes/layerManager.h>
 #include <mayaUsd/nodes/pointBasedDeformerNode.h>
@@ -29,7 +30,9 @@
 #include <mayaUsd/render/pxrUsdMayaGL/proxyShapeUI.h>
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 #include <mayaUsd/render/vp2ShaderFragments/shaderFragments.h>
+#include <mayaUsd/utils/attributeReadAheadCache.h>
 #include <mayaUsd/utils/plugRegistryHelper.h>
+#include <mayaUsd/utils/progressivePayloadLoader.h>
 
 #include <pxr/base/tf/envSetting.h>
 
@@ -106,6 +109,9 @@ MStatus MayaUsdProxyShapePlugin::initialize(MFnPlugin& plugin)
         MPxNode::kDeformerNode);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
+    // The deformers read their animated points ahead of the playback.
+    UsdMayaAttributeReadAheadCache::GetInstance().Initialize();
+
     status = plugin.registerNode(
         MayaUsd::LayerManager::typeName,
         MayaUsd::LayerManager::typeId,
@@ -192,6 +198,11 @@ MStatus MayaUsdProxyShapePlugin::finalize(MFnPlugin& plugin)
         return MS::kSuccess;
     }
 
+    // The worker threads of asynchronous stage and payload loads run code of this plugin.
+    MayaUsd::AsyncStageLoader::waitForAll();
+    MayaUsd::cancelAllProgressivePayloadLoads();
+    UsdMayaAttributeReadAheadCache::GetInstance().Finalize();
+
     MStatus status = HdVP2ShaderFragments::deregisterFragments();
     CHECK_MSTATUS(status);
 
@@ -25,6 +25,7 @@ TF_WRAP_MODULE
 {
     TF_WRAP(SparseValueWriter);
     TF_WRAP(Adaptor);
+    TF_WRAP(AttributeReadAheadCache);
     TF_WRAP(BlockSceneModificationContext);
     TF_WRAP(ColorSpace);
     TF_WRAP(Converter);
@@ -34,6 +35,7 @@ TF_WRAP_MODULE
     TF_WRAP(LayerLocking);
     TF_WRAP(LoadRules);
     TF_WRAP(MeshWriteUtils);
+    TF_WRAP(NodeObserver);
 #ifdef UFE_V3_FEATURES_AVAILABLE
     TF_WRAP(PrimUpdater);
     TF_WRAP(PrimUpdaterArgs);
@@ -0,0 +1,66 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/utils/attributeReadAheadCache.h>
+
+#include <pxr/pxr.h>
+#include <pxr_python.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+UsdMayaAttributeReadAheadCache& _Cache() { return UsdMayaAttributeReadAheadCache::GetInstance(); }
+
+size_t _GetReadAheadCount() { return _Cache().GetReadAheadCount(); }
+void   _SetReadAheadCount(size_t count) { _Cache().SetReadAheadCount(count); }
+size_t _GetMemoryLimit() { return _Cache().GetMemoryLimit(); }
+void   _SetMemoryLimit(size_t bytes) { _Cache().SetMemoryLimit(bytes); }
+size_t _GetBytesResident() { return _Cache().GetBytesResident(); }
+size_t _GetHitCount() { return _Cache().GetHitCount(); }
+size_t _GetMissCount() { return _Cache().GetMissCount(); }
+double _GetHitRate() { return _Cache().GetHitRate(); }
+void   _ResetStatistics() { _Cache().ResetStatistics(); }
+void   _Clear() { _Cache().Clear(); }
+
+} // namespace
+
+void wrapAttributeReadAheadCache()
+{
+    PXR_BOOST_PYTHON_NAMESPACE::class_<
+        UsdMayaAttributeReadAheadCache,
+        PXR_BOOST_PYTHON_NAMESPACE::noncopyable>(
+        "AttributeReadAheadCache", PXR_BOOST_PYTHON_NAMESPACE::no_init)
+        .def("GetReadAheadCount", _GetReadAheadCount)
+        .staticmethod("GetReadAheadCount")
+        .def("SetReadAheadCount", _SetReadAheadCount)
+        .staticmethod("SetReadAheadCount")
+        .def("GetMemoryLimit", _GetMemoryLimit)
+        .staticmethod("GetMemoryLimit")
+        .def("SetMemoryLimit", _SetMemoryLimit)
+        .staticmethod("SetMemoryLimit")
+        .def("GetBytesResident", _GetBytesResident)
+        .staticmethod("GetBytesResident")
+        .def("GetHitCount", _GetHitCount)
+        .staticmethod("GetHitCount")
+        .def("GetMissCount", _GetMissCount)
+        .staticmethod("GetMissCount")
+        .def("GetHitRate", _GetHitRate)
+        .staticmethod("GetHitRate")
+        .def("ResetStatistics", _ResetStatistics)
+        .staticmethod("ResetStatistics")
+        .def("Clear", _Clear)
+        .staticmethod("Clear");
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 #include <mayaUsd/utils/loadRules.h>
+#include <mayaUsd/utils/progressivePayloadLoader.h>
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/base/tf/pyResultConversions.h>
@@ -45,10 +46,47 @@ bool isLoadingAll(const std::string& shapeName)
     return rules.IsLoadedWithAllDescendants(PXR_NS::SdfPath("/"));
 }
 
+bool loadPayloadsProgressively(
+    const std::string& shapeName,
+    const std::string& cameraName,
+    int                batchSize,
+    size_t             memoryLimitMB,
+    double             minScreenSize)
+{
+    MayaUsd::ProgressivePayloadLoadOptions options;
+    options.batchSize = batchSize;
+    options.memoryLimitMB = memoryLimitMB;
+    options.minScreenSize = minScreenSize;
+
+    return MayaUsd::loadPayloadsProgressively(
+        UsdMayaUtil::nameToDagPath(shapeName), UsdMayaUtil::nameToDagPath(cameraName), options);
+}
+
+bool isLoadingPayloadsProgressively(const std::string& shapeName)
+{
+    return MayaUsd::isLoadingPayloadsProgressively(UsdMayaUtil::nameToDagPath(shapeName));
+}
+
+void cancelProgressivePayloadLoad(const std::string& shapeName)
+{
+    MayaUsd::cancelProgressivePayloadLoad(UsdMayaUtil::nameToDagPath(shapeName));
+}
+
 } // namespace
 
 void wrapLoadRules()
 {
     def("setLoadRulesAttribute", setLoadRules);
     def("isLoadingAllPaylaods", isLoadingAll);
+
+    const MayaUsd::ProgressivePayloadLoadOptions defaultOptions;
+    def("loadPayloadsProgressively",
+        loadPayloadsProgressively,
+        (arg("shapeName"),
+         arg("cameraName"),
+         arg("batchSize") = defaultOptions.batchSize,
+         arg("memoryLimitMB") = defaultOptions.memoryLimitMB,
+         arg("minScreenSize") = defaultOptions.minScreenSize));
+    def("isLoadingPayloadsProgressively", isLoadingPayloadsProgressively);
+    def("cancelProgressivePayloadLoad", cancelProgressivePayloadLoad);
 }
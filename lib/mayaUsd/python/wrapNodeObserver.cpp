@@ -0,0 +1,104 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/utils/mayaNodeObserver.h>
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/base/tf/pyError.h>
+#include <pxr_python.h>
+
+#include <maya/MFnDependencyNode.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace PXR_BOOST_PYTHON_NAMESPACE;
+
+namespace {
+
+// Observes a Maya node and records the notifications received by its listener,
+// as (kind, node name) pairs, so that they can be verified from Python.
+class _PyNodeObserver : public MayaUsd::MayaNodeObserver::Listener
+{
+public:
+    explicit _PyNodeObserver(const std::string& nodeName)
+    {
+        MObject node;
+        if (!UsdMayaUtil::GetMObjectByName(nodeName, node)) {
+            PXR_NS::TfPyThrowValueError("Node not found: " + nodeName);
+        }
+
+        _observer.addListener(*this);
+        _observer.startObserving(node);
+    }
+
+    void stopObserving() { _observer.stopObserving(); }
+
+    list getNotifications() const
+    {
+        list notifications;
+        for (const auto& notification : _notifications)
+            notifications.append(make_tuple(notification.first, notification.second));
+        return notifications;
+    }
+
+    void clearNotifications() { _notifications.clear(); }
+
+    void processNodeRenamed(MObject& /*observedNode*/, const MString& oldName) override
+    {
+        _notifications.emplace_back("renamed", oldName.asChar());
+    }
+
+    void processParentAdded(MObject& /*observedNode*/, MDagPath& child, MDagPath& /*parent*/)
+        override
+    {
+        _notifications.emplace_back("parentAdded", nodeName(child.node()));
+    }
+
+    void processPlugDirty(
+        MObject& /*observedNode*/,
+        MObject& dirtiedNode,
+        MPlug& /*plug*/,
+        bool /*pathChanged*/) override
+    {
+        _notifications.emplace_back("plugDirty", nodeName(dirtiedNode));
+    }
+
+private:
+    static std::string nodeName(const MObject& node)
+    {
+        return MFnDependencyNode(node).name().asChar();
+    }
+
+    std::vector<std::pair<std::string, std::string>> _notifications;
+
+    // Note: declared last so that it stops observing before the notifications are destroyed.
+    MayaUsd::MayaNodeObserver _observer;
+};
+
+} // namespace
+
+void wrapNodeObserver()
+{
+    typedef _PyNodeObserver This;
+    class_<This, noncopyable>(
+        "NodeObserver",
+        "Observer of a Maya node recording the notifications of the node and its ancestors",
+        init<std::string>())
+        .def("stopObserving", &This::stopObserving)
+        .def("getNotifications", &This::getNotifications)
+        .def("clearNotifications", &This::clearNotifications);
+}
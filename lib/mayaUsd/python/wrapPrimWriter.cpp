@@ -521,6 +521,14 @@ void wrapJobExportArgs()
             "compatibility",
             make_getter(
                 &UsdMayaJobExportArgs::compatibility, return_value_policy<return_by_value>()))
+        .add_property(
+            "compactTimeSamples",
+            make_getter(
+                &UsdMayaJobExportArgs::compactTimeSamples, return_value_policy<return_by_value>()))
+        .def_readonly(
+            "compactTimeSamplesTolerance", &UsdMayaJobExportArgs::compactTimeSamplesTolerance)
+        .def_readonly(
+            "collapseConstantTimeSamples", &UsdMayaJobExportArgs::collapseConstantTimeSamples)
         .add_property(
             "convertMaterialsTo",
             make_getter(
@@ -653,6 +661,7 @@ void wrapJobExportArgs()
         .add_property(
             "shadingMode",
             make_getter(&UsdMayaJobExportArgs::shadingMode, return_value_policy<return_by_value>()))
+        .def_readonly("sparseBlendShapeTargets", &UsdMayaJobExportArgs::sparseBlendShapeTargets)
         .def_readonly("staticSingleSample", &UsdMayaJobExportArgs::staticSingleSample)
         .def_readonly("stripNamespaces", &UsdMayaJobExportArgs::stripNamespaces)
         .def_readonly("worldspace", &UsdMayaJobExportArgs::worldspace)
@@ -27,4 +27,7 @@ void wrapQuery()
 {
     def("GetPrim", UsdMayaQuery::GetPrim);
     def("ReloadStage", UsdMayaQuery::ReloadStage);
+    def("IsStageLoading", UsdMayaQuery::IsStageLoading);
+    def("CancelStageLoad", UsdMayaQuery::CancelStageLoad);
+    def("WaitForStageLoad", UsdMayaQuery::WaitForStageLoad);
 }
@@ -160,6 +160,13 @@ public:
     {
         return convert_index_pair(stack.FindOpIndexPair(opName));
     }
+
+    static object GetMatchingCacheStats()
+    {
+        const UsdMayaXformStack::MatchingCacheStats stats
+            = UsdMayaXformStack::GetMatchingCacheStats();
+        return PXR_BOOST_PYTHON_NAMESPACE::make_tuple(stats.hits, stats.misses);
+    }
 };
 } // namespace
 
@@ -204,7 +211,11 @@ void wrapXformStack()
         .def("MatrixStack", &UsdMayaXformStack::MatrixStack, return_value_policy<return_by_value>())
         .staticmethod("MatrixStack")
         .def("FirstMatchingSubstack", &UsdMayaXformStack::FirstMatchingSubstack)
-        .staticmethod("FirstMatchingSubstack");
+        .staticmethod("FirstMatchingSubstack")
+        .def("GetMatchingCacheStats", &_PyXformStack::GetMatchingCacheStats)
+        .staticmethod("GetMatchingCacheStats")
+        .def("ClearMatchingCache", &UsdMayaXformStack::ClearMatchingCache)
+        .staticmethod("ClearMatchingCache");
 
     PXR_BOOST_PYTHON_NAMESPACE::
         to_python_converter<UsdMayaXformStack::OpClassPair, _PyXformStack>();
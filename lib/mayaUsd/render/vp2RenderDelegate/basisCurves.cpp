@@ -21,6 +21,7 @@
 #include "drawItem.h"
 #include "instancer.h"
 #include "material.h"
+#include "primvarExpansion.h"
 #include "renderDelegate.h"
 #include "tokens.h"
 
@@ -130,217 +131,6 @@ VtArray<T> InterpolateVarying(
     return outputValues;
 }
 
-VtValue _BuildCubicIndexArray(const HdBasisCurvesTopology& topology)
-{
-    /*
-    Here's a diagram of what's happening in this code:
-
-    For open (non periodic, wrap = false) curves:
-
-      bezier (vStep = 3)
-      0------1------2------3------4------5------6 (vertex index)
-      [======= seg0 =======]
-                           [======= seg1 =======]
-
-
-      bspline / catmullRom (vStep = 1)
-      0------1------2------3------4------5------6 (vertex index)
-      [======= seg0 =======]
-             [======= seg1 =======]
-                    [======= seg2 =======]
-                           [======= seg3 =======]
-
-
-    For closed (periodic, wrap = true) curves:
-
-       periodic bezier (vStep = 3)
-       0------1------2------3------4------5------0 (vertex index)
-       [======= seg0 =======]
-                            [======= seg1 =======]
-
-
-       periodic bspline / catmullRom (vStep = 1)
-       0------1------2------3------4------5------0------1------2 (vertex index)
-       [======= seg0 =======]
-              [======= seg1 =======]
-                     [======= seg2 =======]
-                            [======= seg3 =======]
-                                   [======= seg4 =======]
-                                          [======= seg5 =======]
-    */
-    std::vector<GfVec4i> indices;
-
-    const VtArray<int> vertexCounts = topology.GetCurveVertexCounts();
-    bool               wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                vStep;
-    TfToken            basis = topology.GetCurveBasis();
-    if (basis == HdTokens->bezier) {
-        vStep = 3;
-    } else {
-        vStep = 1;
-    }
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int count = *itCounts;
-        // The first segment always eats up 4 verts, not just vstep, so to
-        // compensate, we break at count - 3.
-        int numSegs;
-
-        // If we're closing the curve, make sure that we have enough
-        // segments to wrap all the way back to the beginning.
-        if (wrap) {
-            numSegs = count / vStep;
-        } else {
-            numSegs = ((count - 4) / vStep) + 1;
-        }
-
-        for (int i = 0; i < numSegs; ++i) {
-
-            // Set up curve segments based on curve basis
-            GfVec4i seg;
-            int     offset = i * vStep;
-            for (int v = 0; v < 4; ++v) {
-                // If there are not enough verts to round out the segment
-                // just repeat the last vert.
-                seg[v] = wrap ? vertexIndex + ((offset + v) % count)
-                              : vertexIndex + std::min(offset + v, (count - 1));
-            }
-            indices.push_back(seg);
-        }
-        vertexIndex += count;
-    }
-
-    VtVec4iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec4i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-            int i2 = std::min(line[2], maxIndex);
-            int i3 = std::min(line[3], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-            int v2 = curveIndices[i2];
-            int v3 = curveIndices[i3];
-
-            finalIndices[lineNum].Set(v0, v1, v2, v3);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
-VtValue _BuildLinesIndexArray(const HdBasisCurvesTopology& topology)
-{
-    std::vector<GfVec2i> indices;
-    VtArray<int>         vertexCounts = topology.GetCurveVertexCounts();
-
-    int vertexIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        for (int i = 0; i < *itCounts; i += 2) {
-            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
-            vertexIndex += 2;
-        }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
-VtValue _BuildLineSegmentIndexArray(const HdBasisCurvesTopology& topology)
-{
-    const TfToken basis = topology.GetCurveBasis();
-    const bool    skipFirstAndLastSegs = (basis == HdTokens->catmullRom);
-
-    std::vector<GfVec2i> indices;
-    const VtArray<int>   vertexCounts = topology.GetCurveVertexCounts();
-    bool                 wrap = topology.GetCurveWrap() == HdTokens->periodic;
-    int                  vertexIndex = 0; // Index of next vertex to emit
-    // For each curve
-    TF_FOR_ALL(itCounts, vertexCounts)
-    {
-        int v0 = vertexIndex;
-        int v1;
-        // Store first vert index incase we are wrapping
-        const int firstVert = v0;
-        ++vertexIndex;
-        for (int i = 1; i < *itCounts; ++i) {
-            v1 = vertexIndex;
-            ++vertexIndex;
-            if (!skipFirstAndLastSegs || (i > 1 && i < (*itCounts) - 1)) {
-                indices.push_back(GfVec2i(v0, v1));
-            }
-            v0 = v1;
-        }
-        if (wrap) {
-            indices.push_back(GfVec2i(v0, firstVert));
-        }
-    }
-
-    VtVec2iArray      finalIndices(indices.size());
-    VtIntArray const& curveIndices = topology.GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty()) {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    } else {
-        size_t lineCount = indices.size();
-        int    maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum) {
-            const GfVec2i& line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
-        }
-    }
-
-    return VtValue(finalIndices);
-}
-
 template <typename BaseType>
 VtArray<BaseType> _BuildInterpolatedArray(
     const HdBasisCurvesTopology& topology,
@@ -350,19 +140,13 @@ VtArray<BaseType> _BuildInterpolatedArray(
     // We need to interpolate primvar depending on its type
     size_t numVerts = topology.CalculateNeededNumberOfControlPoints();
 
-    VtArray<BaseType> result(numVerts);
-    size_t            size = authoredData.size();
+    // Uniform or vertex data
+    VtArray<BaseType> result;
+    if (HdVP2ExpandPrimvar(numVerts, authoredData, &result)) {
+        return result;
+    }
 
-    if (size == 1) {
-        // Uniform data
-        const BaseType& elem = authoredData[0];
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = elem;
-        }
-    } else if (size == numVerts) {
-        // Vertex data
-        result = authoredData;
-    } else if (size == topology.CalculateNeededNumberOfVaryingControlPoints()) {
+    if (authoredData.size() == topology.CalculateNeededNumberOfVaryingControlPoints()) {
         // Varying data
         result = InterpolateVarying<BaseType>(
             numVerts,
@@ -372,9 +156,7 @@ VtArray<BaseType> _BuildInterpolatedArray(
             authoredData);
     } else {
         // Fallback
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = defaultValue;
-        }
+        result = VtArray<BaseType>(numVerts, defaultValue);
         TF_WARN("Incorrect number of primvar data, using default value for rendering.");
     }
 
@@ -567,25 +349,21 @@ void HdVP2BasisCurves::_UpdateDrawItem(
 
         const bool forceLines = (refineLevel <= 0) || (drawMode & MHWRender::MGeometry::kWireframe);
 
-        VtValue result;
-
-        if (!forceLines && type == HdTokens->cubic) {
-            result = _BuildCubicIndexArray(topology);
-        } else if (wrap == HdTokens->segmented) {
-            result = _BuildLinesIndexArray(topology);
-        } else {
-            result = _BuildLineSegmentIndexArray(topology);
-        }
-
+        VtVec4iArray cubicIndices;
+        VtVec2iArray lineIndices;
         const void*  indexData = nullptr;
         unsigned int numIndices = 0;
 
-        if (result.IsHolding<VtVec2iArray>()) {
-            indexData = result.UncheckedGet<VtVec2iArray>().cdata();
-            numIndices = result.GetArraySize() * 2;
-        } else if (result.IsHolding<VtVec4iArray>()) {
-            indexData = result.UncheckedGet<VtVec4iArray>().cdata();
-            numIndices = result.GetArraySize() * 4;
+        if (!forceLines && type == HdTokens->cubic) {
+            cubicIndices = HdVP2BuildCubicCurveIndices(topology);
+            indexData = cubicIndices.cdata();
+            numIndices = cubicIndices.size() * 4;
+        } else {
+            lineIndices = (wrap == HdTokens->segmented)
+                ? HdVP2BuildLinesCurveIndices(topology)
+                : HdVP2BuildLineSegmentCurveIndices(topology);
+            indexData = lineIndices.cdata();
+            numIndices = lineIndices.size() * 2;
         }
 
         if (drawItemData._indexBuffer && numIndices > 0) {
@@ -836,15 +614,7 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                     _curvesSharedData._colorBuffer->acquire(numVertices, true));
 
                 if (bufferData) {
-                    unsigned int offset = 0;
-                    for (size_t v = 0; v < numVertices; v++) {
-                        const GfVec3f& color = colorArray[v];
-                        bufferData[offset++] = color[0];
-                        bufferData[offset++] = color[1];
-                        bufferData[offset++] = color[2];
-
-                        bufferData[offset++] = alphaArray[v];
-                    }
+                    HdVP2FillColorAndOpacity(bufferData, numVertices, colorArray, alphaArray);
 
                     _CommitMVertexBuffer(_curvesSharedData._colorBuffer.get(), bufferData);
                 }
@@ -853,31 +623,14 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                     colorInterpolation == HdInterpolationInstance
                     || alphaInterpolation == HdInterpolationInstance);
 
-                if (alphaInterpolation == HdInterpolationConstant) {
-                    float alpha = alphaArray[0];
-                    for (unsigned int i = 1; i < colorArray.size(); i++)
-                        alphaArray.push_back(alpha);
-                }
-                if (colorInterpolation == HdInterpolationConstant) {
-                    GfVec3f color = colorArray[0];
-                    for (unsigned int i = 1; i < alphaArray.size(); i++)
-                        colorArray.push_back(color);
-                }
-
-                unsigned int numInstances = colorArray.size();
+                // Constant colors or opacities are broadcast to all instances.
+                const unsigned int numInstances = (colorInterpolation == HdInterpolationInstance)
+                    ? colorArray.size()
+                    : alphaArray.size();
                 stateToCommit._instanceColors->setLength(numInstances * kNumColorChannels);
-                float* bufferData = &(*stateToCommit._instanceColors)[0];
-
-                if (bufferData) {
-                    unsigned int offset = 0;
-                    for (size_t i = 0; i < numInstances; i++) {
-                        const GfVec3f& color = colorArray[i];
-                        bufferData[offset++] = color[0];
-                        bufferData[offset++] = color[1];
-                        bufferData[offset++] = color[2];
-
-                        bufferData[offset++] = alphaArray[i];
-                    }
+                if (numInstances > 0) {
+                    HdVP2FillColorAndOpacity(
+                        &(*stateToCommit._instanceColors)[0], numInstances, colorArray, alphaArray);
                 }
             }
         }
@@ -936,39 +689,16 @@ void HdVP2BasisCurves::_UpdateDrawItem(
                 const size_t authoredColorIndex = sizeof(colors) / sizeof(MColor);
                 colorIndices.resize(instanceCount, hasAuthoredColor ? authoredColorIndex : 0);
 
-                // Assign with the index to the active selection highlight color.
-                if (auto state = drawScene.GetActiveSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            colorIndices[index] = 1;
-                        }
-                    }
-                }
-
-                // Assign with the index to the lead selection highlight color.
-                if (auto state = drawScene.GetLeadSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            colorIndices[index] = 2;
-                        }
-                    }
-                }
+                // Assign with the index to the active, then lead, selection highlight color.
+                HdVP2MarkSelectedInstances<unsigned char>(
+                    colorIndices, drawScene.GetActiveSelectionState(id), 1);
+                HdVP2MarkSelectedInstances<unsigned char>(
+                    colorIndices, drawScene.GetLeadSelectionState(id), 2);
 
                 // Fill per-instance colors.
                 stateToCommit._instanceColors->setLength(instanceCount * kNumColorChannels);
-                unsigned int offset = 0;
-
-                for (unsigned int i = 0; i < instanceCount; ++i) {
-                    unsigned char colorIndex = colorIndices[i];
-                    if (colorIndex == authoredColorIndex) {
-                        offset += kNumColorChannels;
-                        continue;
-                    }
-                    const MColor& color = colors[colorIndex];
-                    for (unsigned int j = 0; j < kNumColorChannels; j++) {
-                        (*stateToCommit._instanceColors)[offset++] = color[j];
-                    }
-                }
+                HdVP2FillInstanceColors(
+                    &(*stateToCommit._instanceColors)[0], colorIndices, colors, authoredColorIndex);
             }
         }
     } else {
@@ -25,12 +25,26 @@
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 
 #include <algorithm>
+#include <atomic>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+namespace {
+
+//! Returns a new version for the transforms cached by the instancers.
+size_t _NextTransformsVersion()
+{
+    static std::atomic<size_t> version { 0 };
+    return ++version;
+}
+
+} // namespace
+
 /*! \brief  Constructor.
 
     \param delegate     The scene delegate backing this instancer's data.
@@ -74,6 +88,23 @@ void HdVP2Instancer::Sync(
 
     SdfPath const& id = GetId();
 
+#if HD_API_VERSION < 56
+    TfToken translationsToken = HdInstancerTokens->translate;
+    TfToken rotationsToken = HdInstancerTokens->rotate;
+    TfToken scalesToken = HdInstancerTokens->scale;
+    TfToken transformsToken = HdInstancerTokens->instanceTransform;
+#else
+    TfToken translationsToken = HdInstancerTokens->instanceTranslations;
+    TfToken rotationsToken = HdInstancerTokens->instanceRotations;
+    TfToken scalesToken = HdInstancerTokens->instanceScales;
+    TfToken transformsToken = HdInstancerTokens->instanceTransforms;
+#endif
+
+    // Note: the instance transform primvars have no dirty bits of their own, unlike points or
+    //       normals, so their values are compared to find whether any of them changed. Other
+    //       primvars, like colors, then do not invalidate the cached transforms.
+    bool transformPrimvarsChanged = false;
+
     if (HdChangeTracker::IsAnyPrimvarDirty(*dirtyBits, id)) {
         // If this instancer has dirty primvars, get the list of
         // primvar names and then cache each one.
@@ -85,6 +116,14 @@ void HdVP2Instancer::Sync(
             if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, pv.name)) {
                 VtValue value = GetDelegate()->Get(id, pv.name);
                 if (!value.IsEmpty()) {
+                    if (pv.name == translationsToken || pv.name == rotationsToken
+                        || pv.name == scalesToken || pv.name == transformsToken) {
+                        VtValue& previousValue = _transformPrimvarValues[pv.name];
+                        if (previousValue != value) {
+                            previousValue = value;
+                            transformPrimvarsChanged = true;
+                        }
+                    }
                     _primvarMap[pv.name] = std::make_unique<HdVtBufferSource>(pv.name, value);
                 }
             }
@@ -105,11 +144,21 @@ void HdVP2Instancer::Sync(
                 _instanceIndicesByPrototype[prototypeId] = std::move(instanceIndices);
             }
         }
+
+        // Forget the flattened transforms of the prototypes which are gone.
+        std::lock_guard<std::mutex> lock(_flattenedTransformsMutex);
+        for (auto it = _flattenedTransformsByPrototype.begin();
+             it != _flattenedTransformsByPrototype.end();) {
+            if (_instanceIndicesByPrototype.count(it->first) == 0) {
+                it = _flattenedTransformsByPrototype.erase(it);
+            } else {
+                ++it;
+            }
+        }
     }
 
     bool updateInstanceTransforms = (*dirtyBits & HdChangeTracker::DirtyTransform)
-        || HdChangeTracker::IsAnyPrimvarDirty(*dirtyBits, id)
-        || (*dirtyBits & HdChangeTracker::DirtyInstanceIndex);
+        || (*dirtyBits & HdChangeTracker::DirtyInstanceIndex) || transformPrimvarsChanged;
     if (updateInstanceTransforms) {
         // Initialize all transforms to the instancer's transform, on which we later
         // apply the individual instances' transformations.
@@ -124,18 +173,7 @@ void HdVP2Instancer::Sync(
         // If any transform isn't provided, it's assumed to be the identity.
         GfMatrix4d instancerTransform = GetDelegate()->GetInstancerTransform(id);
         _instanceTransforms = VtMatrix4dArray(_maxInstanceIndex + 1, instancerTransform);
-
-#if HD_API_VERSION < 56
-        TfToken translationsToken = HdInstancerTokens->translate;
-        TfToken rotationsToken = HdInstancerTokens->rotate;
-        TfToken scalesToken = HdInstancerTokens->scale;
-        TfToken transformsToken = HdInstancerTokens->instanceTransform;
-#else
-        TfToken translationsToken = HdInstancerTokens->instanceTranslations;
-        TfToken rotationsToken = HdInstancerTokens->instanceRotations;
-        TfToken scalesToken = HdInstancerTokens->instanceScales;
-        TfToken transformsToken = HdInstancerTokens->instanceTransforms;
-#endif
+        _instanceTransformsVersion = _NextTransformsVersion();
 
         // Translations
         if (_primvarMap.count(translationsToken) > 0) {
@@ -218,43 +256,181 @@ VtMatrix4dArray HdVP2Instancer::GetInstanceTransforms(SdfPath const& prototypeId
 
     HdInstancer::_SyncInstancerAndParents(GetDelegate()->GetRenderIndex(), GetId());
 
+    size_t version = 0;
+    return _GetFlattenedTransforms(prototypeId, &version);
+}
+
+/*! \brief  Retrieves the cached flattened transforms of the provided prototype id,
+            updating them if the instancer or its parents changed since last time.
+
+    The transforms taking nesting into account are computed by:
+    parentTransforms = parentInstancer->_GetFlattenedTransforms(GetId())
+    foreach (parentXf : parentTransforms, xf : transforms) {
+        parentXf * xf
+    }
+    When only some of the transforms changed, only the flattened transforms
+    depending on them are recomputed.
+
+    \param prototypeId The prototype to get transforms for.
+    \param version     Set to the version of the returned transforms, which
+                       only changes when the transforms do.
+
+    \return One transform per instance, to apply when drawing.
+*/
+VtMatrix4dArray
+HdVP2Instancer::_GetFlattenedTransforms(SdfPath const& prototypeId, size_t* version)
+{
+    HD_TRACE_FUNCTION();
+
+    *version = 0;
+
     // Get the instance indices from our cache instead of querying the scene delegate.
     auto itInstanceIndices = _instanceIndicesByPrototype.find(prototypeId);
     if (itInstanceIndices == _instanceIndicesByPrototype.end()) {
         return {};
     }
+    const VtIntArray& instanceIndices = itInstanceIndices->second;
+
+    bool            nested = false;
+    VtMatrix4dArray parentTransforms;
+    size_t          parentVersion = 0;
+    if (!GetParentId().IsEmpty()) {
+        HdInstancer* parentInstancer = GetDelegate()->GetRenderIndex().GetInstancer(GetParentId());
+        if (TF_VERIFY(parentInstancer)) {
+            nested = true;
+            parentTransforms = static_cast<HdVP2Instancer*>(parentInstancer)
+                                   ->_GetFlattenedTransforms(GetId(), &parentVersion);
+        }
+    }
 
-    // Retrieve only the instance transforms relevant to this prototype
-    auto            instanceIndices = itInstanceIndices->second;
-    VtMatrix4dArray transforms(instanceIndices.size());
-    for (size_t i = 0; i < instanceIndices.size(); i++) {
-        transforms[i] = _instanceTransforms[instanceIndices[i]];
+    _FlattenedTransforms cache;
+    {
+        std::lock_guard<std::mutex> lock(_flattenedTransformsMutex);
+
+        _FlattenedTransforms& cached = _flattenedTransformsByPrototype[prototypeId];
+        if (cached.version != 0 && cached.instanceTransformsVersion == _instanceTransformsVersion
+            && cached.parentTransformsVersion == parentVersion) {
+            *version = cached.version;
+            return cached.flattenedTransforms;
+        }
+
+        // The update runs in parallel, and the worker threads could pick up the
+        // sync of another prototype of this instancer while waiting for it, so
+        // it is done outside of the lock. Should another thread update the same
+        // prototype meanwhile, it will find an empty cache and recompute it all.
+        cache = std::move(cached);
+        cached = _FlattenedTransforms();
     }
 
-    if (GetParentId().IsEmpty()) {
-        return transforms;
+    const size_t nbInstances = instanceIndices.size();
+    const size_t nbParents = nested ? parentTransforms.size() : 1;
+    bool         updateAll = (cache.version == 0);
+
+    // Retrieve only the instance transforms relevant to this prototype, and
+    // flag the ones that changed. Without nesting, they are the final transforms.
+    VtMatrix4dArray& transforms = nested ? cache.instanceTransforms : cache.flattenedTransforms;
+    if (transforms.size() != nbInstances) {
+        transforms.resize(nbInstances);
+        updateAll = true;
     }
 
-    HdInstancer* parentInstancer = GetDelegate()->GetRenderIndex().GetInstancer(GetParentId());
-    if (!TF_VERIFY(parentInstancer)) {
-        return transforms;
+    std::vector<char> instanceChanged(updateAll ? 0 : nbInstances, 0);
+    bool              anyInstanceChanged = false;
+    if (updateAll || cache.instanceTransformsVersion != _instanceTransformsVersion) {
+        const GfMatrix4d* source = _instanceTransforms.cdata();
+        const int*        indices = instanceIndices.cdata();
+        if (!updateAll) {
+            // Compare before writing: the transforms returned by the previous
+            // call share their buffer with the cache, so writing to it copies
+            // the whole array, even if nothing changed.
+            const GfMatrix4d* previous = transforms.cdata();
+            WorkParallelForN(nbInstances, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    instanceChanged[i] = (previous[i] != source[indices[i]]);
+                }
+            });
+            anyInstanceChanged = std::find(instanceChanged.begin(), instanceChanged.end(), 1)
+                != instanceChanged.end();
+        }
+
+        if (updateAll || anyInstanceChanged) {
+            GfMatrix4d* target = transforms.data();
+            WorkParallelForN(nbInstances, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (updateAll || instanceChanged[i]) {
+                        target[i] = source[indices[i]];
+                    }
+                }
+            });
+        }
+        anyInstanceChanged = anyInstanceChanged || updateAll;
     }
 
-    // The transforms taking nesting into account are computed by:
-    // parentTransforms = parentInstancer->GetInstanceTransforms(GetId())
-    // foreach (parentXf : parentTransforms, xf : transforms) {
-    //     parentXf * xf
-    // }
-    VtMatrix4dArray parentTransforms
-        = static_cast<HdVP2Instancer*>(parentInstancer)->GetInstanceTransforms(GetId());
-
-    VtMatrix4dArray final(parentTransforms.size() * transforms.size());
-    for (size_t i = 0; i < parentTransforms.size(); ++i) {
-        for (size_t j = 0; j < transforms.size(); ++j) {
-            final[i * transforms.size() + j] = transforms[j] * parentTransforms[i];
+    bool changed = anyInstanceChanged;
+    if (nested) {
+        // Flag the parent transforms that changed.
+        if (cache.parentTransforms.size() != nbParents) {
+            updateAll = true;
         }
+
+        std::vector<char> parentChanged(updateAll ? 0 : nbParents, 0);
+        bool              anyParentChanged = updateAll;
+        if (!updateAll && cache.parentTransformsVersion != parentVersion) {
+            const GfMatrix4d* previous = cache.parentTransforms.cdata();
+            const GfMatrix4d* current = parentTransforms.cdata();
+            WorkParallelForN(nbParents, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    parentChanged[i] = (previous[i] != current[i]);
+                }
+            });
+            anyParentChanged = std::find(parentChanged.begin(), parentChanged.end(), 1)
+                != parentChanged.end();
+        }
+
+        // Compose the cartesian product, skipping the flattened transforms
+        // for which neither the parent nor the instance transform changed.
+        const size_t nbFlattened = nbParents * nbInstances;
+        if (cache.flattenedTransforms.size() != nbFlattened) {
+            cache.flattenedTransforms.resize(nbFlattened);
+            updateAll = true;
+        }
+
+        changed = updateAll || anyInstanceChanged || anyParentChanged;
+        if (changed && nbFlattened > 0) {
+            const GfMatrix4d* parents = parentTransforms.cdata();
+            const GfMatrix4d* instances = cache.instanceTransforms.cdata();
+            GfMatrix4d*       flattened = cache.flattenedTransforms.data();
+            WorkParallelForN(nbFlattened, [&](size_t begin, size_t end) {
+                size_t i = begin / nbInstances;
+                size_t j = begin % nbInstances;
+                for (size_t k = begin; k < end; ++k) {
+                    if (updateAll || parentChanged[i] || instanceChanged[j]) {
+                        flattened[k] = instances[j] * parents[i];
+                    }
+                    if (++j == nbInstances) {
+                        j = 0;
+                        ++i;
+                    }
+                }
+            });
+        }
+
+        cache.parentTransforms = parentTransforms;
+    }
+
+    cache.instanceTransformsVersion = _instanceTransformsVersion;
+    cache.parentTransformsVersion = parentVersion;
+    if (changed || cache.version == 0) {
+        cache.version = _NextTransformsVersion();
+    }
+    *version = cache.version;
+
+    VtMatrix4dArray flattenedTransforms = cache.flattenedTransforms;
+    {
+        std::lock_guard<std::mutex> lock(_flattenedTransformsMutex);
+        _flattenedTransformsByPrototype[prototypeId] = std::move(cache);
     }
-    return final;
+    return flattenedTransforms;
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -18,11 +18,14 @@
 #ifndef HD_VP2_INSTANCER
 #define HD_VP2_INSTANCER
 
+#include <mayaUsd/base/api.h>
+
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/hashmap.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
 #include <pxr/base/vt/types.h>
+#include <pxr/base/vt/value.h>
 #include <pxr/imaging/hd/instancer.h>
 #include <pxr/imaging/hd/vtBufferSource.h>
 #include <pxr/pxr.h>
@@ -38,8 +41,13 @@ PXR_NAMESPACE_OPEN_SCOPE
     Nested instancing can be handled by recursion, and by taking the
     cartesian product of the transform arrays at each nesting level, to
     create a flattened transform array.
+
+    The flattened transform arrays are cached per prototype, and only the
+    instances whose transforms changed are recomputed. The array returned for
+    a prototype keeps sharing its buffer with the cache until its transforms
+    change.
 */
-class HdVP2Instancer final : public HdInstancer
+class MAYAUSD_CORE_PUBLIC HdVP2Instancer final : public HdInstancer
 {
 public:
 #if defined(HD_API_VERSION) && HD_API_VERSION >= 36
@@ -56,6 +64,8 @@ public:
     VtMatrix4dArray GetInstanceTransforms(SdfPath const& prototypeId);
 
 private:
+    VtMatrix4dArray _GetFlattenedTransforms(SdfPath const& prototypeId, size_t* version);
+
     /*! Map of the latest primvar data for this instancer, keyed by
         primvar name. Primvar values are VtValue, an any-type; they are
         interpreted at consumption time (here, in ComputeInstanceTransforms).
@@ -63,6 +73,9 @@ private:
     std::unordered_map<TfToken, std::unique_ptr<HdVtBufferSource>, TfToken::HashFunctor>
         _primvarMap;
 
+    // Last values of the instance transform primvars, to find whether they changed.
+    std::unordered_map<TfToken, VtValue, TfToken::HashFunctor> _transformPrimvarValues;
+
     // Cache the instance indices to avoid having the scene delegate recompute
     // them every time
     int                                           _maxInstanceIndex = -1;
@@ -70,6 +83,24 @@ private:
 
     // Instance transforms cache
     VtMatrix4dArray _instanceTransforms;
+    size_t          _instanceTransformsVersion = 0;
+
+    /*! Transforms of the instances of a prototype, flattened with the
+        transforms of the parent instancers. The transforms they were computed
+        from are kept to find which instances changed when they are updated.
+        Versions are unique across all instancers, zero meaning not computed.
+    */
+    struct _FlattenedTransforms
+    {
+        VtMatrix4dArray instanceTransforms; // Only kept for nested instancers
+        VtMatrix4dArray parentTransforms;
+        VtMatrix4dArray flattenedTransforms;
+        size_t          instanceTransformsVersion = 0;
+        size_t          parentTransformsVersion = 0;
+        size_t          version = 0;
+    };
+    std::mutex                                              _flattenedTransformsMutex;
+    TfHashMap<SdfPath, _FlattenedTransforms, SdfPath::Hash> _flattenedTransformsByPrototype;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -19,6 +19,7 @@
 #include "debugCodes.h"
 #include "instancer.h"
 #include "material.h"
+#include "primvarExpansion.h"
 #include "renderDelegate.h"
 #include "tokens.h"
 
@@ -525,35 +526,30 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
             size_t     numInstances = instanceIndices.size();
             colorAndOpacityInfo->_extraInstanceData.setLength(
                 numInstances * kNumColorChannels); // the data is a vec4
-            void* bufferData = &colorAndOpacityInfo->_extraInstanceData[0];
             colorAndOpacityInfo->_source.interpolation = HdInterpolationInstance;
 
-            size_t alphaChannelOffset = 3;
-            for (size_t instance = 0; instance < numInstances; instance++) {
-                int      index = instanceIndices[instance];
-                GfVec3f* color = reinterpret_cast<GfVec3f*>(
-                    reinterpret_cast<float*>(&static_cast<GfVec4f*>(bufferData)[instance]));
-                float* alpha
-                    = reinterpret_cast<float*>(&static_cast<GfVec4f*>(bufferData)[instance])
-                    + alphaChannelOffset;
-
-                if (colorInterp == HdInterpolationInstance) {
-                    *color = colorArray[index];
-                } else if (colorInterp == HdInterpolationConstant) {
-                    *color = colorArray[0];
-                } else {
+            // Data which is not per instance is broadcast to all instances.
+            if (colorInterp != HdInterpolationInstance) {
+                if (colorInterp != HdInterpolationConstant) {
                     TF_WARN("Unsupported combination of display color interpolation and display "
                             "opacity interpolation instance.");
                 }
-
-                if (alphaInterp == HdInterpolationInstance) {
-                    *alpha = alphaArray[index];
-                } else if (alphaInterp == HdInterpolationConstant) {
-                    *alpha = alphaArray[0];
-                } else {
+                colorArray = VtVec3fArray(1, colorArray.empty() ? GfVec3f(0.0f) : colorArray[0]);
+            }
+            if (alphaInterp != HdInterpolationInstance) {
+                if (alphaInterp != HdInterpolationConstant) {
                     TF_WARN("Unsupported combination of display color interpolation instance and "
                             "display opacity interpolation.");
                 }
+                alphaArray = VtFloatArray(1, alphaArray.empty() ? 1.0f : alphaArray[0]);
+            }
+
+            if (numInstances > 0) {
+                HdVP2FillInstanceColorAndOpacity(
+                    &colorAndOpacityInfo->_extraInstanceData[0],
+                    instanceIndices,
+                    colorArray,
+                    alphaArray);
             }
         } else {
             if (!colorAndOpacityInfo->_buffer) {
@@ -1950,31 +1946,13 @@ void HdVP2Mesh::_UpdateDrawItem(
             // when _selectionStatus is kPartiallySelected. If the object is fully lead or active
             // then we already have the correct values in instanceInfo.
             if (_selectionStatus == kPartiallySelected) {
-                // Assign with the index to the active selection highlight color.
-                if (const auto state = drawScene.GetActiveSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            // This bounds check is necessary because of Pixar USD Issue 1516
-                            // Logged as MAYA-113682
-                            if (index >= 0 && index < (const int)instanceCount) {
-                                instanceInfo[index] = modeActive;
-                            }
-                        }
-                    }
-                }
-
-                // Assign with the index to the lead selection highlight color.
-                if (const auto state = drawScene.GetLeadSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            // This bounds check is necessary because of Pixar USD Issue 1516
-                            // Logged as MAYA-113682
-                            if (index >= 0 && index < (const int)instanceCount) {
-                                instanceInfo[index] = modeLead;
-                            }
-                        }
-                    }
-                }
+                // Assign with the index to the active, then lead, selection highlight color.
+                // Out of range indices are skipped because of Pixar USD Issue 1516, logged as
+                // MAYA-113682.
+                HdVP2MarkSelectedInstances(
+                    instanceInfo, drawScene.GetActiveSelectionState(id), modeActive);
+                HdVP2MarkSelectedInstances(
+                    instanceInfo, drawScene.GetLeadSelectionState(id), modeLead);
             }
 
             // Now instanceInfo is set up correctly to tell us which instances are a part of this
@@ -62,23 +62,11 @@ VtArray<BaseType> _BuildInterpolatedArray(
     const VtArray<BaseType>& authoredData,
     const BaseType&          defaultValue)
 {
-    VtArray<BaseType> result(numVerts);
-    size_t            size = authoredData.size();
-
-    if (size == 1) {
-        // Uniform data
-        const BaseType& elem = authoredData[0];
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = elem;
-        }
-    } else if (size == numVerts) {
-        // Vertex data
-        result = authoredData;
-    } else {
+    // Uniform or vertex data
+    VtArray<BaseType> result;
+    if (!HdVP2ExpandPrimvar(numVerts, authoredData, &result)) {
         // Fallback
-        for (size_t i = 0; i < numVerts; ++i) {
-            result[i] = defaultValue;
-        }
+        result = VtArray<BaseType>(numVerts, defaultValue);
         TF_WARN("Incorrect number of primvar data, using default value for rendering.");
     }
 
@@ -533,15 +521,7 @@ void HdVP2Points::_UpdateDrawItem(
                     _pointsSharedData._colorBuffer->acquire(numVertices, true));
 
                 if (bufferData) {
-                    unsigned int offset = 0;
-                    for (size_t v = 0; v < numVertices; v++) {
-                        const GfVec3f& color = colorArray[v];
-                        bufferData[offset++] = color[0];
-                        bufferData[offset++] = color[1];
-                        bufferData[offset++] = color[2];
-
-                        bufferData[offset++] = alphaArray[v];
-                    }
+                    HdVP2FillColorAndOpacity(bufferData, numVertices, colorArray, alphaArray);
 
                     _CommitMVertexBuffer(_pointsSharedData._colorBuffer.get(), bufferData);
                 }
@@ -550,31 +530,14 @@ void HdVP2Points::_UpdateDrawItem(
                     colorInterpolation == HdInterpolationInstance
                     || alphaInterpolation == HdInterpolationInstance);
 
-                if (alphaInterpolation == HdInterpolationConstant) {
-                    float alpha = alphaArray[0];
-                    for (unsigned int i = 1; i < colorArray.size(); i++)
-                        alphaArray.push_back(alpha);
-                }
-                if (colorInterpolation == HdInterpolationConstant) {
-                    GfVec3f color = colorArray[0];
-                    for (unsigned int i = 1; i < alphaArray.size(); i++)
-                        colorArray.push_back(color);
-                }
-
-                unsigned int numInstances = colorArray.size();
+                // Constant colors or opacities are broadcast to all instances.
+                const unsigned int numInstances = (colorInterpolation == HdInterpolationInstance)
+                    ? colorArray.size()
+                    : alphaArray.size();
                 stateToCommit._instanceColors->setLength(numInstances * kNumColorChannels);
-                float* bufferData = &(*stateToCommit._instanceColors)[0];
-
-                if (bufferData) {
-                    unsigned int offset = 0;
-                    for (size_t i = 0; i < numInstances; i++) {
-                        const GfVec3f& color = colorArray[i];
-                        bufferData[offset++] = color[0];
-                        bufferData[offset++] = color[1];
-                        bufferData[offset++] = color[2];
-
-                        bufferData[offset++] = alphaArray[i];
-                    }
+                if (numInstances > 0) {
+                    HdVP2FillColorAndOpacity(
+                        &(*stateToCommit._instanceColors)[0], numInstances, colorArray, alphaArray);
                 }
             }
         }
@@ -633,39 +596,16 @@ void HdVP2Points::_UpdateDrawItem(
                 const size_t authoredColorIndex = sizeof(colors) / sizeof(MColor);
                 colorIndices.resize(instanceCount, hasAuthoredColor ? authoredColorIndex : 0);
 
-                // Assign with the index to the active selection highlight color.
-                if (auto state = drawScene.GetActiveSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            colorIndices[index] = 1;
-                        }
-                    }
-                }
-
-                // Assign with the index to the lead selection highlight color.
-                if (auto state = drawScene.GetLeadSelectionState(id)) {
-                    for (const auto& indexArray : state->instanceIndices) {
-                        for (const auto index : indexArray) {
-                            colorIndices[index] = 2;
-                        }
-                    }
-                }
+                // Assign with the index to the active, then lead, selection highlight color.
+                HdVP2MarkSelectedInstances<unsigned char>(
+                    colorIndices, drawScene.GetActiveSelectionState(id), 1);
+                HdVP2MarkSelectedInstances<unsigned char>(
+                    colorIndices, drawScene.GetLeadSelectionState(id), 2);
 
                 // Fill per-instance colors.
                 stateToCommit._instanceColors->setLength(instanceCount * kNumColorChannels);
-                unsigned int offset = 0;
-
-                for (unsigned int i = 0; i < instanceCount; ++i) {
-                    unsigned char colorIndex = colorIndices[i];
-                    if (colorIndex == authoredColorIndex) {
-                        offset += kNumColorChannels;
-                        continue;
-                    }
-                    const MColor& color = colors[colorIndex];
-                    for (unsigned int j = 0; j < kNumColorChannels; j++) {
-                        (*stateToCommit._instanceColors)[offset++] = color[j];
-                    }
-                }
+                HdVP2FillInstanceColors(
+                    &(*stateToCommit._instanceColors)[0], colorIndices, colors, authoredColorIndex);
             }
         }
     } else {
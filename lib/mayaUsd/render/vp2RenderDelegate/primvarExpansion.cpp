@@ -0,0 +1,319 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "primvarExpansion.h"
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/imaging/hd/tokens.h>
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Below these counts, splitting the work across threads costs more than it saves.
+constexpr size_t kMinElementsPerTask = 16384;
+constexpr size_t kMinCurvesPerTask = 1024;
+
+//! Maps generated vertex indices through the curve indices of a topology, if it has any.
+class _CurveIndexMapper
+{
+public:
+    explicit _CurveIndexMapper(const HdBasisCurvesTopology& topology)
+        : _curveIndices(topology.GetCurveIndices())
+        , _maxIndex(static_cast<int>(_curveIndices.size()) - 1)
+    {
+    }
+
+    int operator()(int index) const
+    {
+        return _curveIndices.empty() ? index : _curveIndices.cdata()[std::min(index, _maxIndex)];
+    }
+
+private:
+    const VtIntArray _curveIndices;
+    const int        _maxIndex;
+};
+
+//! Fill the float4 color of element \p i with color \p colorIndex and opacity \p opacityIndex.
+inline void _FillColor(
+    float*         rgba,
+    size_t         i,
+    const GfVec3f* colors,
+    size_t         colorIndex,
+    const float*   opacities,
+    size_t         opacityIndex)
+{
+    float*         out = rgba + i * 4;
+    const GfVec3f& color = colors[colorIndex];
+    out[0] = color[0];
+    out[1] = color[1];
+    out[2] = color[2];
+    out[3] = opacities[opacityIndex];
+}
+
+} // namespace
+
+void HdVP2FillColorAndOpacity(
+    float*              rgba,
+    size_t              count,
+    const VtVec3fArray& colors,
+    const VtFloatArray& opacities)
+{
+    if (!TF_VERIFY(rgba && !colors.empty() && !opacities.empty())) {
+        return;
+    }
+
+    const GfVec3f* colorData = colors.cdata();
+    const float*   opacityData = opacities.cdata();
+    const size_t   colorStride = colors.size() == 1 ? 0 : 1;
+    const size_t   opacityStride = opacities.size() == 1 ? 0 : 1;
+
+    WorkParallelForN(
+        count,
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                _FillColor(rgba, i, colorData, i * colorStride, opacityData, i * opacityStride);
+            }
+        },
+        kMinElementsPerTask);
+}
+
+void HdVP2FillInstanceColorAndOpacity(
+    float*              rgba,
+    const VtIntArray&   instanceIndices,
+    const VtVec3fArray& colors,
+    const VtFloatArray& opacities)
+{
+    if (!TF_VERIFY(rgba && !colors.empty() && !opacities.empty())) {
+        return;
+    }
+
+    const int*     indices = instanceIndices.cdata();
+    const GfVec3f* colorData = colors.cdata();
+    const float*   opacityData = opacities.cdata();
+    const bool     constantColor = colors.size() == 1;
+    const bool     constantOpacity = opacities.size() == 1;
+
+    WorkParallelForN(
+        instanceIndices.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const size_t index = static_cast<size_t>(indices[i]);
+                _FillColor(
+                    rgba,
+                    i,
+                    colorData,
+                    constantColor ? 0 : index,
+                    opacityData,
+                    constantOpacity ? 0 : index);
+            }
+        },
+        kMinElementsPerTask);
+}
+
+void HdVP2FillInstanceColors(
+    float*                            rgba,
+    const std::vector<unsigned char>& colorIndices,
+    const MColor*                     colors,
+    size_t                            numColors)
+{
+    const size_t count = colorIndices.size();
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned char colorIndex = colorIndices[i];
+        if (colorIndex >= numColors) {
+            continue;
+        }
+
+        const MColor& color = colors[colorIndex];
+        float*        out = rgba + i * 4;
+        out[0] = color.r;
+        out[1] = color.g;
+        out[2] = color.b;
+        out[3] = color.a;
+    }
+}
+
+VtVec4iArray HdVP2BuildCubicCurveIndices(const HdBasisCurvesTopology& topology)
+{
+    /*
+    Here's a diagram of what's happening in this code:
+
+    For open (non periodic, wrap = false) curves:
+
+      bezier (vStep = 3)
+      0------1------2------3------4------5------6 (vertex index)
+      [======= seg0 =======]
+                           [======= seg1 =======]
+
+
+      bspline / catmullRom (vStep = 1)
+      0------1------2------3------4------5------6 (vertex index)
+      [======= seg0 =======]
+             [======= seg1 =======]
+                    [======= seg2 =======]
+                           [======= seg3 =======]
+
+
+    For closed (periodic, wrap = true) curves:
+
+       periodic bezier (vStep = 3)
+       0------1------2------3------4------5------0 (vertex index)
+       [======= seg0 =======]
+                            [======= seg1 =======]
+
+
+       periodic bspline / catmullRom (vStep = 1)
+       0------1------2------3------4------5------0------1------2 (vertex index)
+       [======= seg0 =======]
+              [======= seg1 =======]
+                     [======= seg2 =======]
+                            [======= seg3 =======]
+                                   [======= seg4 =======]
+                                          [======= seg5 =======]
+    */
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+    const bool        wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const int         vStep = (topology.GetCurveBasis() == HdTokens->bezier) ? 3 : 1;
+
+    // Find where the vertices and segments of each curve start, so that the
+    // curves can be filled in parallel.
+    const size_t        numCurves = vertexCounts.size();
+    std::vector<int>    firstVertices(numCurves);
+    std::vector<size_t> firstSegments(numCurves + 1, 0);
+    int                 vertexIndex = 0;
+    for (size_t c = 0; c < numCurves; ++c) {
+        const int count = vertexCounts.cdata()[c];
+
+        // The first segment always eats up 4 verts, not just vstep, so to
+        // compensate, we break at count - 3.
+        // If we're closing the curve, make sure that we have enough
+        // segments to wrap all the way back to the beginning.
+        const int numSegs = wrap ? count / vStep : ((count - 4) / vStep) + 1;
+
+        firstVertices[c] = vertexIndex;
+        firstSegments[c + 1] = firstSegments[c] + std::max(numSegs, 0);
+        vertexIndex += count;
+    }
+
+    VtVec4iArray            indices(firstSegments[numCurves]);
+    GfVec4i*                segments = indices.data();
+    const _CurveIndexMapper mapIndex(topology);
+
+    WorkParallelForN(
+        numCurves,
+        [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c) {
+                const int count = vertexCounts.cdata()[c];
+                const int firstVertex = firstVertices[c];
+                const int numSegs = static_cast<int>(firstSegments[c + 1] - firstSegments[c]);
+
+                GfVec4i* seg = segments + firstSegments[c];
+                for (int i = 0; i < numSegs; ++i, ++seg) {
+                    const int offset = i * vStep;
+                    for (int v = 0; v < 4; ++v) {
+                        // If there are not enough verts to round out the segment
+                        // just repeat the last vert.
+                        (*seg)[v] = mapIndex(
+                            wrap ? firstVertex + ((offset + v) % count)
+                                 : firstVertex + std::min(offset + v, (count - 1)));
+                    }
+                }
+            }
+        },
+        kMinCurvesPerTask);
+
+    return indices;
+}
+
+VtVec2iArray HdVP2BuildLinesCurveIndices(const HdBasisCurvesTopology& topology)
+{
+    // Each curve is a list of lines with two vertices each.
+    size_t numLines = 0;
+    for (const int count : topology.GetCurveVertexCounts()) {
+        numLines += (count > 0) ? (count + 1) / 2 : 0;
+    }
+
+    VtVec2iArray            indices(numLines);
+    GfVec2i*                lines = indices.data();
+    const _CurveIndexMapper mapIndex(topology);
+
+    WorkParallelForN(
+        numLines,
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const int vertexIndex = static_cast<int>(i * 2);
+                lines[i].Set(mapIndex(vertexIndex), mapIndex(vertexIndex + 1));
+            }
+        },
+        kMinElementsPerTask);
+
+    return indices;
+}
+
+VtVec2iArray HdVP2BuildLineSegmentCurveIndices(const HdBasisCurvesTopology& topology)
+{
+    const VtIntArray& vertexCounts = topology.GetCurveVertexCounts();
+    const bool        wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    const bool        skipFirstAndLastSegs = (topology.GetCurveBasis() == HdTokens->catmullRom);
+
+    // Find where the vertices and segments of each curve start, so that the
+    // curves can be filled in parallel.
+    const size_t        numCurves = vertexCounts.size();
+    std::vector<int>    firstVertices(numCurves);
+    std::vector<size_t> firstSegments(numCurves + 1, 0);
+    int                 vertexIndex = 0;
+    for (size_t c = 0; c < numCurves; ++c) {
+        const int count = vertexCounts.cdata()[c];
+        const int numSegs = std::max(skipFirstAndLastSegs ? count - 3 : count - 1, 0);
+
+        firstVertices[c] = vertexIndex;
+        firstSegments[c + 1] = firstSegments[c] + numSegs + (wrap ? 1 : 0);
+        vertexIndex += std::max(count, 1);
+    }
+
+    VtVec2iArray            indices(firstSegments[numCurves]);
+    GfVec2i*                segments = indices.data();
+    const _CurveIndexMapper mapIndex(topology);
+
+    WorkParallelForN(
+        numCurves,
+        [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c) {
+                const int count = vertexCounts.cdata()[c];
+                const int firstVertex = firstVertices[c];
+
+                // Segment i goes from vertex i - 1 to vertex i.
+                const int firstSeg = skipFirstAndLastSegs ? 2 : 1;
+                const int lastSeg = skipFirstAndLastSegs ? count - 2 : count - 1;
+
+                GfVec2i* seg = segments + firstSegments[c];
+                for (int i = firstSeg; i <= lastSeg; ++i, ++seg) {
+                    seg->Set(mapIndex(firstVertex + i - 1), mapIndex(firstVertex + i));
+                }
+                if (wrap) {
+                    const int lastVertex = firstVertex + std::max(count - 1, 0);
+                    seg->Set(mapIndex(lastVertex), mapIndex(firstVertex));
+                }
+            }
+        },
+        kMinCurvesPerTask);
+
+    return indices;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,136 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_PRIMVAR_EXPANSION_H
+#define HD_VP2_PRIMVAR_EXPANSION_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/basisCurvesTopology.h>
+#include <pxr/imaging/hd/selection.h>
+#include <pxr/pxr.h>
+
+#include <maya/MColor.h>
+
+#include <cstddef>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Expand constant or per-element primvar data to \p numElements elements.
+
+    Constant data is broadcast, data with one value per element is shared
+    without copying.
+
+    \return false if the data has neither one value nor \p numElements values,
+            leaving \p result untouched so the caller can handle other
+            interpolations or fall back to a default value.
+*/
+template <typename T>
+bool HdVP2ExpandPrimvar(size_t numElements, const VtArray<T>& authoredData, VtArray<T>* result)
+{
+    if (authoredData.size() == 1) {
+        *result = VtArray<T>(numElements, authoredData.cdata()[0]);
+        return true;
+    }
+    if (authoredData.size() == numElements) {
+        *result = authoredData;
+        return true;
+    }
+    return false;
+}
+
+/*! \brief  Interleave colors and opacities into a float4 color stream of \p count elements.
+
+    Colors and opacities holding a single value are broadcast to all elements,
+    otherwise they must hold at least \p count values.
+*/
+MAYAUSD_CORE_PUBLIC
+void HdVP2FillColorAndOpacity(
+    float*              rgba,
+    size_t              count,
+    const VtVec3fArray& colors,
+    const VtFloatArray& opacities);
+
+/*! \brief  Interleave the colors and opacities of the instances of a prototype into a float4
+            color stream, one element per instance index.
+
+    Colors and opacities holding a single value are broadcast to all instances,
+    otherwise they are indexed with the instance indices.
+*/
+MAYAUSD_CORE_PUBLIC
+void HdVP2FillInstanceColorAndOpacity(
+    float*              rgba,
+    const VtIntArray&   instanceIndices,
+    const VtVec3fArray& colors,
+    const VtFloatArray& opacities);
+
+/*! \brief  Set the entries of \p values for the instances in the selection \p state to \p value.
+
+    Out of range instance indices are ignored.
+*/
+template <typename T>
+void HdVP2MarkSelectedInstances(
+    std::vector<T>&                        values,
+    const HdSelection::PrimSelectionState* state,
+    T                                      value)
+{
+    if (!state) {
+        return;
+    }
+
+    const int count = static_cast<int>(values.size());
+    for (const auto& indexArray : state->instanceIndices) {
+        for (const int index : indexArray) {
+            if (index >= 0 && index < count) {
+                values[index] = value;
+            }
+        }
+    }
+}
+
+/*! \brief  Fill a float4 color stream with one of \p colors per instance.
+
+    Instances whose color index is \p numColors or more keep their current
+    color, which lets authored instance colors show through.
+*/
+MAYAUSD_CORE_PUBLIC
+void HdVP2FillInstanceColors(
+    float*                            rgba,
+    const std::vector<unsigned char>& colorIndices,
+    const MColor*                     colors,
+    size_t                            numColors);
+
+/*! \brief  Build the indices of the cubic segments of the curves, four per segment.
+ */
+MAYAUSD_CORE_PUBLIC
+VtVec4iArray HdVP2BuildCubicCurveIndices(const HdBasisCurvesTopology& topology);
+
+/*! \brief  Build the indices of the lines of segmented curves, two per line.
+ */
+MAYAUSD_CORE_PUBLIC
+VtVec2iArray HdVP2BuildLinesCurveIndices(const HdBasisCurvesTopology& topology);
+
+/*! \brief  Build the indices of the line segments between consecutive vertices of the curves,
+            two per segment.
+ */
+MAYAUSD_CORE_PUBLIC
+VtVec2iArray HdVP2BuildLineSegmentCurveIndices(const HdBasisCurvesTopology& topology);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_PRIMVAR_EXPANSION_H
@@ -74,6 +74,7 @@
 #endif
 
 #include <mayaUsd/ufe/Global.h>
+#include <mayaUsd/ufe/UfePathResolutionCache.h>
 #include <mayaUsd/ufe/Utils.h>
 
 #include <usdUfe/ufe/UsdSceneItem.h>
@@ -1508,8 +1509,15 @@ bool ProxyRenderDelegate::getInstancedSelectionPath(
         }
     }
 
-    const Ufe::PathSegment pathSegment = UsdUfe::usdPathToUfePathSegment(usdPath, instanceIndex);
-    auto si = Ufe::Hierarchy::createItem(_proxyShapeData->ProxyShape()->ufePath() + pathSegment);
+    // Marquee selections pick the same prims over and over while dragging, so
+    // go through the path resolution cache rather than building the path.
+    Ufe::Path itemPath = MayaUsd::ufe::UfePathResolutionCache::getInstance().path(
+        _proxyShapeData->UsdStage(), usdPath, instanceIndex);
+    if (itemPath.empty()) {
+        itemPath = _proxyShapeData->ProxyShape()->ufePath()
+            + UsdUfe::usdPathToUfePathSegment(usdPath, instanceIndex);
+    }
+    auto si = Ufe::Hierarchy::createItem(itemPath);
     if (!si) {
         TF_WARN("Failed to create UFE scene item for Rprim '%s'", rprimId.GetText());
         return false;
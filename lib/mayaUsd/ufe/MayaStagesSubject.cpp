@@ -20,6 +20,7 @@
 #include <mayaUsd/nodes/usdSceneSettingsManager.h>
 #endif
 #include <mayaUsd/ufe/ProxyShapeHandler.h>
+#include <mayaUsd/ufe/UfePathResolutionCache.h>
 #include <mayaUsd/ufe/UsdStageMap.h>
 
 #include <usdUfe/undo/UsdUndoManager.h>
@@ -160,6 +161,10 @@ void MayaStagesSubject::clearListeners()
 
 void MayaStagesSubject::onStageSet(const MayaUsdProxyStageSetNotice& notice)
 {
+    // The UFE paths under the proxy shape now lead to another stage. This
+    // cannot wait for setupListeners() below, which may return early.
+    UfePathResolutionCache::getInstance().clear();
+
     auto noticeStage = notice.GetStage();
     // Check if stage received from notice is valid. We could have cases where a ProxyShape has an
     // invalid stage.
@@ -254,6 +259,7 @@ void MayaStagesSubject::observeStage(const PXR_NS::UsdStageRefPtr& stage)
 
 void MayaStagesSubject::onStageInvalidate(const MayaUsdProxyStageInvalidateNotice& notice)
 {
+    UfePathResolutionCache::getInstance().clear();
     clearListeners();
 
     auto p = notice.GetProxyShape().ufePath();
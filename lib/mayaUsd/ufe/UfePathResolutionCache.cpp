@@ -0,0 +1,215 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UfePathResolutionCache.h"
+
+#include <mayaUsd/ufe/UsdStageMap.h>
+#include <mayaUsd/ufe/Utils.h>
+
+#include <usdUfe/ufe/Utils.h>
+
+#include <pxr/base/tf/diagnostic.h>
+
+#include <ufe/pathSegment.h>
+
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+constexpr auto kIllegalUFEPath = "Illegal UFE run-time path %s.";
+
+} // anonymous namespace
+
+namespace MAYAUSD_NS_DEF {
+namespace ufe {
+
+/* static */
+UfePathResolutionCache& UfePathResolutionCache::getInstance()
+{
+    static UfePathResolutionCache cache;
+    return cache;
+}
+
+bool UfePathResolutionCache::resolve(const Ufe::Path& path, Resolution& resolution)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        found = _fromUfe.find(path);
+        if (found != _fromUfe.end()) {
+            if (found->second.stage) {
+                ++_hitCount;
+                resolution = found->second;
+                return true;
+            }
+            // The stage was closed without the stage map being dirtied.
+            _fromUfe.erase(found);
+        }
+        ++_missCount;
+    }
+
+    const Ufe::Path ufePrimPath = UsdUfe::stripInstanceIndexFromUfePath(path);
+
+    const Ufe::Path::Segments& segments = ufePrimPath.getSegments();
+    if (!TF_VERIFY(!segments.empty(), kIllegalUFEPath, path.string().c_str())) {
+        return false;
+    }
+
+    // Only the stages of proxy shapes are tracked by the stage map, and thus
+    // only their resolutions are known to be invalidated in time.
+    const Ufe::Path stageUfePath(segments[0]);
+    resolution.stage = UsdStageMap::getInstance().stage(stageUfePath);
+    const bool cacheable = bool(resolution.stage);
+    if (!resolution.stage) {
+        resolution.stage = getStage(stageUfePath);
+        if (!resolution.stage) {
+            return false;
+        }
+    }
+
+    resolution.instanceIndex = -1;
+    if (ufePrimPath.size() != path.size()) {
+        resolution.instanceIndex = std::stoi(path.back().string());
+    }
+
+    // If there is only a single segment in the path, it must point to the
+    // proxy shape, otherwise we would not have retrieved a valid stage.
+    // The second path segment is the USD path. If it is empty, the path is
+    // the root. UfeSegment::string does not return a leading separator...!
+    const std::string primPathStr = segments.size() == 1u ? std::string() : segments[1].string();
+    if (primPathStr.empty()) {
+        resolution.primPath = SdfPath::AbsoluteRootPath();
+    } else {
+        // Note: we call GetPrimPath in case the path is to a property or relationship, etc.
+        resolution.primPath = SdfPath(primPathStr).GetPrimPath();
+    }
+
+    if (cacheable) {
+        // Paths to properties, or with an unusual instance index spelling,
+        // resolve to the same prim as the canonical UFE path of that prim, so
+        // they must not be returned by path().
+        const bool canonical = primPathStr == resolution.primPath.GetString()
+            && (resolution.instanceIndex < 0
+                || path.back().string() == std::to_string(resolution.instanceIndex));
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        insert(path, resolution, canonical || segments.size() == 1u);
+    }
+    return true;
+}
+
+Ufe::Path UfePathResolutionCache::path(
+    const UsdStageWeakPtr& stage,
+    const SdfPath&         primPath,
+    int                    instanceIndex)
+{
+    const UsdKey key { stage, primPath, instanceIndex };
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto                        found = _toUfe.find(key);
+        if (found != _toUfe.end()) {
+            ++_hitCount;
+            return found->second;
+        }
+        ++_missCount;
+    }
+
+    // As in resolve(), only cache the paths of the stages of proxy shapes.
+    Ufe::Path  ufePath = UsdStageMap::getInstance().path(stage);
+    const bool cacheable = !ufePath.empty();
+    if (!cacheable) {
+        ufePath = stagePath(stage);
+        if (ufePath.empty()) {
+            return ufePath;
+        }
+    }
+
+    if (!primPath.IsAbsoluteRootPath()) {
+        ufePath = ufePath + UsdUfe::usdPathToUfePathSegment(primPath, instanceIndex);
+    }
+
+    if (cacheable) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        insert(ufePath, Resolution { stage, primPath, instanceIndex }, true);
+    }
+    return ufePath;
+}
+
+void UfePathResolutionCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _fromUfe.clear();
+    _toUfe.clear();
+}
+
+size_t UfePathResolutionCache::capacity() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+}
+
+void UfePathResolutionCache::setCapacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    if (_fromUfe.size() > _capacity || _toUfe.size() > _capacity) {
+        _fromUfe.clear();
+        _toUfe.clear();
+    }
+}
+
+size_t UfePathResolutionCache::size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _fromUfe.size();
+}
+
+size_t UfePathResolutionCache::hitCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hitCount;
+}
+
+size_t UfePathResolutionCache::missCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _missCount;
+}
+
+void UfePathResolutionCache::insert(
+    const Ufe::Path&  path,
+    const Resolution& resolution,
+    bool              canonical)
+{
+    if (_capacity == 0) {
+        return;
+    }
+
+    // Starting over is cheaper than tracking the use of each entry, and the
+    // paths in use are resolved again right away.
+    if (_fromUfe.size() >= _capacity || _toUfe.size() >= _capacity) {
+        _fromUfe.clear();
+        _toUfe.clear();
+    }
+
+    _fromUfe[path] = resolution;
+    if (canonical) {
+        _toUfe[UsdKey { resolution.stage, resolution.primPath, resolution.instanceIndex }] = path;
+    }
+}
+
+} // namespace ufe
+} // namespace MAYAUSD_NS_DEF
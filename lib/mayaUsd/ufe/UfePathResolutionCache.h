@@ -0,0 +1,132 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_UFEPATHRESOLUTIONCACHE_H
+#define MAYAUSD_UFEPATHRESOLUTIONCACHE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/tf/hash.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <ufe/path.h>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace MAYAUSD_NS_DEF {
+namespace ufe {
+
+//! \brief Cache of the resolution of UFE paths to USD paths.
+/*!
+    Resolving a UFE path to a prim requires finding the stage of its first
+    segment in the UsdStageMap and parsing its second segment into an SdfPath,
+    which is costly compared to the prim lookup itself. Selection, highlighting
+    and attribute editor refreshes resolve the same paths over and over, so the
+    cache keeps the result of the resolution, as well as the UFE path of each
+    resolved USD path for the opposite direction.
+
+    The mapping between the USD part of a UFE path and its SdfPath is purely
+    syntactic, so renaming or reparenting prims does not invalidate it: the
+    prim itself is always looked up again. What can change is the stage of the
+    proxy shape segment, so the cache is cleared whenever the UsdStageMap is
+    dirtied (proxy shape added, removed, renamed or reparented) or a proxy shape
+    stage is set or invalidated.
+
+    The cache is bounded: it is cleared when it reaches its capacity.
+*/
+class MAYAUSD_CORE_PUBLIC UfePathResolutionCache
+{
+public:
+    //! Result of the resolution of a UFE path.
+    struct Resolution
+    {
+        PXR_NS::UsdStageWeakPtr stage;
+        PXR_NS::SdfPath         primPath;
+        //! Point instance index at the tail of the path, or -1 if none.
+        int instanceIndex = -1;
+    };
+
+    //! Retrieve the global instance of the cache.
+    static UfePathResolutionCache& getInstance();
+
+    //! Resolve \p path into its stage, prim path and instance index. Returns
+    //! false if the path does not lead to a stage.
+    bool resolve(const Ufe::Path& path, Resolution& resolution);
+
+    //! Return the UFE path of \p primPath in \p stage, with an optional point
+    //! instance index, or an empty path if the stage is unknown.
+    Ufe::Path path(
+        const PXR_NS::UsdStageWeakPtr& stage,
+        const PXR_NS::SdfPath&         primPath,
+        int                            instanceIndex = -1);
+
+    //! Forget all resolutions.
+    void clear();
+
+    //! Maximum number of resolutions kept in each direction. Zero disables the cache.
+    size_t capacity() const;
+    void   setCapacity(size_t capacity);
+
+    //@{
+    //! Statistics, mostly for testing and profiling.
+    size_t size() const;
+    size_t hitCount() const;
+    size_t missCount() const;
+    //@}
+
+    //! Default maximum number of resolutions kept in each direction.
+    static constexpr size_t kDefaultCapacity = 65536;
+
+private:
+    UfePathResolutionCache() = default;
+
+    MAYAUSD_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UfePathResolutionCache);
+
+    struct UsdKey
+    {
+        PXR_NS::UsdStageWeakPtr stage;
+        PXR_NS::SdfPath         primPath;
+        int                     instanceIndex;
+
+        bool operator==(const UsdKey& other) const
+        {
+            return stage == other.stage && primPath == other.primPath
+                && instanceIndex == other.instanceIndex;
+        }
+
+        template <class HashState> friend void TfHashAppend(HashState& h, const UsdKey& key)
+        {
+            h.Append(key.stage, key.primPath, key.instanceIndex);
+        }
+    };
+
+    // Callers must hold _mutex. Only canonical paths are recorded for path().
+    void insert(const Ufe::Path& path, const Resolution& resolution, bool canonical);
+
+    mutable std::mutex                                    _mutex;
+    std::unordered_map<Ufe::Path, Resolution>             _fromUfe;
+    std::unordered_map<UsdKey, Ufe::Path, PXR_NS::TfHash> _toUfe;
+    size_t                                                _capacity { kDefaultCapacity };
+    size_t                                                _hitCount { 0 };
+    size_t                                                _missCount { 0 };
+
+}; // UfePathResolutionCache
+
+} // namespace ufe
+} // namespace MAYAUSD_NS_DEF
+
+#endif // MAYAUSD_UFEPATHRESOLUTIONCACHE_H
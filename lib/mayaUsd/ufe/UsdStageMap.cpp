@@ -19,6 +19,7 @@
 #include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/ufe/Global.h>
 #include <mayaUsd/ufe/ProxyShapeHandler.h>
+#include <mayaUsd/ufe/UfePathResolutionCache.h>
 #include <mayaUsd/ufe/Utils.h>
 #include <mayaUsd/utils/util.h>
 
@@ -218,6 +219,7 @@ MObject UsdStageMap::proxyShape(const Ufe::Path& path, bool rebuildCacheIfNeeded
     if (!object.isValid()) {
         TF_DEBUG(MAYAUSD_STAGEMAP).Msg("Found invalid object for %s\n", path.string().c_str());
         _pathToObject.erase(singleSegmentPath);
+        UfePathResolutionCache::getInstance().clear();
         return MObject();
     }
 
@@ -231,6 +233,7 @@ MObject UsdStageMap::proxyShape(const Ufe::Path& path, bool rebuildCacheIfNeeded
         // _pathToObject so that the key path is the current object path and
         // return an invalid object to signify we did not find the proxy shape.
         _pathToObject.erase(singleSegmentPath);
+        UfePathResolutionCache::getInstance().clear();
         if (!objectPath.empty())
             _pathToObject[objectPath] = object;
         TF_VERIFY(std::end(_pathToObject) == _pathToObject.find(singleSegmentPath));
@@ -320,6 +323,7 @@ bool UsdStageMap::isInStagesCache(const Ufe::Path& path)
 
 void UsdStageMap::setDirty()
 {
+    UfePathResolutionCache::getInstance().clear();
     _pathToObject.clear();
     _stageToObject.clear();
     _dirty = true;
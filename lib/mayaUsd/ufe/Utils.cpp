@@ -17,6 +17,7 @@
 #include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/ufe/Global.h>
 #include <mayaUsd/ufe/ProxyShapeHandler.h>
+#include <mayaUsd/ufe/UfePathResolutionCache.h>
 #include <mayaUsd/ufe/UsdStageMap.h>
 #include <mayaUsd/ufe/Utils.h>
 #include <mayaUsd/utils/util.h>
@@ -73,12 +74,6 @@
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
-namespace {
-
-constexpr auto kIllegalUFEPath = "Illegal UFE run-time path %s.";
-
-} // anonymous namespace
-
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
@@ -155,38 +150,17 @@ UsdPrim ufePathToPrim(const Ufe::Path& path)
 {
     // When called we do not make any assumption on whether or not the
     // input path is valid.
-
-    const Ufe::Path ufePrimPath = UsdUfe::stripInstanceIndexFromUfePath(path);
-
-    const Ufe::Path::Segments& segments = ufePrimPath.getSegments();
-    if (!TF_VERIFY(!segments.empty(), kIllegalUFEPath, path.string().c_str())) {
-        return UsdPrim();
-    }
-    auto stage = getStage(Ufe::Path(segments[0]));
-    if (!stage) {
-        // Do not output any TF message here (such as TF_WARN). A low-level function
-        // like this should not be outputting any warnings messages. It is allowed to
-        // call this method with a properly composed Ufe path, but one that doesn't
-        // actually point to any valid prim.
+    //
+    // Do not output any TF message when the path does not lead to a stage.
+    // A low-level function like this should not be outputting any warnings
+    // messages. It is allowed to call this method with a properly composed Ufe
+    // path, but one that doesn't actually point to any valid prim.
+    UfePathResolutionCache::Resolution resolution;
+    if (!UfePathResolutionCache::getInstance().resolve(path, resolution)) {
         return UsdPrim();
     }
 
-    // If there is only a single segment in the path, it must point to the
-    // proxy shape, otherwise we would not have retrieved a valid stage.
-    // The second path segment is the USD path.
-    if (segments.size() == 1u) {
-        return stage->GetPseudoRoot();
-    }
-
-    // If the USD path is empty, return the root. UfeSegment::string does not return a leading
-    // separator...!
-    std::string primPathStr = segments[1].string();
-    if (primPathStr.empty()) {
-        return stage->GetPseudoRoot();
-    }
-
-    // Note: we call GetPrimPath in case the path is to a property or relationship, etc.
-    return stage->GetPrimAtPath(SdfPath(primPathStr).GetPrimPath());
+    return resolution.stage->GetPrimAtPath(resolution.primPath);
 }
 
 std::string uniqueChildNameMayaStandard(
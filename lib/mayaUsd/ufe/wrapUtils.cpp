@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 #include <mayaUsd/ufe/Global.h>
+#include <mayaUsd/ufe/UfePathResolutionCache.h>
 #include <mayaUsd/ufe/Utils.h>
 
 #include <usdUfe/ufe/UsdSceneItem.h>
@@ -71,6 +72,29 @@ std::string getNodeTypeFromRawItem(uint64_t rawItem)
     return type;
 }
 
+void _clearPathResolutionCache()
+{
+    MayaUsd::ufe::UfePathResolutionCache::getInstance().clear();
+}
+
+size_t _getPathResolutionCacheCapacity()
+{
+    return MayaUsd::ufe::UfePathResolutionCache::getInstance().capacity();
+}
+
+void _setPathResolutionCacheCapacity(size_t capacity)
+{
+    MayaUsd::ufe::UfePathResolutionCache::getInstance().setCapacity(capacity);
+}
+
+// Returns the size, hit count and miss count of the cache.
+PXR_BOOST_PYTHON_NAMESPACE::tuple _getPathResolutionCacheStats()
+{
+    const auto& cache = MayaUsd::ufe::UfePathResolutionCache::getInstance();
+    return PXR_BOOST_PYTHON_NAMESPACE::make_tuple(
+        cache.size(), cache.hitCount(), cache.missCount());
+}
+
 std::vector<PXR_NS::UsdStageRefPtr> _getAllStages()
 {
     auto                                allStages = MayaUsd::ufe::getAllStages();
@@ -130,4 +154,9 @@ void wrapUtils()
     // the USD path separator is '/'.  PPT, 8-Dec-2019.
     def("getAllStages", _getAllStages, return_value_policy<PXR_NS::TfPySequenceToList>());
     def("getProxyShapePurposes", _getProxyShapePurposes);
+
+    def("clearPathResolutionCache", _clearPathResolutionCache);
+    def("getPathResolutionCacheCapacity", _getPathResolutionCacheCapacity);
+    def("setPathResolutionCacheCapacity", _setPathResolutionCacheCapacity);
+    def("getPathResolutionCacheStats", _getPathResolutionCacheStats);
 }
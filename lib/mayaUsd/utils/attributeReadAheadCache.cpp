@@ -0,0 +1,621 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "attributeReadAheadCache.h"
+
+#include <pxr/base/gf/math.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/weakPtr.h>
+#include <pxr/usd/sdf/layerOffset.h>
+#include <pxr/usd/sdf/propertySpec.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/interpolation.h>
+#include <pxr/usd/usd/resolveInfo.h>
+#if PXR_VERSION < 2508
+#include <pxr/usd/usd/usdFileFormat.h>
+#include <pxr/usd/usd/usdcFileFormat.h>
+#else
+#include <pxr/usd/sdf/usdFileFormat.h>
+#include <pxr/usd/sdf/usdcFileFormat.h>
+#endif
+
+#include <maya/MAnimControl.h>
+#include <maya/MConditionMessage.h>
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_READ_AHEAD_CACHE_SAMPLES,
+    8,
+    "Number of time samples of animated point data read ahead of the playback.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_READ_AHEAD_CACHE_MEMORY_MB,
+    1024,
+    "Maximum amount of memory, in megabytes, used by the read-ahead cache of "
+    "animated point data.");
+
+namespace {
+
+size_t _SampleBytes(const VtVec3fArray& value) { return value.size() * sizeof(GfVec3f); }
+
+// Whether the layer is a crate file that was not modified since it was opened, so that a
+// private copy of it opened from disk holds the same samples.
+bool _IsUnmodifiedCrateFile(const SdfLayerHandle& layer)
+{
+    if (layer->IsAnonymous() || layer->IsDirty() || layer->GetRealPath().empty()) {
+        return false;
+    }
+
+    TfToken format = layer->GetFileFormat()->GetFormatId();
+#if PXR_VERSION < 2508
+    if (format == UsdUsdFileFormatTokens->Id) {
+        format = UsdUsdFileFormat::GetUnderlyingFormatForLayer(*layer);
+    }
+    return format == UsdUsdcFileFormatTokens->Id;
+#else
+    if (format == SdfUsdFileFormatTokens->Id) {
+        format = SdfUsdFileFormat::GetUnderlyingFormatForLayer(*layer);
+    }
+    return format == SdfUsdcFileFormatTokens->Id;
+#endif
+}
+
+} // namespace
+
+/* static */
+UsdMayaAttributeReadAheadCache& UsdMayaAttributeReadAheadCache::GetInstance()
+{
+    // Never destroyed, so that no read ahead is still running when the
+    // libraries it uses get unloaded.
+    static UsdMayaAttributeReadAheadCache* instance = new UsdMayaAttributeReadAheadCache();
+    return *instance;
+}
+
+UsdMayaAttributeReadAheadCache::UsdMayaAttributeReadAheadCache()
+    : _readAheadCount(std::max(0, TfGetEnvSetting(MAYAUSD_READ_AHEAD_CACHE_SAMPLES)))
+    , _memoryLimit(
+          static_cast<size_t>(std::max(0, TfGetEnvSetting(MAYAUSD_READ_AHEAD_CACHE_MEMORY_MB)))
+          * 1024u * 1024u)
+{
+    TfWeakPtr<UsdMayaAttributeReadAheadCache> me(this);
+    _objectsChangedKey = TfNotice::Register(me, &UsdMayaAttributeReadAheadCache::_OnObjectsChanged);
+}
+
+UsdMayaAttributeReadAheadCache::~UsdMayaAttributeReadAheadCache()
+{
+    TfNotice::Revoke(_objectsChangedKey);
+    _CancelReadAhead();
+}
+
+void UsdMayaAttributeReadAheadCache::Initialize()
+{
+    if (_playingBackCallbackId) {
+        return;
+    }
+
+    // MAnimControl can only be queried from the main thread, while the deformers
+    // are evaluated on any thread, so follow the playback state from there.
+    MStatus status;
+    _playingBackCallbackId = MConditionMessage::addConditionCallback(
+        "playingBack", &UsdMayaAttributeReadAheadCache::_OnPlayingBackChanged, this, &status);
+    CHECK_MSTATUS(status);
+    _playing = MAnimControl::isPlaying();
+}
+
+void UsdMayaAttributeReadAheadCache::Finalize()
+{
+    if (_playingBackCallbackId) {
+        MMessage::removeCallback(_playingBackCallbackId);
+        _playingBackCallbackId = 0;
+    }
+    _playing = false;
+    Clear();
+}
+
+bool UsdMayaAttributeReadAheadCache::Get(
+    const UsdAttribute& attr,
+    UsdTimeCode         time,
+    VtVec3fArray*       value)
+{
+    if (!value || !attr) {
+        return false;
+    }
+
+    if (time.IsDefault() || !attr.ValueMightBeTimeVarying()) {
+        return attr.Get(value, time);
+    }
+
+    const bool playing = _playing;
+
+    const _Key                   key(attr.GetStage(), attr.GetPath());
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    auto found = _tracks.find(key);
+    if (found == _tracks.end()) {
+        lock.unlock();
+        std::vector<double> times;
+        if (!attr.GetTimeSamples(&times) || times.size() < 2u) {
+            return attr.Get(value, time);
+        }
+        std::shared_ptr<const _Source> source = _FindSource(attr, times);
+        lock.lock();
+        found = _tracks.find(key);
+        if (found == _tracks.end()) {
+            _CreateTrack(key, attr, std::move(times), std::move(source));
+            found = _tracks.find(key);
+        }
+    }
+
+    _Track& track = found->second;
+
+    // Find the samples bracketing the time, clamping to the first and last
+    // samples like UsdAttribute::Get() does.
+    const double t = time.GetValue();
+    const auto   upperIt = std::lower_bound(track.times.begin(), track.times.end(), t);
+    size_t       upper = std::min<size_t>(upperIt - track.times.begin(), track.times.size() - 1u);
+    size_t       lower = upper;
+    if (upperIt != track.times.begin() && upperIt != track.times.end() && *upperIt != t) {
+        lower = upper - 1u;
+        if (attr.GetStage()->GetInterpolationType() != UsdInterpolationTypeLinear) {
+            upper = lower;
+        }
+    }
+
+    if (lower > track.lastIndex) {
+        track.direction = 1;
+    } else if (lower < track.lastIndex) {
+        track.direction = -1;
+    }
+    track.lastIndex = lower;
+    track.lastUse = ++_useCounter;
+
+    const double lowerTime = track.times[lower];
+    const double upperTime = track.times[upper];
+
+    VtVec3fArray lowerValue;
+    VtVec3fArray upperValue;
+    auto         lowerSample = track.samples.find(lower);
+    auto         upperSample = track.samples.find(upper);
+    const bool   hasLower = lowerSample != track.samples.end();
+    const bool   hasUpper = upperSample != track.samples.end();
+    if (hasLower) {
+        lowerValue = lowerSample->second;
+    }
+    if (hasUpper) {
+        upperValue = upperSample->second;
+    }
+
+    if (hasLower && hasUpper) {
+        ++_hitCount;
+    } else {
+        ++_missCount;
+
+        // Read the missing samples without holding the lock, so that other
+        // deformers and the read ahead are not blocked on this one.
+        const size_t       generation = track.generation;
+        const UsdAttribute trackAttr = track.attr;
+        lock.unlock();
+
+        if ((!hasLower && !trackAttr.Get(&lowerValue, lowerTime))
+            || (!hasUpper && upper != lower && !trackAttr.Get(&upperValue, upperTime))) {
+            return attr.Get(value, time);
+        }
+        if (upper == lower) {
+            upperValue = lowerValue;
+        }
+
+        lock.lock();
+        found = _tracks.find(key);
+        if (found == _tracks.end() || found->second.generation != generation) {
+            // The attribute changed while reading it: let the stage answer.
+            lock.unlock();
+            return attr.Get(value, time);
+        }
+        if (!hasLower) {
+            _Insert(found->second, lower, lowerValue);
+        }
+        if (!hasUpper && upper != lower) {
+            _Insert(found->second, upper, upperValue);
+        }
+    }
+
+    _Track& current = found->second;
+    _ReleaseOutsideWindow(current, lower, upper);
+    if (playing) {
+        _ScheduleReadAhead(key, current);
+    }
+    _EnforceMemoryLimit(&current);
+    lock.unlock();
+
+    if (lower == upper || lowerValue.size() != upperValue.size()) {
+        *value = lowerValue;
+        return true;
+    }
+
+    const double   alpha = (t - lowerTime) / (upperTime - lowerTime);
+    const GfVec3f* lowerData = lowerValue.cdata();
+    const GfVec3f* upperData = upperValue.cdata();
+
+    value->resize(lowerValue.size());
+    GfVec3f* data = value->data();
+    for (size_t i = 0u; i < lowerValue.size(); ++i) {
+        data[i] = GfLerp(alpha, lowerData[i], upperData[i]);
+    }
+    return true;
+}
+
+size_t UsdMayaAttributeReadAheadCache::GetReadAheadCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _readAheadCount;
+}
+
+void UsdMayaAttributeReadAheadCache::SetReadAheadCount(size_t count)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _readAheadCount = count;
+}
+
+size_t UsdMayaAttributeReadAheadCache::GetMemoryLimit() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryLimit;
+}
+
+void UsdMayaAttributeReadAheadCache::SetMemoryLimit(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _memoryLimit = bytes;
+    _EnforceMemoryLimit(nullptr);
+}
+
+size_t UsdMayaAttributeReadAheadCache::GetBytesResident() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _bytesResident;
+}
+
+size_t UsdMayaAttributeReadAheadCache::GetHitCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hitCount;
+}
+
+size_t UsdMayaAttributeReadAheadCache::GetMissCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _missCount;
+}
+
+double UsdMayaAttributeReadAheadCache::GetHitRate() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const size_t                total = _hitCount + _missCount;
+    return total ? static_cast<double>(_hitCount) / total : 0.0;
+}
+
+void UsdMayaAttributeReadAheadCache::ResetStatistics()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _hitCount = 0u;
+    _missCount = 0u;
+}
+
+void UsdMayaAttributeReadAheadCache::Clear()
+{
+    _CancelReadAhead();
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto& track : _tracks) {
+            *track.second.cancelled = true;
+        }
+        _tracks.clear();
+        _bytesResident = 0u;
+    }
+
+    std::lock_guard<std::mutex> lock(_sourceLayersMutex);
+    _sourceLayers.clear();
+}
+
+/* static */
+void UsdMayaAttributeReadAheadCache::_OnPlayingBackChanged(bool playing, void* clientData)
+{
+    auto* cache = static_cast<UsdMayaAttributeReadAheadCache*>(clientData);
+    cache->_playing = playing;
+
+    // Outside of playback the stages may be edited at any time, so make sure
+    // nothing reads them in the background anymore.
+    if (!playing) {
+        cache->_CancelReadAhead();
+    }
+}
+
+void UsdMayaAttributeReadAheadCache::_OnObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+{
+    const UsdStageWeakPtr stage = notice.GetStage();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_tracks.empty()) {
+        return;
+    }
+
+    const UsdNotice::ObjectsChanged::PathRange resynced = notice.GetResyncedPaths();
+    const UsdNotice::ObjectsChanged::PathRange changed = notice.GetChangedInfoOnlyPaths();
+    bool                                       erased = false;
+    for (auto it = _tracks.begin(); it != _tracks.end();) {
+        const _Key& key = it->first;
+        bool        affected = false;
+        if (key.first == stage) {
+            const SdfPath& attrPath = key.second;
+            for (const SdfPath& path : resynced) {
+                if (attrPath.HasPrefix(path)) {
+                    affected = true;
+                    break;
+                }
+            }
+            for (auto pathIt = changed.begin(); !affected && pathIt != changed.end(); ++pathIt) {
+                const SdfPath& path = *pathIt;
+                affected = path == attrPath || path == attrPath.GetPrimPath()
+                    || path.IsAbsoluteRootPath();
+            }
+        }
+
+        if (affected) {
+            auto next = std::next(it);
+            _EraseTrack(it);
+            it = next;
+            erased = true;
+        } else {
+            ++it;
+        }
+    }
+
+    // The changed layers may have been reloaded from a different file: open new private copies
+    // of the files for the tracks created from now on.
+    if (erased) {
+        std::lock_guard<std::mutex> sourceLayersLock(_sourceLayersMutex);
+        _sourceLayers.clear();
+    }
+}
+
+void UsdMayaAttributeReadAheadCache::_CancelReadAhead()
+{
+    // The reads not started yet see the new epoch and return right away.
+    ++_readAheadEpoch;
+
+    std::lock_guard<std::mutex> lock(_waitMutex);
+    _dispatcher.Wait();
+}
+
+std::shared_ptr<const UsdMayaAttributeReadAheadCache::_Source>
+UsdMayaAttributeReadAheadCache::_FindSource(
+    const UsdAttribute&        attr,
+    const std::vector<double>& times)
+{
+    // Samples from value clips or from a spline are not read ahead.
+    if (attr.GetResolveInfo().GetSource() != UsdResolveInfoSourceTimeSamples) {
+        return nullptr;
+    }
+
+    // Find the strongest spec holding a value, which must hold the samples.
+    for (const auto& specAndOffset : attr.GetPropertyStackWithLayerOffsets()) {
+        const SdfLayerHandle layer = specAndOffset.first->GetLayer();
+        const SdfPath        path = specAndOffset.first->GetPath();
+        if (!layer->HasField(path, SdfFieldKeys->TimeSamples)) {
+            if (layer->HasField(path, SdfFieldKeys->Default)) {
+                return nullptr;
+            }
+            continue;
+        }
+        if (!_IsUnmodifiedCrateFile(layer)) {
+            return nullptr;
+        }
+
+        // The samples of the layer must be the samples of the attribute, in the same order.
+        const SdfLayerOffset&  offset = specAndOffset.second;
+        const std::set<double> layerTimes = layer->ListTimeSamplesForPath(path);
+        if (offset.GetScale() <= 0.0 || layerTimes.size() != times.size()) {
+            return nullptr;
+        }
+        auto source = std::make_shared<_Source>();
+        source->path = path;
+        source->times.assign(layerTimes.begin(), layerTimes.end());
+        for (size_t i = 0u; i < times.size(); ++i) {
+            if (!GfIsClose(offset * source->times[i], times[i], 1e-6)) {
+                return nullptr;
+            }
+        }
+
+        const std::string           realPath = layer->GetRealPath();
+        std::lock_guard<std::mutex> lock(_sourceLayersMutex);
+        SdfLayerRefPtr&             sourceLayer = _sourceLayers[realPath];
+        if (!sourceLayer) {
+            sourceLayer = SdfLayer::OpenAsAnonymous(realPath);
+        }
+        if (!sourceLayer) {
+            _sourceLayers.erase(realPath);
+            return nullptr;
+        }
+        source->layer = sourceLayer;
+        return source;
+    }
+    return nullptr;
+}
+
+UsdMayaAttributeReadAheadCache::_Track& UsdMayaAttributeReadAheadCache::_CreateTrack(
+    const _Key&                    key,
+    const UsdAttribute&            attr,
+    std::vector<double>&&          times,
+    std::shared_ptr<const _Source> source)
+{
+    // Forget the attributes of the stages that were closed.
+    for (auto it = _tracks.begin(); it != _tracks.end();) {
+        if (it->first.first.IsExpired()) {
+            auto next = std::next(it);
+            _EraseTrack(it);
+            it = next;
+        } else {
+            ++it;
+        }
+    }
+
+    _Track& track = _tracks[key];
+    track.attr = attr;
+    track.source = std::move(source);
+    track.times = std::move(times);
+    track.cancelled = std::make_shared<std::atomic<bool>>(false);
+    track.generation = ++_nextGeneration;
+    return track;
+}
+
+void UsdMayaAttributeReadAheadCache::_EraseTrack(_TrackMap::iterator it)
+{
+    // Reads in flight for the attribute are not needed anymore.
+    *it->second.cancelled = true;
+    for (const auto& sample : it->second.samples) {
+        _bytesResident -= _SampleBytes(sample.second);
+    }
+    _tracks.erase(it);
+}
+
+void UsdMayaAttributeReadAheadCache::_Insert(
+    _Track&             track,
+    size_t              index,
+    const VtVec3fArray& value)
+{
+    if (track.samples.emplace(index, value).second) {
+        track.sampleBytes = _SampleBytes(value);
+        _bytesResident += track.sampleBytes;
+    }
+}
+
+void UsdMayaAttributeReadAheadCache::_ScheduleReadAhead(const _Key& key, _Track& track)
+{
+    if (!track.source) {
+        return;
+    }
+
+    for (size_t i = 1u; i <= _readAheadCount; ++i) {
+        if (track.direction < 0 && i > track.lastIndex) {
+            break;
+        }
+        const size_t index = track.direction < 0 ? track.lastIndex - i : track.lastIndex + i;
+        if (index >= track.times.size()) {
+            break;
+        }
+        if (track.samples.count(index) || track.pending.count(index)) {
+            continue;
+        }
+
+        // Stay within the memory limit, assuming the samples to come are as
+        // large as the ones already read.
+        if (_bytesResident + (track.pending.size() + 1u) * track.sampleBytes > _memoryLimit) {
+            break;
+        }
+
+        track.pending.insert(index);
+        _dispatcher.Run([this,
+                         key,
+                         index,
+                         source = track.source,
+                         generation = track.generation,
+                         cancelled = track.cancelled,
+                         epoch = _readAheadEpoch.load()]() {
+            // Skip the read when the attribute changed or the playback stopped
+            // since it was scheduled. The sample is read from the private copy of
+            // its layer, never from the stage, which may be edited meanwhile.
+            VtVec3fArray value;
+            const bool   read = !*cancelled && epoch == _readAheadEpoch
+                && source->layer->QueryTimeSample(source->path, source->times[index], &value);
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto                        found = _tracks.find(key);
+            if (found == _tracks.end() || found->second.generation != generation) {
+                return;
+            }
+            found->second.pending.erase(index);
+            if (read) {
+                _Insert(found->second, index, value);
+            }
+        });
+    }
+}
+
+void UsdMayaAttributeReadAheadCache::_ReleaseOutsideWindow(
+    _Track& track,
+    size_t  lower,
+    size_t  upper)
+{
+    // Keep as many samples on each side of the requested ones as are read ahead,
+    // so that stepping back and forth around the current time stays in memory.
+    const size_t first = lower > _readAheadCount ? lower - _readAheadCount : 0u;
+    const size_t last = upper + _readAheadCount;
+    for (auto it = track.samples.begin(); it != track.samples.end();) {
+        if (it->first < first || it->first > last) {
+            _bytesResident -= _SampleBytes(it->second);
+            it = track.samples.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void UsdMayaAttributeReadAheadCache::_EnforceMemoryLimit(const _Track* current)
+{
+    // Evict the samples farthest from the last requested time of their
+    // attribute first, but never the samples just requested, which are needed
+    // right away. Ties go to the least recently used attribute.
+    while (_bytesResident > _memoryLimit) {
+        _Track* farthestTrack = nullptr;
+        size_t  farthestIndex = 0u;
+        size_t  farthestDistance = 0u;
+        for (auto& entry : _tracks) {
+            _Track& track = entry.second;
+            if (track.samples.empty()) {
+                continue;
+            }
+            for (const size_t index : { track.samples.begin()->first,
+                                        track.samples.rbegin()->first }) {
+                const size_t distance = index > track.lastIndex ? index - track.lastIndex
+                                                                : track.lastIndex - index;
+                if (&track == current && index >= track.lastIndex
+                    && index <= track.lastIndex + 1u) {
+                    continue;
+                }
+                if (!farthestTrack || distance > farthestDistance
+                    || (distance == farthestDistance
+                        && track.lastUse < farthestTrack->lastUse)) {
+                    farthestTrack = &track;
+                    farthestIndex = index;
+                    farthestDistance = distance;
+                }
+            }
+        }
+        if (!farthestTrack) {
+            break;
+        }
+
+        auto sample = farthestTrack->samples.find(farthestIndex);
+        _bytesResident -= _SampleBytes(sample->second);
+        farthestTrack->samples.erase(sample);
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
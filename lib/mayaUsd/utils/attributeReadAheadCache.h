@@ -0,0 +1,202 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_ATTRIBUTEREADAHEADCACHE_H
+#define PXRUSDMAYA_ATTRIBUTEREADAHEADCACHE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/work/dispatcher.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <maya/MMessage.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdMayaAttributeReadAheadCache
+/// \brief Memory-bounded cache of the time samples of animated point data,
+/// like points and normals, read ahead on worker threads during playback.
+///
+/// Deformer nodes driven by USD read a full array every time they are
+/// evaluated, so playback stalls on file I/O and crate decompression. When a
+/// value is requested during playback, the cache schedules reading the next
+/// time samples in the direction of the playback, so that the following frames
+/// are served from memory. Only the samples within the read-ahead count of the
+/// last requested time of an attribute are kept, and the samples farthest from
+/// the last requested time of their attribute are evicted first when the memory
+/// limit is reached.
+///
+/// Samples are only read ahead during playback. The reads in flight are cancelled
+/// and waited for when the playback stops, and cancelled for an attribute when
+/// its stage reports a change to it. As a stage may still be edited from the
+/// main thread during playback, the samples are never read ahead from the stage
+/// itself: they are read from a private copy of the unmodified crate file
+/// holding them, which nothing edits. Attributes whose samples come from an
+/// anonymous, modified or text layer, or from value clips, are not read ahead.
+class UsdMayaAttributeReadAheadCache : public TfWeakBase
+{
+public:
+    /// \brief Returns the cache shared by all deformer nodes.
+    MAYAUSD_CORE_PUBLIC
+    static UsdMayaAttributeReadAheadCache& GetInstance();
+
+    /// \brief Starts tracking the playback state. Must be called from the main
+    /// thread, when the deformer nodes using the cache are registered.
+    MAYAUSD_CORE_PUBLIC
+    void Initialize();
+
+    /// \brief Stops tracking the playback state and releases all the cached
+    /// samples. Must be called from the main thread.
+    MAYAUSD_CORE_PUBLIC
+    void Finalize();
+
+    /// \brief Gets the value of \p attr at \p time.
+    ///
+    /// Values between time samples are interpolated from the cached samples the
+    /// same way the stage would interpolate them.
+    MAYAUSD_CORE_PUBLIC
+    bool Get(const UsdAttribute& attr, UsdTimeCode time, VtVec3fArray* value);
+
+    /// \brief Number of time samples read ahead of the playback.
+    MAYAUSD_CORE_PUBLIC
+    size_t GetReadAheadCount() const;
+    MAYAUSD_CORE_PUBLIC
+    void SetReadAheadCount(size_t count);
+
+    /// \brief Maximum number of bytes of sample data held by the cache.
+    MAYAUSD_CORE_PUBLIC
+    size_t GetMemoryLimit() const;
+    MAYAUSD_CORE_PUBLIC
+    void SetMemoryLimit(size_t bytes);
+
+    /// \brief Number of bytes of sample data currently held by the cache.
+    MAYAUSD_CORE_PUBLIC
+    size_t GetBytesResident() const;
+
+    /// \brief Number of requests fully served from memory.
+    MAYAUSD_CORE_PUBLIC
+    size_t GetHitCount() const;
+
+    /// \brief Number of requests that had to read from the stage.
+    MAYAUSD_CORE_PUBLIC
+    size_t GetMissCount() const;
+
+    /// \brief Ratio of requests served from memory, zero if nothing was requested.
+    MAYAUSD_CORE_PUBLIC
+    double GetHitRate() const;
+
+    MAYAUSD_CORE_PUBLIC
+    void ResetStatistics();
+
+    /// \brief Waits for the reads in flight and releases all the cached samples.
+    MAYAUSD_CORE_PUBLIC
+    void Clear();
+
+private:
+    using _Key = std::pair<UsdStageWeakPtr, SdfPath>;
+
+    /// Time samples of an attribute in the private copy of the layer holding them.
+    struct _Source
+    {
+        SdfLayerRefPtr      layer;
+        SdfPath             path;
+        std::vector<double> times;
+    };
+
+    struct _Track
+    {
+        UsdAttribute                       attr;
+        std::shared_ptr<const _Source>     source;
+        std::vector<double>                times;
+        std::map<size_t, VtVec3fArray>     samples;
+        std::set<size_t>                   pending;
+        std::shared_ptr<std::atomic<bool>> cancelled;
+        size_t                             generation = 0;
+        size_t                             sampleBytes = 0;
+        size_t                             lastIndex = 0;
+        int                                direction = 1;
+        size_t                             lastUse = 0;
+    };
+
+    using _TrackMap = std::unordered_map<_Key, _Track, TfHash>;
+
+    UsdMayaAttributeReadAheadCache();
+    ~UsdMayaAttributeReadAheadCache();
+
+    static void _OnPlayingBackChanged(bool playing, void* clientData);
+
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged& notice);
+    void _CancelReadAhead();
+
+    std::shared_ptr<const _Source>
+    _FindSource(const UsdAttribute& attr, const std::vector<double>& times);
+
+    // All the following methods expect _mutex to be locked.
+    _Track& _CreateTrack(
+        const _Key&                    key,
+        const UsdAttribute&            attr,
+        std::vector<double>&&          times,
+        std::shared_ptr<const _Source> source);
+    void    _EraseTrack(_TrackMap::iterator it);
+    void    _Insert(_Track& track, size_t index, const VtVec3fArray& value);
+    void    _ScheduleReadAhead(const _Key& key, _Track& track);
+    void    _ReleaseOutsideWindow(_Track& track, size_t lower, size_t upper);
+    void    _EnforceMemoryLimit(const _Track* current);
+
+    mutable std::mutex  _mutex;
+    _TrackMap           _tracks;
+    WorkDispatcher      _dispatcher;
+    std::mutex          _waitMutex;
+    TfNotice::Key       _objectsChangedKey;
+    MCallbackId         _playingBackCallbackId = 0;
+    std::atomic<bool>   _playing { false };
+    std::atomic<size_t> _readAheadEpoch { 0 };
+
+    size_t _readAheadCount;
+    size_t _memoryLimit;
+    size_t _bytesResident = 0;
+    size_t _hitCount = 0;
+    size_t _missCount = 0;
+    size_t _nextGeneration = 0;
+    size_t _useCounter = 0;
+
+    // Private copies of the crate files the samples are read ahead from, by real path.
+    std::mutex                                      _sourceLayersMutex;
+    std::unordered_map<std::string, SdfLayerRefPtr> _sourceLayers;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
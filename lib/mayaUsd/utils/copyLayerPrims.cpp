@@ -18,8 +18,12 @@
 
 #include <mayaUsd/utils/traverseLayer.h>
 
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/listOp.h>
+#include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/modelAPI.h>
 
 #include <maya/MGlobal.h>
@@ -112,56 +116,71 @@ void replicateMissingAncestors(
     }
 }
 
+// Find the entry of the given map whose key is the closest ancestor of the
+// given path, or the path itself. Walking up the ancestors only costs a lookup
+// per level of the path, instead of a prefix check for every entry of the map.
+template <class PATH_MAP>
+typename PATH_MAP::const_iterator findClosestAncestor(const PATH_MAP& paths, const SdfPath& path)
+{
+    for (SdfPath ancestor = path; !ancestor.IsEmpty() && !ancestor.IsAbsoluteRootPath();
+         ancestor = ancestor.GetParentPath()) {
+        const auto found = paths.find(ancestor);
+        if (found != paths.end())
+            return found;
+    }
+    return paths.end();
+}
+
 // Verify if the given path needs to be renamed and rename it if needed.
 void renamePath(SdfPath& pathToVerify, const MayaUsd::CopyLayerPrimsResult& result)
 {
-    for (const auto& oldAndNew : result.renamedPaths) {
-        // If the relationship was not targeting this renamed path, skip.
-        const SdfPath& oldPath = oldAndNew.first;
-        if (!pathToVerify.HasPrefix(oldPath))
-            continue;
-
-        const SdfPath& newPath = oldAndNew.second;
-        SdfPath        renamedPath = pathToVerify.ReplacePrefix(oldPath, newPath);
-
-        DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
-            "Renaming path %s to %s",
-            pathToVerify.GetAsString().c_str(),
-            renamedPath.GetAsString().c_str()));
-
-        pathToVerify = renamedPath;
-
-        // Note: each path must only be renamed once. Otherwise, if there
-        //       is a chain of renaming 1 -> 2 -> 3, etc, all paths would
-        //       get renamed to the end of the chain, instead of their one
-        //       true renamed path.
-        //
-        //       For example:
-        //
-        //       Let's say we copied a1 and a2 and suppose the destination
-        //       already contained a1. Then a1 will become a2 and a2 will
-        //       become a3 in the destination.
-        //
-        //       When verifying the path a1 we want to correctly rename it to
-        //       the path a2, but then avoid renaming it again to a3. That is
-        //       why we interrupt renaming at the first renaming.
-        break;
+    // Note: each path must only be renamed once. Otherwise, if there
+    //       is a chain of renaming 1 -> 2 -> 3, etc, all paths would
+    //       get renamed to the end of the chain, instead of their one
+    //       true renamed path.
+    //
+    //       For example:
+    //
+    //       Let's say we copied a1 and a2 and suppose the destination
+    //       already contained a1. Then a1 will become a2 and a2 will
+    //       become a3 in the destination.
+    //
+    //       When verifying the path a1 we want to correctly rename it to
+    //       the path a2, but then avoid renaming it again to a3. That is
+    //       why only the top-most renamed ancestor is used.
+    auto renamed = result.renamedPaths.end();
+    for (SdfPath ancestor = pathToVerify; !ancestor.IsEmpty() && !ancestor.IsAbsoluteRootPath();
+         ancestor = ancestor.GetParentPath()) {
+        const auto found = result.renamedPaths.find(ancestor);
+        if (found != result.renamedPaths.end())
+            renamed = found;
     }
+
+    if (renamed == result.renamedPaths.end())
+        return;
+
+    const SdfPath& oldPath = renamed->first;
+    const SdfPath& newPath = renamed->second;
+    SdfPath        renamedPath = pathToVerify.ReplacePrefix(oldPath, newPath);
+
+    DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
+        "Renaming path %s to %s",
+        pathToVerify.GetAsString().c_str(),
+        renamedPath.GetAsString().c_str()));
+
+    pathToVerify = renamedPath;
 }
 
 // Verify if the given path has already been copied.
 bool isAlreadyCopied(const SdfPath& pathToVerify, MayaUsd::CopyLayerPrimsResult& result)
 {
-    for (const auto& srcAndDest : result.copiedPaths) {
-        const SdfPath& alreadyDone = srcAndDest.first;
-        if (pathToVerify.HasPrefix(alreadyDone)) {
-            DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
-                "Already copied source prim %s, skipping additional copies",
-                pathToVerify.GetAsString().c_str()));
-            return true;
-        }
-    }
-    return false;
+    if (findClosestAncestor(result.copiedPaths, pathToVerify) == result.copiedPaths.end())
+        return false;
+
+    DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
+        "Already copied source prim %s, skipping additional copies",
+        pathToVerify.GetAsString().c_str()));
+    return true;
 }
 
 bool isPrimType(const UsdStageRefPtr& stage, const SdfPath& path, const TfToken& desiredType)
@@ -180,7 +199,9 @@ bool isPrimScope(const UsdStageRefPtr& stage, const SdfPath& path)
 // Prim hierarchy traverser (a function called for every SdfSpec starting
 // from a prim to be copied, recursively) that copies each prim encountered
 // and optionally adds the targets of relationships to the list of other paths
-// to also be copied.
+// to also be copied. The source relationships and connections are recorded in
+// targetingPaths, so that their copies can be renamed without traversing the
+// destination again.
 //
 // Note: returning false means to prune traversing children.
 bool copyTraverser(
@@ -191,6 +212,7 @@ bool copyTraverser(
     const SdfLayerRefPtr&                 dstLayer,
     const SdfPath&                        dstParentPath,
     std::vector<SdfPath>&                 otherPathsToCopy,
+    std::set<SdfPath>&                    targetingPaths,
     const MayaUsd::CopyLayerPrimsOptions& options,
     const SdfPath&                        pathToCopy,
     MayaUsd::CopyLayerPrimsResult&        result)
@@ -198,6 +220,9 @@ bool copyTraverser(
     // Check if the path is a relationship target path. If so, we optionally copy
     // the target since it is used by the prim containing this relationship.
     if (pathToCopy.IsTargetPath()) {
+        // Note: the parent path of a targeting path is the relationship or connection.
+        targetingPaths.insert(pathToCopy.GetParentPath());
+
         if (options.followRelationships) {
             const SdfPath& targetPath = pathToCopy.GetTargetPath();
             if (!targetPath.IsEmpty()) {
@@ -264,6 +289,7 @@ bool copyTraverser(
                     dstLayer,
                     dstChildParentPath,
                     otherPathsToCopy,
+                    targetingPaths,
                     options,
                     childPathToCopy,
                     result)) {
@@ -310,6 +336,7 @@ auto makeCopyTraverser(
     const SdfLayerRefPtr&                 dstLayer,
     const SdfPath&                        dstParentPath,
     std::vector<SdfPath>&                 otherPathsToCopy,
+    std::set<SdfPath>&                    targetingPaths,
     const MayaUsd::CopyLayerPrimsOptions& options,
     MayaUsd::CopyLayerPrimsResult&        result)
 {
@@ -320,6 +347,7 @@ auto makeCopyTraverser(
                    &dstLayer,
                    &dstParentPath,
                    &otherPathsToCopy,
+                   &targetingPaths,
                    &options,
                    &result](const SdfPath& pathToCopy) -> bool {
         return copyTraverser(
@@ -330,6 +358,7 @@ auto makeCopyTraverser(
             dstLayer,
             dstParentPath,
             otherPathsToCopy,
+            targetingPaths,
             options,
             pathToCopy,
             result);
@@ -337,102 +366,97 @@ auto makeCopyTraverser(
     return copyFn;
 }
 
-// Prim hierarchy traverser (a function called for every SdfSpec starting
-// from a prim to be copied, recursively) that finds every targeting paths.
-bool findTargetingPathsTraverser(
-    const UsdStageRefPtr& dstStage,
-    const SdfPath&        layerSpecPath,
-    std::set<SdfPath>&    targetingPaths)
+// Rename the items of the given list op that need to be renamed based on the
+// known list of renamed prims. Returns true if any item was renamed.
+bool renameListOpItems(SdfPathListOp& listOp, const MayaUsd::CopyLayerPrimsResult& result)
 {
-    // We're only interested in targeting paths.
-    if (!layerSpecPath.IsTargetPath())
-        return true;
-
-    SdfPath targetPath = layerSpecPath.GetTargetPath();
-
-    if (targetingPaths.count(layerSpecPath))
-        return true;
-
-    DEBUG_LOG_COPY_LAYER_PRIMS(
-        TfStringPrintf("Found targeting property %s", layerSpecPath.GetAsString().c_str()));
-
-    targetingPaths.insert(layerSpecPath);
-
-    return true;
-}
-
-// Function to create a find-targeting-path traverser functor that can take
-// a single argument: the path to process. Used to create the function that
-// can be called by the traverseLayer function.
-auto makeFindTargetingPathsTraverser(
-    const UsdStageRefPtr& dstStage,
-    std::set<SdfPath>&    targetingPaths)
-{
-    auto findTargetingFn = [&dstStage, &targetingPaths](const SdfPath& layerSpecPath) -> bool {
-        return findTargetingPathsTraverser(dstStage, layerSpecPath, targetingPaths);
+    static const SdfListOpType explicitTypes[] = { SdfListOpTypeExplicit };
+    static const SdfListOpType editTypes[]
+        = { SdfListOpTypeAdded,    SdfListOpTypeDeleted,   SdfListOpTypeOrdered,
+            SdfListOpTypePrepended, SdfListOpTypeAppended };
+
+    // Note: setting explicit items makes the list op explicit, so only the
+    //       items that are in use are verified.
+    bool renamed = false;
+    auto renameItems = [&listOp, &result, &renamed](SdfListOpType type) {
+        SdfPathVector items = listOp.GetItems(type);
+        bool          itemsRenamed = false;
+        for (SdfPath& item : items) {
+            const SdfPath oldItem = item;
+            renamePath(item, result);
+            itemsRenamed |= (item != oldItem);
+        }
+        if (itemsRenamed) {
+            listOp.SetItems(items, type);
+            renamed = true;
+        }
     };
-    return findTargetingFn;
-}
 
-// Verify if each target needs to be renamed and rename them if needed.
-void renameTargets(SdfPathVector& targets, const MayaUsd::CopyLayerPrimsResult& result)
-{
-    for (auto& target : targets) {
-        renamePath(target, result);
+    if (listOp.IsExplicit()) {
+        for (SdfListOpType type : explicitTypes)
+            renameItems(type);
+    } else {
+        for (SdfListOpType type : editTypes)
+            renameItems(type);
     }
+
+    return renamed;
 }
 
-// Verify if the targets of the given targeting path need to be renamed based on
-// the known list of renamed prims and rename them if needed.
-void renameTargetingPath(
-    const UsdStageRefPtr&                dstStage,
-    const SdfPath&                       layerSpecPath,
+// Rename the targets of the copies of the given source targeting properties
+// based on the known list of renamed prims.
+//
+// The targets are edited directly in the destination layer specs: the renamed
+// targets are computed in parallel, since that only reads the layer, and then
+// authored together in a single change block.
+void renameTargetingPaths(
+    const SdfLayerRefPtr&                dstLayer,
+    const std::set<SdfPath>&             srcTargetingPaths,
     const MayaUsd::CopyLayerPrimsResult& result)
 {
-    // We're only interested in targeting paths.
-    if (!layerSpecPath.IsTargetPath())
+    if (result.renamedPaths.empty())
         return;
 
-#ifdef DEBUG_COPY_LAYER_PRIMS
-    SdfPath targetPath = layerSpecPath.GetTargetPath();
-    DEBUG_LOG_COPY_LAYER_PRIMS(
-        TfStringPrintf("Verifying renaming for %s target path", targetPath.GetAsString().c_str()));
-#endif
-
-    // Determine if we have a relationship target or an attribute connection.
-    // Note: the parent path of a targeting path is the relationship or connection.
-    const SdfPath primPath = layerSpecPath.GetPrimOrPrimVariantSelectionPath();
-    UsdPrim       prim = dstStage->GetPrimAtPath(primPath);
-    const SdfPath targetingPath = layerSpecPath.GetParentPath();
+    // Find where each targeting property was copied.
+    std::vector<SdfPath> dstTargetingPaths;
+    dstTargetingPaths.reserve(srcTargetingPaths.size());
+    for (const SdfPath& srcPath : srcTargetingPaths) {
+        const auto copied = findClosestAncestor(result.copiedPaths, srcPath);
+        if (copied == result.copiedPaths.end())
+            continue;
+        dstTargetingPaths.emplace_back(srcPath.ReplacePrefix(copied->first, copied->second));
+    }
 
-    DEBUG_LOG_COPY_LAYER_PRIMS(TfStringPrintf(
-        "Prim %s containing targeting property %s",
-        primPath.GetAsString().c_str(),
-        targetingPath.GetAsString().c_str()));
+    struct RenamedTargets
+    {
+        TfToken       field;
+        SdfPathListOp targets;
+        bool          renamed = false;
+    };
+    std::vector<RenamedTargets> renamedTargets(dstTargetingPaths.size());
+
+    WorkParallelForN(dstTargetingPaths.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const SdfPath& targetingPath = dstTargetingPaths[i];
+
+            // Determine if we have a relationship target or an attribute connection.
+            RenamedTargets& renamed = renamedTargets[i];
+            switch (dstLayer->GetSpecType(targetingPath)) {
+            case SdfSpecTypeRelationship: renamed.field = SdfFieldKeys->TargetPaths; break;
+            case SdfSpecTypeAttribute: renamed.field = SdfFieldKeys->ConnectionPaths; break;
+            default: continue;
+            }
 
-    // Adjust all targets that were referring to prims that were renamed.
-    //
-    // Note: we could *almost* use a UsdProperty, which is the base class of
-    //       both UsdRelationship and UsdAttribute. It has a _GetTargets()
-    //       function... but this function is protected! How unfortunate...
-    //       So instead we have two almost identical branches.
-    UsdRelationship rel = prim.GetRelationshipAtPath(targetingPath);
-    if (rel) {
-        // Modify all targets that were using the old path to now use the new path.
-        SdfPathVector targets;
-        rel.GetTargets(&targets);
-        renameTargets(targets, result);
-        rel.SetTargets(targets);
-    } else {
-        // Retrieve the attribute so we can modify its targets.
-        auto attr = prim.GetAttributeAtPath(targetingPath);
-        if (attr) {
-            // Modify all targets that were using the old path to now use the new path.
-            SdfPathVector targets;
-            attr.GetConnections(&targets);
-            renameTargets(targets, result);
-            attr.SetConnections(targets);
+            renamed.targets = dstLayer->GetFieldAs<SdfPathListOp>(targetingPath, renamed.field);
+            renamed.renamed = renameListOpItems(renamed.targets, result);
         }
+    });
+
+    SdfChangeBlock changeBlock;
+    for (size_t i = 0; i < dstTargetingPaths.size(); ++i) {
+        const RenamedTargets& renamed = renamedTargets[i];
+        if (renamed.renamed)
+            dstLayer->SetField(dstTargetingPaths[i], renamed.field, renamed.targets);
     }
 }
 
@@ -464,6 +488,10 @@ CopyLayerPrimsResult copyLayerPrims(
     // and connections to the list, to copy the related prims.
     std::vector<SdfPath> otherPathsToCopy = primsToCopy;
 
+    // The relationships and connections found in the copied prims. Their copies
+    // may need their targets to be renamed.
+    std::set<SdfPath> targetingPaths;
+
     auto copyFn = makeCopyTraverser(
         srcStage,
         srcLayer,
@@ -472,6 +500,7 @@ CopyLayerPrimsResult copyLayerPrims(
         dstLayer,
         dstParentPath,
         otherPathsToCopy,
+        targetingPaths,
         options,
         result);
 
@@ -484,6 +513,10 @@ CopyLayerPrimsResult copyLayerPrims(
     //       For the same reason, the otherPathsToCopy container can be resized
     //       and its value moved to a new memory location, so that is why
     //       the path we pass to the traverseLayer function is taken by value.
+    //
+    //       The copies must be done one after the other, since the unique
+    //       destination names and the merging of scopes depend on the
+    //       prims already copied.
     addProgressSteps(options, otherPathsToCopy.size());
     for (size_t i = 0; i < otherPathsToCopy.size(); ++i) {
         const SdfPath srcPath = otherPathsToCopy[i];
@@ -491,29 +524,14 @@ CopyLayerPrimsResult copyLayerPrims(
         advanceProgress(options);
     }
 
-    // Traverse again the destination prims to find all targeting properties
-    // so that we can rename their targets if necessary.
-    std::set<SdfPath> targetingPaths;
-
-    auto findTargetingsFn = makeFindTargetingPathsTraverser(dstStage, targetingPaths);
-
-    addProgressSteps(options, result.copiedPaths.size());
-    for (const auto& srcAndDest : result.copiedPaths) {
-        const SdfPath& dstPath = srcAndDest.second;
-        traverseLayer(dstLayer, dstPath, findTargetingsFn);
-        advanceProgress(options);
-    }
-
     DEBUG_LOG_COPY_LAYER_PRIMS(
         TfStringPrintf("Found %d targeting path.", int(targetingPaths.size())));
 
-    // Rename each target of the given list of targeting paths when they need
+    // Rename each target of the copied targeting properties when they need
     // to be renamed based on the known list of renamed prims.
-    addProgressSteps(options, targetingPaths.size());
-    for (const SdfPath& layerSpecPath : targetingPaths) {
-        renameTargetingPath(dstStage, layerSpecPath, result);
-        advanceProgress(options);
-    }
+    addProgressSteps(options, 1);
+    renameTargetingPaths(dstLayer, targetingPaths, result);
+    advanceProgress(options);
 
     return result;
 }
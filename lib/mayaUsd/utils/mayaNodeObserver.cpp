@@ -21,12 +21,301 @@
 #include <maya/MFnDependencyNode.h>
 #include <maya/MNodeMessage.h>
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace MAYAUSD_NS_DEF {
 
 MAYAUSD_VERIFY_CLASS_NOT_MOVE_OR_COPY(MayaNodeObserver);
 
+namespace {
+
+struct ObjectHandleHasher
+{
+    unsigned long operator()(const MObjectHandle& handle) const { return handle.hashCode(); }
+};
+
+MString fullPathOf(const MObject& node)
+{
+    MDagPath path;
+    MDagPath::getAPathTo(node, path);
+    return path.fullPathName();
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////
+//
+// Dispatcher of the Maya notifications to all the node observers.
+//
+// It registers the global name changed, parent added and parent removed
+// callbacks and one plug dirty callback per observed node or ancestor, and
+// maps each of these nodes to the observers watching it. Observing thousands
+// of nodes thus does not register thousands of callbacks per node of their
+// shared hierarchy.
+//
+// When a node is parented or unparented, the observations of the nodes below
+// it are updated right away: their new ancestors are watched and their former
+// ancestors are no longer watched, so no notification is missed or received
+// from a node that is no longer an ancestor.
+//
+// The notifications are dispatched synchronously, since listeners act on them
+// right away. Dispatching a plug dirty notification to thousands of observers
+// neither copies them nor computes thousands of paths: the observers are
+// notified from a snapshot that is only rebuilt when they change, and the
+// path of the dirtied node is computed once to tell the observers whether
+// their own path needs to be checked.
+
+class MayaNodeObserverDispatcher
+{
+public:
+    static MayaNodeObserverDispatcher& instance();
+
+    //! Watch the given nodes for the observer, instead of the ones it was watching.
+    void watch(MayaNodeObserver& observer, std::vector<MObject>& nodes);
+
+    //! Stop watching all nodes for the observer.
+    void unwatch(MayaNodeObserver& observer);
+
+private:
+    using ObserverSnapshot = std::shared_ptr<const std::vector<MayaNodeObserver*>>;
+
+    struct WatchedNode
+    {
+        MCallbackId                           plugDirtyCallbackId = 0;
+        std::unordered_set<MayaNodeObserver*> observers;
+
+        // Observers to notify, reset when they change and rebuilt on the next notification.
+        ObserverSnapshot snapshot;
+
+        // Full path of the node when last notified of a plug dirty.
+        MString path;
+    };
+
+    using WatchedNodeMap = std::unordered_map<MObjectHandle, WatchedNode, ObjectHandleHasher>;
+
+    bool addWatch(MayaNodeObserver& observer, MObject& node);
+    void removeWatch(MayaNodeObserver& observer, const MObjectHandle& handle);
+
+    ObserverSnapshot observersOf(const MObjectHandle& handle);
+    bool isWatching(const MObjectHandle& handle, MayaNodeObserver* observer) const;
+
+    template <typename NOTIFY> void notifyObservers(const MObjectHandle& handle, NOTIFY notify);
+
+    static void processNodeRenamed(MObject& node, const MString& oldName, void* clientData);
+    static void processParentAdded(MDagPath& child, MDagPath& parent, void* clientData);
+    static void processParentRemoved(MDagPath& child, MDagPath& parent, void* clientData);
+    static void processPlugDirty(MObject& node, MPlug& plug, void* clientData);
+
+    WatchedNodeMap           _watchedNodes;
+    std::vector<MCallbackId> _globalCallbackIds;
+};
+
+/* static */
+MayaNodeObserverDispatcher& MayaNodeObserverDispatcher::instance()
+{
+    // Note: never destroyed, so that observers destroyed with the plugin
+    //       static data can still stop observing.
+    static MayaNodeObserverDispatcher* dispatcher = new MayaNodeObserverDispatcher;
+    return *dispatcher;
+}
+
+void MayaNodeObserverDispatcher::watch(MayaNodeObserver& observer, std::vector<MObject>& nodes)
+{
+    // Note: the new nodes are watched before the previous ones are removed
+    //       so that the callbacks of the nodes still watched are kept.
+    std::vector<MObjectHandle> previousNodes;
+    previousNodes.swap(observer._watchedNodes);
+
+    std::unordered_set<MObjectHandle, ObjectHandleHasher> watchedNodes;
+    for (MObject& node : nodes) {
+        MObjectHandle handle(node);
+        if (!watchedNodes.insert(handle).second)
+            continue;
+        addWatch(observer, node);
+        observer._watchedNodes.push_back(handle);
+    }
+
+    for (const MObjectHandle& handle : previousNodes)
+        if (watchedNodes.count(handle) == 0)
+            removeWatch(observer, handle);
+}
+
+void MayaNodeObserverDispatcher::unwatch(MayaNodeObserver& observer)
+{
+    std::vector<MObjectHandle> previousNodes;
+    previousNodes.swap(observer._watchedNodes);
+    for (const MObjectHandle& handle : previousNodes)
+        removeWatch(observer, handle);
+}
+
+bool MayaNodeObserverDispatcher::addWatch(MayaNodeObserver& observer, MObject& node)
+{
+    if (node.isNull())
+        return false;
+
+    MObjectHandle handle(node);
+    auto          iter = _watchedNodes.find(handle);
+    if (iter == _watchedNodes.end()) {
+        if (_watchedNodes.empty()) {
+            MObject allNodes;
+            _globalCallbackIds.push_back(
+                MNodeMessage::addNameChangedCallback(allNodes, processNodeRenamed, this));
+            _globalCallbackIds.push_back(
+                MDagMessage::addParentAddedCallback(processParentAdded, this));
+            _globalCallbackIds.push_back(
+                MDagMessage::addParentRemovedCallback(processParentRemoved, this));
+        }
+
+        iter = _watchedNodes.emplace(handle, WatchedNode()).first;
+        iter->second.plugDirtyCallbackId
+            = MNodeMessage::addNodeDirtyPlugCallback(node, processPlugDirty, this);
+        iter->second.path = fullPathOf(node);
+    }
+
+    if (!iter->second.observers.insert(&observer).second)
+        return false;
+
+    iter->second.snapshot.reset();
+    return true;
+}
+
+void MayaNodeObserverDispatcher::removeWatch(
+    MayaNodeObserver&    observer,
+    const MObjectHandle& handle)
+{
+    auto iter = _watchedNodes.find(handle);
+    if (iter == _watchedNodes.end())
+        return;
+
+    if (iter->second.observers.erase(&observer) == 0)
+        return;
+
+    iter->second.snapshot.reset();
+    if (!iter->second.observers.empty())
+        return;
+
+    MayaNodeObserver::removeCallbackId(iter->second.plugDirtyCallbackId);
+    _watchedNodes.erase(iter);
+
+    if (_watchedNodes.empty())
+        MayaNodeObserver::removeCallbackIds(_globalCallbackIds);
+}
+
+MayaNodeObserverDispatcher::ObserverSnapshot
+MayaNodeObserverDispatcher::observersOf(const MObjectHandle& handle)
+{
+    // Note: the snapshot is shared rather than copied for each notification.
+    //       Notifying observers can add or remove observers, which replaces
+    //       the snapshot of the node, but not the one being notified.
+    const auto iter = _watchedNodes.find(handle);
+    if (iter == _watchedNodes.end())
+        return {};
+
+    WatchedNode& watched = iter->second;
+    if (!watched.snapshot) {
+        watched.snapshot = std::make_shared<const std::vector<MayaNodeObserver*>>(
+            watched.observers.begin(), watched.observers.end());
+    }
+    return watched.snapshot;
+}
+
+bool MayaNodeObserverDispatcher::isWatching(
+    const MObjectHandle& handle,
+    MayaNodeObserver*    observer) const
+{
+    const auto iter = _watchedNodes.find(handle);
+    return iter != _watchedNodes.end() && iter->second.observers.count(observer) > 0;
+}
+
+template <typename NOTIFY>
+void MayaNodeObserverDispatcher::notifyObservers(const MObjectHandle& handle, NOTIFY notify)
+{
+    const ObserverSnapshot observers = observersOf(handle);
+    if (!observers)
+        return;
+
+    // Observers that stopped watching the node while notifying are skipped.
+    for (MayaNodeObserver* observer : *observers)
+        if (isWatching(handle, observer))
+            notify(*observer);
+}
+
+/* static */
+void MayaNodeObserverDispatcher::processNodeRenamed(
+    MObject&       node,
+    const MString& oldName,
+    void*          clientData)
+{
+    auto self = static_cast<MayaNodeObserverDispatcher*>(clientData);
+    if (!self)
+        return;
+
+    self->notifyObservers(MObjectHandle(node), [&node, &oldName](MayaNodeObserver& observer) {
+        observer.processNodeRenamed(node, oldName);
+    });
+}
+
+/* static */
+void MayaNodeObserverDispatcher::processParentAdded(
+    MDagPath& childPath,
+    MDagPath& parentPath,
+    void*     clientData)
+{
+    auto self = static_cast<MayaNodeObserverDispatcher*>(clientData);
+    if (!self)
+        return;
+
+    self->notifyObservers(
+        MObjectHandle(childPath.node()), [&childPath, &parentPath](MayaNodeObserver& observer) {
+            observer.processParentAdded(childPath, parentPath);
+        });
+}
+
+/* static */
+void MayaNodeObserverDispatcher::processParentRemoved(
+    MDagPath& childPath,
+    MDagPath& /*parentPath*/,
+    void*     clientData)
+{
+    auto self = static_cast<MayaNodeObserverDispatcher*>(clientData);
+    if (!self)
+        return;
+
+    // Stop watching the former ancestors even if the node is never parented
+    // again, for example when it is deleted.
+    self->notifyObservers(MObjectHandle(childPath.node()), [](MayaNodeObserver& observer) {
+        observer.updateObserving();
+    });
+}
+
+/* static */
+void MayaNodeObserverDispatcher::processPlugDirty(MObject& node, MPlug& plug, void* clientData)
+{
+    auto self = static_cast<MayaNodeObserverDispatcher*>(clientData);
+    if (!self)
+        return;
+
+    // The paths of the observed nodes can only have changed along with the path
+    // of the dirtied node, which is thus computed once for all the observers.
+    const MObjectHandle handle(node);
+    const auto          iter = self->_watchedNodes.find(handle);
+    if (iter == self->_watchedNodes.end())
+        return;
+
+    MString    path = fullPathOf(node);
+    const bool pathChanged = (path != iter->second.path);
+    if (pathChanged)
+        iter->second.path = path;
+
+    self->notifyObservers(handle, [&node, &plug, pathChanged](MayaNodeObserver& observer) {
+        observer.processPlugDirty(node, plug, pathChanged);
+    });
+}
+
 ////////////////////////////////////////////////////////////////////////////
 //
 // External listener called when Maya notifications are received.
@@ -69,27 +358,16 @@ void MayaNodeObserver::startObserving(const MObject& observedNode)
 
     _observedNode = observedNode;
 
-    updateRenameCallbacks();
-    updateAncestorCallbacks();
-    updateDagPathCallbacks();
+    updateObserving();
 }
 
 void MayaNodeObserver::stopObserving()
 {
-    removeRenameCallbacks();
-    removeDagPathCallbacks();
-    removeAncestorCallbacks();
+    MayaNodeObserverDispatcher::instance().unwatch(*this);
 
     _observedNode = MObject();
 }
 
-void MayaNodeObserver::updateObserving()
-{
-    updateRenameCallbacks();
-    updateAncestorCallbacks();
-    updateDagPathCallbacks();
-}
-
 ////////////////////////////////////////////////////////////////////////////
 //
 // Listener management.
@@ -97,13 +375,35 @@ void MayaNodeObserver::updateObserving()
 void MayaNodeObserver::addListener(Listener& listener)
 {
     // Start tracking and calling the given listener.
-    _listeners.insert(&listener);
+    if (std::find(_listeners.begin(), _listeners.end(), &listener) == _listeners.end())
+        _listeners.push_back(&listener);
 }
 
 void MayaNodeObserver::removeListener(Listener& listener)
 {
     // Stop tracking and calling the given listener.
-    _listeners.erase(&listener);
+    auto iter = std::find(_listeners.begin(), _listeners.end(), &listener);
+    if (iter == _listeners.end())
+        return;
+
+    if (_notifyingDepth > 0)
+        *iter = nullptr;
+    else
+        _listeners.erase(iter);
+}
+
+template <typename NOTIFY> void MayaNodeObserver::notifyListeners(NOTIFY notify)
+{
+    // Note: listeners added while notifying are only called on the next
+    //       notification, and listeners removed are no longer called.
+    const size_t listenerCount = _listeners.size();
+    ++_notifyingDepth;
+    for (size_t i = 0; i < listenerCount; ++i)
+        if (Listener* listener = _listeners[i])
+            notify(*listener);
+    if (--_notifyingDepth == 0)
+        _listeners.erase(
+            std::remove(_listeners.begin(), _listeners.end(), nullptr), _listeners.end());
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -127,7 +427,7 @@ void MayaNodeObserver::removeCallbackId(MCallbackId& callbackId)
 
 ////////////////////////////////////////////////////////////////////////////
 //
-// Maya callbacks registration and cleanup.
+// Observed nodes update.
 
 static void doForNodeAndAncestors(MObject& node, std::function<void(MObject&, MDagPath&)> func)
 {
@@ -159,59 +459,30 @@ static void doForNodeAndAncestors(MObject& node, std::function<void(MObject&, MD
     }
 }
 
-void MayaNodeObserver::updateRenameCallbacks()
-{
-    removeRenameCallbacks();
-
-    // We need to observe name change in the node and any ancestor.
-    // This is to support listeners that track the node by full path
-    // and need to update data related to this full path.
-    doForNodeAndAncestors(_observedNode, [this](MObject& obj, MDagPath& /*dag*/) {
-        _renameCallbackIds.push_back(
-            MNodeMessage::addNameChangedCallback(obj, processNodeRenamed, this));
-    });
-}
-
-void MayaNodeObserver::removeRenameCallbacks() { removeCallbackIds(_renameCallbackIds); }
-
-void MayaNodeObserver::updateDagPathCallbacks()
+void MayaNodeObserver::updateObserving()
 {
-    removeDagPathCallbacks();
-
-    // We need to observe parenting change in the node and any ancestor.
-    // This is to support listeners that track the node by full path
-    // and need to update data related to this full path.
-    doForNodeAndAncestors(_observedNode, [this](MObject& /*obj*/, MDagPath& dag) {
-        _parentAddedCallbackIds.push_back(
-            MDagMessage::addParentAddedDagPathCallback(dag, processParentAdded, this));
-    });
+    updateObservedPath();
+
+    // We need to observe name, parenting and plug changes in the node and
+    // any ancestor. This is to support listeners that track the node by full
+    // path and need to update data related to this full path.
+    std::vector<MObject> nodes;
+    doForNodeAndAncestors(
+        _observedNode, [&nodes](MObject& obj, MDagPath& /*dag*/) { nodes.push_back(obj); });
+    MayaNodeObserverDispatcher::instance().watch(*this, nodes);
 }
 
-void MayaNodeObserver::removeDagPathCallbacks() { removeCallbackIds(_parentAddedCallbackIds); }
-
-void MayaNodeObserver::updateAncestorCallbacks()
+void MayaNodeObserver::updateObservedPath()
 {
-    removeAncestorCallbacks();
-
-    // Remember the path for which we are accumulating the listener
-    {
-        MDagPath ancestorPath;
-        MDagPath::getAPathTo(_observedNode, ancestorPath);
-        _ancestorCallbacksPath = ancestorPath.fullPathName();
-    }
-
-    // Add listener for all the ancestors
-    doForNodeAndAncestors(_observedNode, [this](MObject& obj, MDagPath& /*dag*/) {
-        _ancestorCallbackIds.push_back(
-            MNodeMessage::addNodeDirtyPlugCallback(obj, processPlugDirty, this));
-    });
+    // Remember the path for which we are observing the ancestors.
+    MDagPath observedPath;
+    MDagPath::getAPathTo(_observedNode, observedPath);
+    _observedPath = observedPath.fullPathName();
 }
 
-void MayaNodeObserver::removeAncestorCallbacks() { removeCallbackIds(_ancestorCallbackIds); }
-
 ////////////////////////////////////////////////////////////////////////////
 //
-// Maya callbacks processing and forwarding to listeners.
+// Maya notifications processing and forwarding to listeners.
 
 namespace {
 
@@ -232,81 +503,60 @@ template <typename T> struct AutoValueRestore
 
 } // namespace
 
-/* static */
-void MayaNodeObserver::processPlugDirty(MObject& node, MPlug& plug, void* clientData)
+void MayaNodeObserver::processPlugDirty(MObject& node, MPlug& plug, bool nodePathChanged)
 {
-    auto self = static_cast<MayaNodeObserver*>(clientData);
-    if (!self)
-        return;
-
     // This prevents recursion.
-    if (self->_inAncestorCallback)
+    if (_inAncestorCallback)
         return;
 
-    AutoValueRestore<bool> restoreInAncestor(self->_inAncestorCallback, true);
-
-    // Note: we make a copy of the set of listeners in case calling
-    //       a listener adds or remove listeners.
-    const auto cachedListeners = self->_listeners;
+    AutoValueRestore<bool> restoreInAncestor(_inAncestorCallback, true);
 
-    // If the observed node's path has changed, update ancestor listener
-    // and the DAG listener.
-    MDagPath currentPath;
-    MDagPath::getAPathTo(self->_observedNode, currentPath);
-    const bool pathChanged = (currentPath.fullPathName() != self->_ancestorCallbacksPath);
+    // If the observed node's path has changed, update the observation.
+    bool pathChanged = false;
+    if (nodePathChanged) {
+        MDagPath currentPath;
+        MDagPath::getAPathTo(_observedNode, currentPath);
+        pathChanged = (currentPath.fullPathName() != _observedPath);
+    }
     if (pathChanged) {
         // Note: we need to copy the old name before calling processNodeRename
         //       because it will call the updateObserving function which will
-        //       change the _ancestorCallbacksPath value.
-        const MString oldName = self->_ancestorCallbacksPath;
-        self->processNodeRenamed(self->_observedNode, oldName, clientData);
+        //       change the _observedPath value.
+        const MString oldName = _observedPath;
+        processNodeRenamed(_observedNode, oldName);
     }
 
-    for (Listener* cb : cachedListeners)
-        cb->processPlugDirty(self->_observedNode, node, plug, pathChanged);
+    notifyListeners([this, &node, &plug, pathChanged](Listener& listener) {
+        listener.processPlugDirty(_observedNode, node, plug, pathChanged);
+    });
 }
 
-/* static */
-void MayaNodeObserver::processNodeRenamed(
-    MObject& /*node*/,
-    const MString& oldName,
-    void*          clientData)
+void MayaNodeObserver::processNodeRenamed(MObject& renamedNode, const MString& oldName)
 {
-    auto self = static_cast<MayaNodeObserver*>(clientData);
-    if (!self)
-        return;
-
     // Nodes only have a proper DAG path once renamed.
-    // So, on rename, we update the listener.
+    // So, on rename, we update the observation of the node.
     // Note that even then, they might still not have a parent...
     // So we will again possibly update on reparenting.
-    self->updateObserving();
-
-    // Note: we make a copy of the set of listeners in case calling
-    //       a listener adds or remove listeners.
-    const auto cachedListeners = self->_listeners;
-    for (Listener* cb : cachedListeners)
-        cb->processNodeRenamed(self->_observedNode, oldName);
+    //
+    // Renaming an ancestor only changes the path of the node.
+    if (renamedNode == _observedNode)
+        updateObserving();
+    else
+        updateObservedPath();
+
+    notifyListeners([this, &oldName](Listener& listener) {
+        listener.processNodeRenamed(_observedNode, oldName);
+    });
 }
 
-/* static */
-void MayaNodeObserver::processParentAdded(
-    MDagPath& childPath,
-    MDagPath& parentPath,
-    void*     clientData)
+void MayaNodeObserver::processParentAdded(MDagPath& childPath, MDagPath& parentPath)
 {
-    auto self = static_cast<MayaNodeObserver*>(clientData);
-    if (!self)
-        return;
+    // Reparented: watch the new ancestors and stop watching the former ones.
+    updateObserving();
 
-    // Reparented, so listen to new hierarchy.
-    self->updateObserving();
-
-    // Note: we make a copy of the set of listeners in case calling
-    //       a listener adds or remove listeners.
-    const auto cachedListeners = self->_listeners;
-    for (Listener* cb : cachedListeners)
-        cb->processParentAdded(self->_observedNode, childPath, parentPath);
+    notifyListeners([this, &childPath, &parentPath](Listener& listener) {
+        listener.processParentAdded(_observedNode, childPath, parentPath);
+    });
 }
 
 } // namespace MAYAUSD_NS_DEF
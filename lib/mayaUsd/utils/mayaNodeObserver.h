@@ -21,18 +21,24 @@
 #include <maya/MDagPath.h>
 #include <maya/MMessage.h>
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
 #include <maya/MString.h>
 
-#include <set>
 #include <vector>
 
 namespace MAYAUSD_NS_DEF {
 
+class MayaNodeObserverDispatcher;
+
 //! Observer for a single Maya node that receives notifications when the node is renamed,
 //  reparented, or any of its ancestor is renamed or reparented.
 //
 // It forwards those notifications to listerners.
+//
+// The Maya callbacks are shared by all the observers: the name and parenting
+// changes are received by global callbacks and the plug changes by a single
+// callback per node, whichever number of observers have it as an ancestor.
 class MayaNodeObserver
 {
 public:
@@ -68,7 +74,8 @@ public:
     MAYAUSD_CORE_PUBLIC
     void stopObserving();
 
-    //! Update callbacks for the observed node.
+    //! Update the observation of the node and its ancestors, for example once the node is
+    //  parented.
     MAYAUSD_CORE_PUBLIC
     void updateObserving();
 
@@ -92,31 +99,27 @@ public:
     static void removeCallbackId(MCallbackId& callbackId);
 
 private:
-    void updateRenameCallbacks();
-    void removeRenameCallbacks();
-
-    void updateAncestorCallbacks();
-    void removeAncestorCallbacks();
+    friend class MayaNodeObserverDispatcher;
 
-    void updateDagPathCallbacks();
-    void removeDagPathCallbacks();
+    void updateObservedPath();
 
-    void updateAllNameRelatedCallbacks();
+    template <typename NOTIFY> void notifyListeners(NOTIFY notify);
 
-    static void processNodeRenamed(MObject& observedNode, const MString& str, void* clientData);
-    static void processParentAdded(MDagPath& child, MDagPath& parent, void* clientData);
-    static void processPlugDirty(MObject& dirtiedNode, MPlug& plug, void* clientData);
+    void processNodeRenamed(MObject& renamedNode, const MString& oldName);
+    void processParentAdded(MDagPath& child, MDagPath& parent);
+    void processPlugDirty(MObject& dirtiedNode, MPlug& plug, bool dirtiedNodePathChanged);
 
     MObject _observedNode;
 
-    std::vector<MCallbackId> _renameCallbackIds;
-    std::vector<MCallbackId> _parentAddedCallbackIds;
-    std::vector<MCallbackId> _ancestorCallbackIds;
+    // Node and ancestors observed through the shared dispatcher.
+    std::vector<MObjectHandle> _watchedNodes;
 
-    MString _ancestorCallbacksPath;
+    MString _observedPath;
     bool    _inAncestorCallback = false;
 
-    std::set<Listener*> _listeners;
+    // Listeners removed while notifying are set to null until all are notified.
+    std::vector<Listener*> _listeners;
+    int                    _notifyingDepth = 0;
 };
 
 } // namespace MAYAUSD_NS_DEF
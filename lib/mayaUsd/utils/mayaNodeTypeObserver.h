@@ -23,6 +23,7 @@
 #include <maya/MObjectHandle.h>
 
 #include <memory>
+#include <set>
 #include <unordered_map>
 
 namespace MAYAUSD_NS_DEF {
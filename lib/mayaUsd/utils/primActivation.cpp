@@ -17,8 +17,10 @@
 
 #include <mayaUsd/ufe/Utils.h>
 
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/layer.h>
-#include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/prim.h>
 
 namespace MAYAUSD_NS_DEF {
@@ -27,6 +29,17 @@ PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace {
 
+// Returns true if the strongest opinion of the layer stack deactivates the prim.
+bool isLocallyInactive(const SdfLayerHandleVector& layers, const SdfPath& path)
+{
+    for (const SdfLayerHandle& layer : layers) {
+        VtValue active;
+        if (layer->HasField(path, SdfFieldKeys->Active, &active) && active.IsHolding<bool>())
+            return !active.UncheckedGet<bool>();
+    }
+    return false;
+}
+
 void activate(
     const UsdStagePtr& stage,
     const SdfPath&     path,
@@ -36,9 +49,6 @@ void activate(
     if (!stage)
         return;
 
-    SdfLayerHandle sessionLayer = stage->GetSessionLayer();
-    UsdEditContext editContext(stage, sessionLayer);
-
     // The last prefix is the path itself and we don't need to activate
     // it, so skip processing if there is only one prefix, otherwise
     // remove the last prefix since it is the path and we don't want
@@ -48,21 +58,44 @@ void activate(
         return;
     prefixes.pop_back();
 
-    for (const SdfPath& prefixPath : prefixes) {
-        UsdPrim prim = stage->GetPrimAtPath(prefixPath);
-        if (prim.IsActive())
-            continue;
-
-        // If the prim at the path has a "active" field in the session
-        // layer, then we must remember to set the opinion back to deactivated.
-        // Otherwise, we must remember to clear the opinion we are authoring.
-        if (sessionLayer->HasField(prefixPath, TfToken("active"))) {
-            previouslyInactive.insert(prefixPath);
-        } else {
-            forcedActive.insert(prefixPath);
+    SdfLayerHandle             sessionLayer = stage->GetSessionLayer();
+    const SdfLayerHandleVector layers = stage->GetLayerStack();
+
+    // Activate all the inactive ancestors at once, so that the stage only
+    // recomposes once. The ancestors below an inactive one are not composed,
+    // so whether they are inactive is taken from the opinions of the layer
+    // stack. Opinions coming from other composition arcs, like references,
+    // can only be seen once the ancestors above them are active, so repeat
+    // until no more inactive ancestors are found.
+    while (true) {
+        SdfPathVector inactivePaths;
+        for (const SdfPath& prefixPath : prefixes) {
+            if (previouslyInactive.count(prefixPath) || forcedActive.count(prefixPath))
+                continue;
+
+            UsdPrim    prim = stage->GetPrimAtPath(prefixPath);
+            const bool inactive = prim ? !prim.IsActive() : isLocallyInactive(layers, prefixPath);
+            if (inactive)
+                inactivePaths.push_back(prefixPath);
         }
 
-        prim.SetActive(true);
+        if (inactivePaths.empty())
+            break;
+
+        SdfChangeBlock changeBlock;
+        for (const SdfPath& inactivePath : inactivePaths) {
+            // If the prim at the path has a "active" field in the session
+            // layer, then we must remember to set the opinion back to deactivated.
+            // Otherwise, we must remember to clear the opinion we are authoring.
+            if (sessionLayer->HasField(inactivePath, SdfFieldKeys->Active)) {
+                previouslyInactive.insert(inactivePath);
+            } else {
+                forcedActive.insert(inactivePath);
+            }
+
+            SdfCreatePrimInLayer(sessionLayer, inactivePath);
+            sessionLayer->SetField(inactivePath, SdfFieldKeys->Active, true);
+        }
     }
 }
 
@@ -72,18 +105,19 @@ void deactivate(const UsdStagePtr& stage, SdfPathSet& previouslyInactive, SdfPat
         return;
 
     SdfLayerHandle sessionLayer = stage->GetSessionLayer();
-    UsdEditContext editContext(stage, sessionLayer);
+
+    // Restore all the ancestors at once, so that the stage only recomposes once.
+    SdfChangeBlock changeBlock;
 
     for (const SdfPath& path : previouslyInactive) {
-        UsdPrim prim = stage->GetPrimAtPath(path);
-        prim.SetActive(false);
+        SdfCreatePrimInLayer(sessionLayer, path);
+        sessionLayer->SetField(path, SdfFieldKeys->Active, false);
     }
 
     previouslyInactive.clear();
 
     for (const SdfPath& path : forcedActive) {
-        UsdPrim prim = stage->GetPrimAtPath(path);
-        prim.ClearActive();
+        sessionLayer->EraseField(path, SdfFieldKeys->Active);
     }
 
     forcedActive.clear();
@@ -33,7 +33,9 @@ namespace MAYAUSD_NS_DEF {
 // activate all ancestor, do the modifications, then restore the ancestor
 // activation state.
 //
-// The temporary activations are done in the session layer.
+// The temporary activations are done in the session layer. The ancestors are
+// all activated at once, and all restored at once, so that the stage does not
+// recompose once per ancestor.
 
 class MAYAUSD_CORE_PUBLIC PrimActivation
 {
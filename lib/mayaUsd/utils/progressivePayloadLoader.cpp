@@ -0,0 +1,562 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "progressivePayloadLoader.h"
+
+#include <mayaUsd/nodes/proxyShapeBase.h>
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/range2d.h>
+#include <pxr/base/gf/vec2d.h>
+#include <pxr/base/gf/vec4d.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/ar/resolverContext.h>
+#include <pxr/usd/ar/resolverContextBinder.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/layerUtils.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <maya/MDagPath.h>
+#include <maya/MFnCamera.h>
+#include <maya/MFloatMatrix.h>
+#include <maya/MGlobal.h>
+#include <maya/MMatrix.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MString.h>
+#include <maya/MTimerMessage.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Period of the main-thread timer applying the batches, in seconds.
+constexpr float kTimerPeriod = 0.05f;
+
+// Number of batches whose layers are read ahead of the batch being applied.
+constexpr size_t kReadAheadBatches = 2;
+
+constexpr int kCornerCount = 8;
+
+GfMatrix4d toGf(const MMatrix& matrix) { return GfMatrix4d(matrix.matrix); }
+
+GfMatrix4d toGf(const MFloatMatrix& matrix)
+{
+    GfMatrix4d result;
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            result[row][col] = matrix(row, col);
+        }
+    }
+    return result;
+}
+
+// Returns the fraction of the screen covered by the bounds, or a negative
+// value if the bounds are out of view.
+double computeScreenSize(const GfBBox3d& bound, const GfMatrix4d& stageToClip)
+{
+    const GfRange3d& range = bound.GetRange();
+    const GfMatrix4d toClip = bound.GetMatrix() * stageToClip;
+    GfRange2d        ndcRange;
+    int              behindCount = 0;
+    int              beyondCount = 0;
+    for (int i = 0; i < kCornerCount; ++i) {
+        const GfVec3d corner = range.GetCorner(i);
+        const GfVec4d clip = GfVec4d(corner[0], corner[1], corner[2], 1.0) * toClip;
+        if (clip[3] <= 0.0) {
+            ++behindCount;
+            continue;
+        }
+        if (clip[2] > clip[3]) {
+            ++beyondCount;
+        }
+        ndcRange.UnionWith(GfVec2d(clip[0] / clip[3], clip[1] / clip[3]));
+    }
+
+    if (behindCount == kCornerCount || beyondCount == kCornerCount) {
+        return -1.0;
+    }
+
+    // Bounds straddling the camera plane surround the camera.
+    if (behindCount > 0) {
+        return 1.0;
+    }
+
+    const GfRange2d onScreen
+        = GfRange2d::GetIntersection(ndcRange, GfRange2d(GfVec2d(-1.0), GfVec2d(1.0)));
+    if (onScreen.IsEmpty()) {
+        return -1.0;
+    }
+
+    // The screen is 2 by 2 in normalized device coordinates.
+    const GfVec2d size = onScreen.GetSize();
+    return size[0] * size[1] / 4.0;
+}
+
+std::vector<std::string> collectPayloadLayerPaths(const UsdPrim& prim)
+{
+    std::vector<std::string> layerPaths;
+    for (const SdfPrimSpecHandle& spec : prim.GetPrimStack()) {
+        for (const SdfPayload& payload : spec->GetPayloadList().GetAddedOrExplicitItems()) {
+            // Internal payloads are in layers that are already open.
+            if (payload.GetAssetPath().empty()) {
+                continue;
+            }
+            layerPaths.push_back(
+                SdfComputeAssetPathRelativeToLayer(spec->GetLayer(), payload.GetAssetPath()));
+        }
+    }
+    return layerPaths;
+}
+
+double getHeapMemoryMB()
+{
+    double  memory = 0.0;
+    MStatus status = MGlobal::executeCommand("memory -heapMemory -megaByte", memory);
+    return status ? memory : 0.0;
+}
+
+// What prioritizePayloads() needs to order the payloads exposed by the loaded ones.
+struct PrioritySettings
+{
+    GfMatrix4d    stageToClip;
+    UsdTimeCode   time;
+    TfTokenVector purposes;
+    double        minScreenSize;
+};
+
+// Loads the payloads of a proxy shape in batches on the main thread, while a
+// worker thread reads the layers of the next batches ahead. Opening the layers
+// is the costly part of loading a payload, and it is safe to do on any thread,
+// while the stage can only be modified on the main thread.
+//
+// The payloads are loaded without their descendants, in rounds: once all the
+// payloads of a round are loaded, the nested payloads they exposed are
+// prioritized to make the next round.
+class ProgressivePayloadLoad
+{
+public:
+    ProgressivePayloadLoad(
+        const MObject&                                proxyShape,
+        const UsdStageRefPtr&                         stage,
+        std::vector<MayaUsd::PayloadPriority>&&       priorities,
+        const PrioritySettings&                       prioritySettings,
+        const MayaUsd::ProgressivePayloadLoadOptions& options)
+        : _proxyShape(proxyShape)
+        , _stage(stage)
+        , _resolverContext(stage->GetPathResolverContext())
+        , _prioritySettings(prioritySettings)
+        , _batchSize(static_cast<size_t>(std::max(options.batchSize, 1)))
+        , _memoryLimitMB(options.memoryLimitMB)
+    {
+        startRound(std::move(priorities));
+
+        MStatus status;
+        _timerCallbackId = MTimerMessage::addTimerCallback(kTimerPeriod, onTimer, this, &status);
+        CHECK_MSTATUS(status);
+    }
+
+    ~ProgressivePayloadLoad() { stop(); }
+
+    MAYAUSD_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(ProgressivePayloadLoad);
+
+    bool isLoading() const { return _timerCallbackId != 0; }
+
+    bool isFor(const MObject& proxyShape) const { return _proxyShape.object() == proxyShape; }
+
+    void stop()
+    {
+        if (_timerCallbackId != 0) {
+            MMessage::removeCallback(_timerCallbackId);
+            _timerCallbackId = 0;
+        }
+        stopWorker();
+    }
+
+private:
+    void startRound(std::vector<MayaUsd::PayloadPriority>&& priorities)
+    {
+        _priorities = std::move(priorities);
+        _readAhead.assign(_priorities.size(), {});
+        _readAheadCount = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _nextIndex = 0;
+            _cancelled = false;
+        }
+        _worker = std::thread([this]() { readAhead(); });
+    }
+
+    void stopWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cancelled = true;
+        }
+        _condition.notify_one();
+        if (_worker.joinable()) {
+            _worker.join();
+        }
+    }
+
+    // Start the next round with the payloads exposed by the ones loaded in the
+    // current round. Returns false if no exposed payload is in view.
+    bool startNextRound(const UsdStageRefPtr& stage)
+    {
+        if (_loadedPaths.empty()) {
+            return false;
+        }
+
+        std::vector<MayaUsd::PayloadPriority> priorities = MayaUsd::prioritizePayloads(
+            stage,
+            _loadedPaths,
+            _prioritySettings.stageToClip,
+            _prioritySettings.time,
+            _prioritySettings.purposes,
+            _prioritySettings.minScreenSize);
+        _loadedPaths.clear();
+        if (priorities.empty()) {
+            return false;
+        }
+
+        // The worker thread has read the layers of the whole round, so it is
+        // already done and joining it does not block.
+        stopWorker();
+        startRound(std::move(priorities));
+        return true;
+    }
+
+    static void onTimer(float, float, void* clientData)
+    {
+        static_cast<ProgressivePayloadLoad*>(clientData)->update();
+    }
+
+    void readAhead()
+    {
+        TRACE_FUNCTION();
+
+        ArResolverContextBinder binder(_resolverContext);
+        for (size_t i = 0; i < _priorities.size(); ++i) {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _condition.wait(lock, [this, i]() {
+                    return _cancelled || i < _nextIndex + kReadAheadBatches * _batchSize;
+                });
+                if (_cancelled) {
+                    return;
+                }
+            }
+
+            std::vector<SdfLayerRefPtr> layers;
+            for (const std::string& layerPath : _priorities[i].layerPaths) {
+                if (SdfLayerRefPtr layer = SdfLayer::FindOrOpen(layerPath)) {
+                    layers.push_back(layer);
+                }
+            }
+            _readAhead[i] = std::move(layers);
+            _readAheadCount = i + 1;
+        }
+    }
+
+    void update()
+    {
+        UsdStageRefPtr stage = _stage;
+        if (!stage || !_proxyShape.isValid()) {
+            finish();
+            return;
+        }
+
+        if (_nextIndex >= _priorities.size() && !startNextRound(stage)) {
+            finish();
+            return;
+        }
+
+        if (_memoryLimitMB > 0 && getHeapMemoryMB() >= static_cast<double>(_memoryLimitMB)) {
+            MGlobal::displayWarning(
+                MString("Stopped loading payloads after reaching the memory limit of ")
+                + static_cast<unsigned int>(_memoryLimitMB) + " MB.");
+            finish();
+            return;
+        }
+
+        // Wait for the layers of the batch to be read.
+        const size_t batchEnd = std::min(_nextIndex + _batchSize, _priorities.size());
+        if (_readAheadCount < batchEnd) {
+            return;
+        }
+
+        SdfPathSet loadSet;
+        for (size_t i = _nextIndex; i < batchEnd; ++i) {
+            const UsdPrim prim = stage->GetPrimAtPath(_priorities[i].path);
+            if (prim && !prim.IsLoaded()) {
+                loadSet.insert(_priorities[i].path);
+            }
+        }
+
+        if (!loadSet.empty()) {
+            TRACE_SCOPE("Load payload batch");
+            // The nested payloads are left to the next round, so that they get
+            // prioritized along with the other payloads exposed by this round.
+            stage->LoadAndUnload(loadSet, SdfPathSet(), UsdLoadWithoutDescendants);
+            _loadedCount += loadSet.size();
+            _loadedPaths.insert(loadSet.begin(), loadSet.end());
+        }
+
+        // The stage now holds the layers that were read ahead.
+        for (size_t i = _nextIndex; i < batchEnd; ++i) {
+            _readAhead[i].clear();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _nextIndex = batchEnd;
+        }
+        _condition.notify_one();
+    }
+
+    void finish()
+    {
+        stop();
+        MGlobal::displayInfo(
+            MString("Loaded ") + static_cast<unsigned int>(_loadedCount) + " payloads.");
+    }
+
+    const MObjectHandle     _proxyShape;
+    const UsdStageWeakPtr   _stage;
+    const ArResolverContext _resolverContext;
+    const PrioritySettings  _prioritySettings;
+
+    // Payloads of the current round, in priority order, only modified between
+    // rounds, while no worker thread runs.
+    std::vector<MayaUsd::PayloadPriority> _priorities;
+
+    // Payloads loaded in the current round, whose nested payloads make the next round.
+    SdfPathSet _loadedPaths;
+
+    // Layers read by the worker thread for each payload of the round, in priority order.
+    // An entry is only accessed by the main thread once _readAheadCount covers it.
+    std::vector<std::vector<SdfLayerRefPtr>> _readAhead;
+    std::atomic<size_t>                      _readAheadCount { 0 };
+
+    const size_t _batchSize;
+    const size_t _memoryLimitMB;
+    size_t       _loadedCount { 0 };
+
+    // Index of the first payload of the next batch, and cancellation of the
+    // worker thread, both guarded by _mutex.
+    std::mutex              _mutex;
+    std::condition_variable _condition;
+    size_t                  _nextIndex { 0 };
+    bool                    _cancelled { false };
+
+    std::thread _worker;
+    MCallbackId _timerCallbackId { 0 };
+};
+
+std::vector<std::unique_ptr<ProgressivePayloadLoad>>& progressiveLoads()
+{
+    static std::vector<std::unique_ptr<ProgressivePayloadLoad>> loads;
+    return loads;
+}
+
+// Forget the loads for the proxy shape as well as the completed ones.
+void removeProgressiveLoads(const MObject& proxyShape)
+{
+    auto& loads = progressiveLoads();
+    loads.erase(
+        std::remove_if(
+            loads.begin(),
+            loads.end(),
+            [&proxyShape](const std::unique_ptr<ProgressivePayloadLoad>& load) {
+                return !load->isLoading() || load->isFor(proxyShape);
+            }),
+        loads.end());
+}
+
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+std::vector<PayloadPriority> prioritizePayloads(
+    const UsdStagePtr&   stage,
+    const GfMatrix4d&    stageToClip,
+    UsdTimeCode          time,
+    const TfTokenVector& purposes,
+    double               minScreenSize)
+{
+    return prioritizePayloads(
+        stage,
+        SdfPathSet { SdfPath::AbsoluteRootPath() },
+        stageToClip,
+        time,
+        purposes,
+        minScreenSize);
+}
+
+std::vector<PayloadPriority> prioritizePayloads(
+    const UsdStagePtr&   stage,
+    const SdfPathSet&    rootPaths,
+    const GfMatrix4d&    stageToClip,
+    UsdTimeCode          time,
+    const TfTokenVector& purposes,
+    double               minScreenSize)
+{
+    TRACE_FUNCTION();
+
+    std::vector<PayloadPriority> priorities;
+    if (!stage) {
+        return priorities;
+    }
+
+    // Nested roots share their loadable prims, so gather them in a set.
+    SdfPathSet loadablePaths;
+    for (const SdfPath& rootPath : rootPaths) {
+        for (const SdfPath& path : stage->FindLoadable(rootPath)) {
+            loadablePaths.insert(path);
+        }
+    }
+
+    // The extents hints of the payload prims are the only bounds available
+    // before the payloads are loaded.
+    UsdGeomBBoxCache bboxCache(time, purposes, /*useExtentsHint=*/true);
+
+    for (const SdfPath& path : loadablePaths) {
+        const UsdPrim prim = stage->GetPrimAtPath(path);
+        if (!prim || prim.IsLoaded()) {
+            continue;
+        }
+
+        PayloadPriority priority;
+        priority.path = path;
+
+        const GfBBox3d bound = bboxCache.ComputeWorldBound(prim);
+        if (!bound.GetRange().IsEmpty()) {
+            priority.screenSize = computeScreenSize(bound, stageToClip);
+            if (priority.screenSize < 0.0 || priority.screenSize < minScreenSize) {
+                continue;
+            }
+        }
+
+        priority.layerPaths = collectPayloadLayerPaths(prim);
+        priorities.push_back(std::move(priority));
+    }
+
+    std::stable_sort(
+        priorities.begin(),
+        priorities.end(),
+        [](const PayloadPriority& a, const PayloadPriority& b) {
+            return a.screenSize > b.screenSize;
+        });
+
+    return priorities;
+}
+
+MStatus loadPayloadsProgressively(
+    const MDagPath&                      proxyShapePath,
+    const MDagPath&                      cameraPath,
+    const ProgressivePayloadLoadOptions& options)
+{
+    MayaUsdProxyShapeBase* proxyShape = MayaUsdProxyShapeBase::GetShapeAtDagPath(proxyShapePath);
+    if (!proxyShape) {
+        return MS::kInvalidParameter;
+    }
+
+    UsdStageRefPtr stage = proxyShape->getUsdStage();
+    if (!stage) {
+        return MS::kFailure;
+    }
+
+    MStatus  status;
+    MDagPath cameraShapePath = cameraPath;
+    if (!cameraShapePath.hasFn(MFn::kCamera)) {
+        status = cameraShapePath.extendToShape();
+        CHECK_MSTATUS_AND_RETURN_IT(status);
+    }
+
+    MFnCamera cameraFn(cameraShapePath, &status);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+
+    // Maya and USD both use row vectors, so the matrices compose left to right.
+    const GfMatrix4d stageToWorld = toGf(proxyShapePath.inclusiveMatrix());
+    const GfMatrix4d worldToView = toGf(cameraShapePath.inclusiveMatrixInverse());
+    const GfMatrix4d viewToClip = toGf(cameraFn.projectionMatrix(&status));
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+
+    bool drawRenderPurpose = false;
+    bool drawProxyPurpose = true;
+    bool drawGuidePurpose = false;
+    proxyShape->getDrawPurposeToggles(&drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
+
+    TfTokenVector purposes { UsdGeomTokens->default_ };
+    if (drawRenderPurpose) {
+        purposes.push_back(UsdGeomTokens->render);
+    }
+    if (drawProxyPurpose) {
+        purposes.push_back(UsdGeomTokens->proxy);
+    }
+    if (drawGuidePurpose) {
+        purposes.push_back(UsdGeomTokens->guide);
+    }
+
+    const PrioritySettings prioritySettings { stageToWorld * worldToView * viewToClip,
+                                              proxyShape->getTime(),
+                                              purposes,
+                                              options.minScreenSize };
+
+    std::vector<PayloadPriority> priorities = prioritizePayloads(
+        stage,
+        prioritySettings.stageToClip,
+        prioritySettings.time,
+        prioritySettings.purposes,
+        prioritySettings.minScreenSize);
+
+    removeProgressiveLoads(proxyShapePath.node());
+    if (priorities.empty()) {
+        return MS::kSuccess;
+    }
+
+    progressiveLoads().push_back(std::make_unique<ProgressivePayloadLoad>(
+        proxyShapePath.node(), stage, std::move(priorities), prioritySettings, options));
+    return MS::kSuccess;
+}
+
+bool isLoadingPayloadsProgressively(const MDagPath& proxyShapePath)
+{
+    const MObject proxyShape = proxyShapePath.node();
+    for (const auto& load : progressiveLoads()) {
+        if (load->isFor(proxyShape) && load->isLoading()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void cancelProgressivePayloadLoad(const MDagPath& proxyShapePath)
+{
+    removeProgressiveLoads(proxyShapePath.node());
+}
+
+void cancelAllProgressivePayloadLoads() { progressiveLoads().clear(); }
+
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,128 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_PROGRESSIVE_PAYLOAD_LOADER_H
+#define MAYAUSD_PROGRESSIVE_PAYLOAD_LOADER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <maya/MApiNamespace.h>
+
+#include <string>
+#include <vector>
+
+namespace MAYAUSD_NS_DEF {
+
+/*! \brief an unloaded payload and the fraction of the screen covered by its bounds.
+ */
+struct PayloadPriority
+{
+    PXR_NS::SdfPath path;
+
+    //! Fraction of the screen covered by the bounds, or zero if the payload has no bounds.
+    double screenSize = 0.0;
+
+    //! Resolved paths of the layers brought in by the payloads of the prim.
+    std::vector<std::string> layerPaths;
+};
+
+/*! \brief find the unloaded payloads of the stage that are in view, biggest on screen first.
+ *
+ *  Bounds come from the extents hints authored on the payload prims, since the
+ *  geometry of an unloaded payload is not composed. Payloads without bounds
+ *  cannot be culled and are returned last. Payloads entirely outside of the
+ *  view, or covering less than \p minScreenSize of the screen, are skipped.
+ *
+ *  \param stageToClip the stage-to-world, view and projection matrices combined.
+ *  \param purposes the purposes included in the bounds.
+ */
+MAYAUSD_CORE_PUBLIC
+std::vector<PayloadPriority> prioritizePayloads(
+    const PXR_NS::UsdStagePtr&   stage,
+    const PXR_NS::GfMatrix4d&    stageToClip,
+    PXR_NS::UsdTimeCode          time,
+    const PXR_NS::TfTokenVector& purposes,
+    double                       minScreenSize = 0.0);
+
+/*! \brief find the unloaded payloads at or under the given prims that are in view, biggest on
+ *         screen first.
+ *
+ *  Used to order the payloads exposed by loading other payloads without their
+ *  descendants. See the overload above for the other parameters.
+ */
+MAYAUSD_CORE_PUBLIC
+std::vector<PayloadPriority> prioritizePayloads(
+    const PXR_NS::UsdStagePtr&   stage,
+    const PXR_NS::SdfPathSet&    rootPaths,
+    const PXR_NS::GfMatrix4d&    stageToClip,
+    PXR_NS::UsdTimeCode          time,
+    const PXR_NS::TfTokenVector& purposes,
+    double                       minScreenSize = 0.0);
+
+/*! \brief options of the progressive loading of payloads.
+ */
+struct ProgressivePayloadLoadOptions
+{
+    //! Number of payloads loaded by each call to UsdStage::LoadAndUnload.
+    int batchSize = 16;
+
+    //! Stop loading once the heap memory used by Maya reaches this many megabytes. Zero means
+    //! no limit.
+    size_t memoryLimitMB = 0;
+
+    //! Skip the payloads covering less than this fraction of the screen.
+    double minScreenSize = 0.0;
+};
+
+/*! \brief start loading the payloads of the proxy shape in view of the camera, in batches,
+ *         biggest on screen first.
+ *
+ *  The layers of the payloads are read ahead on a worker thread, while the
+ *  batches are applied on the main thread, between which Maya stays responsive.
+ *  Each payload is loaded without its descendants. Once the payloads in view
+ *  are loaded, the nested payloads they exposed are prioritized and loaded the
+ *  same way, until no payload in view is left.
+ *  Any progressive load already running for the proxy shape is cancelled.
+ */
+MAYAUSD_CORE_PUBLIC
+MStatus loadPayloadsProgressively(
+    const MDagPath&                      proxyShapePath,
+    const MDagPath&                      cameraPath,
+    const ProgressivePayloadLoadOptions& options = ProgressivePayloadLoadOptions());
+
+/*! \brief returns true while payloads of the proxy shape are loaded progressively.
+ */
+MAYAUSD_CORE_PUBLIC
+bool isLoadingPayloadsProgressively(const MDagPath& proxyShapePath);
+
+/*! \brief stop loading the payloads of the proxy shape. Payloads already loaded stay loaded.
+ */
+MAYAUSD_CORE_PUBLIC
+void cancelProgressivePayloadLoad(const MDagPath& proxyShapePath);
+
+/*! \brief stop all progressive loads. Must be called before the plugin is unloaded.
+ */
+MAYAUSD_CORE_PUBLIC
+void cancelAllProgressivePayloadLoads();
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif
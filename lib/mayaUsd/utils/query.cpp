@@ -15,6 +15,7 @@
 //
 #include "query.h"
 
+#include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/nodes/usdPrimProvider.h>
 #include <mayaUsd/utils/util.h>
 
@@ -63,4 +64,38 @@ void UsdMayaQuery::ReloadStage(const std::string& shapeName)
     }
 }
 
+namespace {
+
+MayaUsdProxyShapeBase* GetProxyShape(const std::string& shapeName)
+{
+    MObject shapeObj;
+    MStatus status = UsdMayaUtil::GetMObjectByName(shapeName, shapeObj);
+    CHECK_MSTATUS_AND_RETURN(status, nullptr);
+    MFnDagNode dagNode(shapeObj, &status);
+    CHECK_MSTATUS_AND_RETURN(status, nullptr);
+
+    return dynamic_cast<MayaUsdProxyShapeBase*>(dagNode.userNode());
+}
+
+} // namespace
+
+bool UsdMayaQuery::IsStageLoading(const std::string& shapeName)
+{
+    const MayaUsdProxyShapeBase* proxyShape = GetProxyShape(shapeName);
+    return proxyShape && proxyShape->isStageLoading();
+}
+
+void UsdMayaQuery::CancelStageLoad(const std::string& shapeName)
+{
+    if (MayaUsdProxyShapeBase* proxyShape = GetProxyShape(shapeName)) {
+        proxyShape->cancelStageLoad();
+    }
+}
+
+bool UsdMayaQuery::WaitForStageLoad(const std::string& shapeName)
+{
+    MayaUsdProxyShapeBase* proxyShape = GetProxyShape(shapeName);
+    return proxyShape && proxyShape->waitForStageLoad();
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -35,6 +35,19 @@ struct UsdMayaQuery
     static UsdPrim GetPrim(const std::string& shapeName);
     MAYAUSD_CORE_PUBLIC
     static void ReloadStage(const std::string& shapeName);
+    /*! \brief returns true while the stage of the proxy shape is loaded asynchronously
+     */
+    MAYAUSD_CORE_PUBLIC
+    static bool IsStageLoading(const std::string& shapeName);
+    /*! \brief cancels the asynchronous load of the stage of the proxy shape
+     */
+    MAYAUSD_CORE_PUBLIC
+    static void CancelStageLoad(const std::string& shapeName);
+    /*! \brief waits for the asynchronous load of the stage of the proxy shape to
+        complete. Returns false if the load was cancelled.
+     */
+    MAYAUSD_CORE_PUBLIC
+    static bool WaitForStageLoad(const std::string& shapeName);
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
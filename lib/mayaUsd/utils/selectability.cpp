@@ -19,7 +19,14 @@
 
 #include <usdUfe/base/tokens.h>
 
-#include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/pathTable.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <memory>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -27,60 +34,179 @@ PXR_NAMESPACE_OPEN_SCOPE
  */
 
 namespace {
-// Very simple selectability cache for prims to avoid rechecking the metadata.
-using Data = bool;
-using SelectabilityCache = TfHashMap<UsdPrim, Data, TfHash>;
 
-// Use a function to retrieve the cache, as this exploits the C++ guaranteed
+// Selectability cache for the prims of a stage, to avoid rechecking the metadata of the
+// prims and of their ancestors on every selection. It is kept across selections and
+// invalidated from the stage notices for the subtrees whose selectability may have changed.
+class StageSelectabilityCache : public TfWeakBase
+{
+public:
+    explicit StageSelectabilityCache(const UsdStageWeakPtr& stage)
+        : _stage(stage)
+    {
+        _objectsChangedKey = TfNotice::Register(
+            TfCreateWeakPtr(this), &StageSelectabilityCache::onObjectsChanged, stage);
+    }
+
+    ~StageSelectabilityCache() { TfNotice::Revoke(_objectsChangedKey); }
+
+    bool isExpired() const { return !_stage; }
+
+    bool find(const SdfPath& path, bool* selectable) const
+    {
+        const auto pos = _selectability.find(path);
+        if (pos == _selectability.end() || pos->second == kUnknown)
+            return false;
+
+        *selectable = (pos->second == kSelectable);
+        return true;
+    }
+
+    void insert(const SdfPath& path, bool selectable)
+    {
+        _selectability[path] = selectable ? kSelectable : kUnselectable;
+    }
+
+private:
+    // Ancestors of the cached prims are added by the path table with the
+    // default value, so it must mean that their selectability is unknown.
+    enum Data : char
+    {
+        kUnknown = 0,
+        kSelectable,
+        kUnselectable
+    };
+
+    void onObjectsChanged(const UsdNotice::ObjectsChanged& notice)
+    {
+        // Any change to the composition of a prim may change its metadata or
+        // the metadata of its descendants.
+        for (const SdfPath& path : notice.GetResyncedPaths()) {
+            if (path.IsAbsoluteRootOrPrimPath())
+                invalidate(path);
+        }
+
+        // Otherwise, only changes to the selectability metadata matter.
+        const UsdNotice::ObjectsChanged::PathRange changedPaths
+            = notice.GetChangedInfoOnlyPaths();
+        for (auto it = changedPaths.begin(); it != changedPaths.end(); ++it) {
+            if (!it->IsAbsoluteRootOrPrimPath())
+                continue;
+
+            for (const TfToken& field : it.GetChangedFields()) {
+                if (field == MayaUsdMetadata->Selectability) {
+                    invalidate(*it);
+                    break;
+                }
+            }
+        }
+    }
+
+    void invalidate(const SdfPath& path)
+    {
+        // Prims in prototypes are shared by instances, whose instance proxies
+        // are cached under their own paths.
+        if (path.IsAbsoluteRootPath() || isInPrototype(path)) {
+            _selectability.clear();
+            return;
+        }
+
+        // Erasing a path from the table also erases its descendants.
+        const auto pos = _selectability.find(path);
+        if (pos != _selectability.end())
+            _selectability.erase(pos);
+    }
+
+    bool isInPrototype(const SdfPath& path) const
+    {
+        if (!_stage)
+            return false;
+
+        const UsdPrim prim = _stage->GetPrimAtPath(path);
+        return prim && (prim.IsPrototype() || prim.IsInPrototype());
+    }
+
+    UsdStageWeakPtr    _stage;
+    TfNotice::Key      _objectsChangedKey;
+    SdfPathTable<char> _selectability;
+};
+
+using StageSelectabilityCaches
+    = std::unordered_map<const UsdStage*, std::unique_ptr<StageSelectabilityCache>>;
+
+// Use a function to retrieve the caches, as this exploits the C++ guaranteed
 // initialization of static in funtions.
-SelectabilityCache& getCache()
+StageSelectabilityCaches& getCaches()
 {
-    static SelectabilityCache cache;
-    return cache;
+    static StageSelectabilityCaches caches;
+    return caches;
 }
 
-void clearCache() { getCache().clear(); }
+StageSelectabilityCache& getCache(const UsdStageWeakPtr& stage)
+{
+    // A new stage can be allocated where an expired one was, so check that the
+    // cache found is not for the expired stage.
+    std::unique_ptr<StageSelectabilityCache>& cache = getCaches()[get_pointer(stage)];
+    if (!cache || cache->isExpired())
+        cache = std::make_unique<StageSelectabilityCache>(stage);
+    return *cache;
+}
 
 // Check selectability for a prim and recurse to parent if inheriting.
-bool isSelectableUncached(UsdPrim prim)
+bool computeSelectability(StageSelectabilityCache& cache, const UsdPrim& prim)
 {
+    // The reason we treat invalid prim as selectable is two-fold:
+    //
+    // - We loop inheritance until we reach an invalid parent prim, and prim are selectable
+    //   by default.
+    // - We don't want to influence selectability of things that are not prim that are being
+    //   tested by accident.
+    if (!prim.IsValid())
+        return true;
+
+    bool selectable = true;
+    if (cache.find(prim.GetPath(), &selectable))
+        return selectable;
+
     const Selectability::State state = Selectability::getLocalState(prim);
     switch (state) {
-    case Selectability::kOn: return true;
-    case Selectability::kOff: return false;
-    case Selectability::kInherit: return Selectability::isSelectable(prim.GetParent());
+    case Selectability::kOn: selectable = true; break;
+    case Selectability::kOff: selectable = false; break;
+    case Selectability::kInherit: selectable = computeSelectability(cache, prim.GetParent()); break;
     default:
         TF_CODING_ERROR("Unsupported selectability enum value: %d", (int)state);
-        return Selectability::isSelectable(prim.GetParent());
+        selectable = computeSelectability(cache, prim.GetParent());
+        break;
     }
+
+    cache.insert(prim.GetPath(), selectable);
+    return selectable;
 }
 } // namespace
 
 /*! \brief  Do any internal preparation for selection needed.
  */
-void Selectability::prepareForSelection() { clearCache(); }
+void Selectability::prepareForSelection()
+{
+    // The caches are kept across selections, only the ones of stages that
+    // no longer exist are released.
+    auto& caches = getCaches();
+    for (auto it = caches.begin(); it != caches.end();) {
+        if (it->second->isExpired())
+            it = caches.erase(it);
+        else
+            ++it;
+    }
+}
 
 /*! \brief  Compute the selectability of a prim, considering inheritance.
  */
 bool Selectability::isSelectable(UsdPrim prim)
 {
-    // The reason we treat invalid prim as selectable is two-fold:
-    //
-    // - We loop inheritance until we reach an invalid parent prim, and prim are selectable
-    //   by default.
-    // - We don't want to influence selectability of things that are not prim that are being
-    //   tested by accident.
     if (!prim.IsValid())
         return true;
 
-    auto&      cache = getCache();
-    const auto pos = cache.find(prim);
-    if (pos != cache.end())
-        return pos->second;
-
-    const bool selectable = isSelectableUncached(prim);
-    cache[prim] = selectable;
-    return selectable;
+    return computeSelectability(getCache(prim.GetStage()), prim);
 }
 
 /*! \brief  Retrieve the local selectability state of a prim, without any inheritance.
@@ -16,15 +16,21 @@
 #ifndef MAYAUSD_SELECTABILITY_H
 #define MAYAUSD_SELECTABILITY_H
 
+#include <mayaUsd/base/api.h>
+
 #include <pxr/base/tf/token.h>
 #include <pxr/usd/usd/prim.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 /*! \brief  Determine the selectability status of a prim.
+
+    The selectability of prims is cached per stage, across selections. The
+    cache of a stage is invalidated by its change notices, for the prims whose
+    composition or selectability metadata changed, and their descendants.
  */
 
-class Selectability
+class MAYAUSD_CORE_PUBLIC Selectability
 {
 public:
     /*! \brief  The possible states of selectability.
@@ -37,6 +43,7 @@ public:
     };
 
     /*! \brief  Prepare any internal data needed for selection prior to selection queries.
+                Releases the caches of the stages which no longer exist.
      */
     static void prepareForSelection();
 
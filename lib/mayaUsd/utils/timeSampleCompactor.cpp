@@ -0,0 +1,420 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "timeSampleCompactor.h"
+
+#include <pxr/base/gf/half.h>
+#include <pxr/base/gf/matrix2d.h>
+#include <pxr/base/gf/matrix3d.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec2d.h>
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec2h.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec3h.h>
+#include <pxr/base/gf/vec4d.h>
+#include <pxr/base/gf/vec4f.h>
+#include <pxr/base/gf/vec4h.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/schema.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+const float*  _Data(const float& value) { return &value; }
+const double* _Data(const double& value) { return &value; }
+const GfHalf* _Data(const GfHalf& value) { return &value; }
+
+template <typename T> auto _Data(const T& value) -> decltype(value.data()) { return value.data(); }
+
+//! The floating point components of a sample, whether it holds a single value or an array.
+template <typename Scalar> struct _Components
+{
+    const Scalar* data = nullptr;
+    size_t        size = 0;
+};
+
+template <typename T, typename Scalar>
+bool _GetComponentsAs(const VtValue& value, _Components<Scalar>* components)
+{
+    constexpr size_t kNumComponents = sizeof(T) / sizeof(Scalar);
+    if (value.IsHolding<T>()) {
+        components->data = _Data(value.UncheckedGet<T>());
+        components->size = kNumComponents;
+        return true;
+    }
+    if (value.IsHolding<VtArray<T>>()) {
+        const VtArray<T>& array = value.UncheckedGet<VtArray<T>>();
+        components->data = array.empty() ? nullptr : _Data(array.cdata()[0]);
+        components->size = array.size() * kNumComponents;
+        return true;
+    }
+    return false;
+}
+
+bool _GetComponents(const VtValue& value, _Components<float>* components)
+{
+    return _GetComponentsAs<GfVec3f>(value, components)
+        || _GetComponentsAs<float>(value, components)
+        || _GetComponentsAs<GfVec2f>(value, components)
+        || _GetComponentsAs<GfVec4f>(value, components);
+}
+
+bool _GetComponents(const VtValue& value, _Components<double>* components)
+{
+    return _GetComponentsAs<GfVec3d>(value, components)
+        || _GetComponentsAs<double>(value, components)
+        || _GetComponentsAs<GfMatrix4d>(value, components)
+        || _GetComponentsAs<GfVec2d>(value, components)
+        || _GetComponentsAs<GfVec4d>(value, components)
+        || _GetComponentsAs<GfMatrix2d>(value, components)
+        || _GetComponentsAs<GfMatrix3d>(value, components);
+}
+
+bool _GetComponents(const VtValue& value, _Components<GfHalf>* components)
+{
+    return _GetComponentsAs<GfVec3h>(value, components)
+        || _GetComponentsAs<GfHalf>(value, components)
+        || _GetComponentsAs<GfVec2h>(value, components)
+        || _GetComponentsAs<GfVec4h>(value, components);
+}
+
+/*! Decides whether samples can be removed by comparing their floating point
+    components, within the tolerance.
+
+    Without an anchor, the samples added form a range, which accepts the
+    samples within the tolerance of all of them. With an anchor, the samples
+    added are the ones between the anchor and the sample accepted, which must
+    reproduce them. Held, the anchor must be within the tolerance of each of
+    them, and the sample accepted too, so that any interpolation of the two is.
+    Linearly interpolated, the slope from the anchor to the sample accepted
+    must go within the tolerance of each of them.
+*/
+template <typename Scalar> class _NumericModel
+{
+public:
+    _NumericModel(
+        const std::vector<double>&        times,
+        const std::vector<const Scalar*>& values,
+        size_t                            numComponents,
+        double                            tolerance)
+        : _times(times)
+        , _values(values)
+        , _tolerance(tolerance)
+        , _min(numComponents)
+        , _max(numComponents)
+    {
+    }
+
+    void BeginRange() { _Begin(kNone, false); }
+
+    void BeginSegment(size_t anchor, bool linear) { _Begin(anchor, linear); }
+
+    //! Returns false if no sample can be accepted anymore. NaN components are never removed.
+    bool Add(size_t i)
+    {
+        const Scalar* value = _values[i];
+        if (!_linear) {
+            for (size_t c = 0; c < _min.size(); ++c) {
+                const double v = static_cast<double>(value[c]);
+                if (std::isnan(v)) {
+                    return false;
+                }
+                _min[c] = std::max(_min[c], v - _tolerance);
+                _max[c] = std::min(_max[c], v + _tolerance);
+            }
+            return _anchor == kNone || Accepts(_anchor);
+        }
+
+        const Scalar* anchor = _values[_anchor];
+        const double  dt = _times[i] - _times[_anchor];
+        bool          feasible = true;
+        for (size_t c = 0; c < _min.size(); ++c) {
+            const double dv = static_cast<double>(value[c]) - static_cast<double>(anchor[c]);
+            if (std::isnan(dv)) {
+                return false;
+            }
+            _min[c] = std::max(_min[c], (dv - _tolerance) / dt);
+            _max[c] = std::min(_max[c], (dv + _tolerance) / dt);
+            feasible = feasible && _min[c] <= _max[c];
+        }
+        return feasible;
+    }
+
+    bool Accepts(size_t i) const
+    {
+        const Scalar* value = _values[i];
+        if (!_linear) {
+            for (size_t c = 0; c < _min.size(); ++c) {
+                const double v = static_cast<double>(value[c]);
+                if (!(v >= _min[c] && v <= _max[c])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        const Scalar* anchor = _values[_anchor];
+        const double  dt = _times[i] - _times[_anchor];
+        for (size_t c = 0; c < _min.size(); ++c) {
+            const double slope
+                = (static_cast<double>(value[c]) - static_cast<double>(anchor[c])) / dt;
+            if (!(slope >= _min[c] && slope <= _max[c])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    void _Begin(size_t anchor, bool linear)
+    {
+        _anchor = anchor;
+        _linear = linear;
+        std::fill(_min.begin(), _min.end(), -std::numeric_limits<double>::infinity());
+        std::fill(_max.begin(), _max.end(), std::numeric_limits<double>::infinity());
+    }
+
+    const std::vector<double>&        _times;
+    const std::vector<const Scalar*>& _values;
+    const double                      _tolerance;
+    std::vector<double>               _min;
+    std::vector<double>               _max;
+    size_t                            _anchor = kNone;
+    bool                              _linear = false;
+};
+
+//! Same as _NumericModel, for values which can only be compared for equality.
+class _ExactModel
+{
+public:
+    explicit _ExactModel(const std::vector<const VtValue*>& values)
+        : _values(values)
+    {
+    }
+
+    void BeginRange() { BeginSegment(kNone, false); }
+
+    void BeginSegment(size_t anchor, bool)
+    {
+        _anchor = anchor;
+        _reference = kNone;
+        _equal = true;
+    }
+
+    bool Add(size_t i)
+    {
+        if (_reference == kNone) {
+            _reference = i;
+        } else if (!(*_values[i] == *_values[_reference])) {
+            _equal = false;
+        }
+        return _anchor == kNone || Accepts(_anchor);
+    }
+
+    bool Accepts(size_t i) const
+    {
+        return _equal && (_reference == kNone || *_values[i] == *_values[_reference]);
+    }
+
+private:
+    const std::vector<const VtValue*>& _values;
+    size_t                             _anchor = kNone;
+    size_t                             _reference = kNone;
+    bool                               _equal = true;
+};
+
+template <typename Model> void _FindKeptSamples(Model& model, bool linear, std::vector<bool>* keep)
+{
+    const size_t numSamples = keep->size();
+
+    // The first sample is held before its time, so the leading samples it
+    // reproduces can go.
+    size_t first = 0;
+    model.BeginRange();
+    while (first + 1 < numSamples && model.Add(first) && model.Accepts(first + 1)) {
+        ++first;
+    }
+
+    // Same for the trailing samples, held after the last one.
+    size_t last = numSamples - 1;
+    model.BeginRange();
+    while (last > first && model.Add(last) && model.Accepts(last - 1)) {
+        --last;
+    }
+
+    // In between, greedily extend each segment as long as its ends reproduce
+    // the samples inside of it.
+    (*keep)[first] = true;
+    size_t anchor = first;
+    while (anchor < last) {
+        model.BeginSegment(anchor, linear);
+        size_t end = anchor + 1;
+        while (end < last && model.Add(end) && model.Accepts(end + 1)) {
+            ++end;
+        }
+        (*keep)[end] = true;
+        anchor = end;
+    }
+}
+
+//! Returns false if the samples are not all the same floating point type and size.
+template <typename Scalar>
+bool _FindKeptNumericSamples(
+    const std::vector<double>&         times,
+    const std::vector<const VtValue*>& values,
+    const TimeSampleCompactorOptions&  options,
+    std::vector<bool>*                 keep,
+    size_t*                            sampleBytes)
+{
+    _Components<Scalar> components;
+    if (!_GetComponents(*values[0], &components)) {
+        return false;
+    }
+
+    const std::type_info&      type = values[0]->GetTypeid();
+    const size_t               numComponents = components.size;
+    std::vector<const Scalar*> data;
+    data.reserve(values.size());
+    for (const VtValue* value : values) {
+        if (value->GetTypeid() != type || !_GetComponents(*value, &components)
+            || components.size != numComponents) {
+            return false;
+        }
+        data.push_back(components.data);
+    }
+
+    _NumericModel<Scalar> model(times, data, numComponents, options.tolerance);
+    _FindKeptSamples(model, options.linear, keep);
+    *sampleBytes = numComponents * sizeof(Scalar);
+    return true;
+}
+
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+size_t compactTimeSamples(SdfTimeSampleMap& samples, const TimeSampleCompactorOptions& options)
+{
+    if (samples.size() < 2) {
+        return 0;
+    }
+
+    std::vector<double>         times;
+    std::vector<const VtValue*> values;
+    times.reserve(samples.size());
+    values.reserve(samples.size());
+    for (const auto& sample : samples) {
+        times.push_back(sample.first);
+        values.push_back(&sample.second);
+    }
+
+    std::vector<bool> keep(samples.size(), false);
+    size_t            sampleBytes = 0;
+    if (!_FindKeptNumericSamples<float>(times, values, options, &keep, &sampleBytes)
+        && !_FindKeptNumericSamples<double>(times, values, options, &keep, &sampleBytes)
+        && !_FindKeptNumericSamples<GfHalf>(times, values, options, &keep, &sampleBytes)) {
+        _ExactModel model(values);
+        _FindKeptSamples(model, false, &keep);
+        sampleBytes = sizeof(VtValue);
+    }
+
+    size_t removed = 0;
+    size_t i = 0;
+    for (auto it = samples.begin(); it != samples.end(); ++i) {
+        if (keep[i]) {
+            ++it;
+        } else {
+            it = samples.erase(it);
+            ++removed;
+        }
+    }
+
+    return removed * (sizeof(double) + sampleBytes);
+}
+
+TimeSampleCompactorStats
+compactTimeSamples(const SdfLayerHandle& layer, const TimeSampleCompactorOptions& options)
+{
+    TimeSampleCompactorStats stats;
+    if (!TF_VERIFY(layer)) {
+        return stats;
+    }
+
+    std::vector<SdfPath> paths;
+    layer->Traverse(SdfPath::AbsoluteRootPath(), [&layer, &paths](const SdfPath& path) {
+        if (layer->GetSpecType(path) == SdfSpecTypeAttribute
+            && layer->HasField(path, SdfFieldKeys->TimeSamples)) {
+            paths.push_back(path);
+        }
+    });
+
+    // The attributes are compacted in parallel, then written back at once.
+    struct Result
+    {
+        SdfTimeSampleMap samples;
+        size_t           removed = 0;
+        size_t           bytesSaved = 0;
+        bool             collapse = false;
+    };
+    std::vector<Result> results(paths.size());
+    WorkParallelForN(paths.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Result& result = results[i];
+            result.samples
+                = layer->GetFieldAs<SdfTimeSampleMap>(paths[i], SdfFieldKeys->TimeSamples);
+            const size_t numSamples = result.samples.size();
+            result.bytesSaved = compactTimeSamples(result.samples, options);
+            result.removed = numSamples - result.samples.size();
+            result.collapse = options.collapseConstant && numSamples > 1
+                && result.samples.size() == 1
+                && !layer->HasField(paths[i], SdfFieldKeys->Default);
+        }
+    });
+
+    SdfChangeBlock changeBlock;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        const Result& result = results[i];
+        ++stats.attributes;
+        stats.removedSamples += result.removed;
+        stats.bytesSaved += result.bytesSaved;
+
+        if (result.collapse) {
+            layer->SetField(paths[i], SdfFieldKeys->Default, result.samples.begin()->second);
+            layer->EraseField(paths[i], SdfFieldKeys->TimeSamples);
+            ++stats.collapsedAttributes;
+            stats.bytesSaved += sizeof(double);
+        } else if (result.removed > 0) {
+            layer->SetField(paths[i], SdfFieldKeys->TimeSamples, result.samples);
+        }
+    }
+
+    return stats;
+}
+
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,91 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_TIME_SAMPLE_COMPACTOR_H
+#define MAYAUSD_TIME_SAMPLE_COMPACTOR_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/types.h>
+
+#include <cstddef>
+
+namespace MAYAUSD_NS_DEF {
+
+/*! \brief options of the compaction of the time samples of a layer.
+ */
+struct TimeSampleCompactorOptions
+{
+    //! Largest difference allowed, per component, between the value of an attribute at the time
+    //! of a removed sample and the value of the sample. Only applies to floating point values;
+    //! other values must be equal.
+    double tolerance = 0.0;
+
+    //! Also remove the samples that the linear interpolation of their neighbors reproduces.
+    //! Only valid on stages that interpolate time samples linearly, which is the default.
+    bool linear = false;
+
+    //! Replace the time samples of the attributes whose value never changes by a default value.
+    //! Attributes with an authored default value, or which only had a single time sample to
+    //! begin with, keep their time samples.
+    bool collapseConstant = false;
+};
+
+/*! \brief what the compaction of the time samples of a layer did.
+ */
+struct TimeSampleCompactorStats
+{
+    //! Number of attributes with time samples.
+    size_t attributes = 0;
+
+    //! Number of time samples removed.
+    size_t removedSamples = 0;
+
+    //! Number of attributes whose time samples were replaced by a default value.
+    size_t collapsedAttributes = 0;
+
+    //! Estimate of the number of bytes of time samples removed, before any file compression.
+    size_t bytesSaved = 0;
+};
+
+/*! \brief remove the time samples that the remaining ones reproduce.
+ *
+ *  A sample is removed when the value of the attribute at its time, given by
+ *  the samples around it, stays within the tolerance, whether the samples are
+ *  held or linearly interpolated. With the \c linear option, the samples are
+ *  assumed to be linearly interpolated, so that samples lying on a line between
+ *  their neighbors are removed too. At least one sample is always kept.
+ *
+ *  Returns the estimated number of bytes saved.
+ */
+MAYAUSD_CORE_PUBLIC
+size_t compactTimeSamples(
+    PXR_NS::SdfTimeSampleMap&         samples,
+    const TimeSampleCompactorOptions& options = TimeSampleCompactorOptions());
+
+/*! \brief remove the redundant time samples of all the attributes of the layer.
+ *
+ *  Meant to be run on the layers written by exports, which write a sample for
+ *  every frame, before they are saved.
+ */
+MAYAUSD_CORE_PUBLIC
+TimeSampleCompactorStats compactTimeSamples(
+    const PXR_NS::SdfLayerHandle&     layer,
+    const TimeSampleCompactorOptions& options = TimeSampleCompactorOptions());
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif
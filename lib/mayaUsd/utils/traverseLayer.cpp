@@ -43,83 +43,149 @@
 
 #include "traverseLayer.h"
 
+#include <pxr/base/work/dispatcher.h>
 #include <pxr/usd/sdf/primSpec.h>
 
-#include <sstream>
+#include <atomic>
+#include <mutex>
+#include <string>
 
 namespace {
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
-using AlreadyTraversedPaths = std::set<SdfPath>;
-
-void _traverseLayer(
-    const SdfLayerHandle&           layer,
-    const SdfPath&                  path,
-    AlreadyTraversedPaths&          traversed,
-    const MayaUsd::TraverseLayerFn& fn);
-
+// Append the children of the spec at the given path, for the children field
+// of the given policy.
 template <typename ChildPolicy>
-void TraverseChildren(
-    const SdfLayerHandle&           layer,
-    const SdfPath&                  path,
-    AlreadyTraversedPaths&          traversed,
-    const MayaUsd::TraverseLayerFn& fn)
+void appendChildren(const SdfLayerHandle& layer, const SdfPath& path, SdfPathVector& children)
 {
-    std::vector<typename ChildPolicy::FieldType> children
+    const std::vector<typename ChildPolicy::FieldType> keys
         = layer->GetFieldAs<std::vector<typename ChildPolicy::FieldType>>(
             path, ChildPolicy::GetChildrenToken(path));
 
-    for (const auto& child : children) {
-        _traverseLayer(layer, ChildPolicy::GetChildPath(path, child), traversed, fn);
+    for (const auto& key : keys) {
+        children.emplace_back(ChildPolicy::GetChildPath(path, key));
     }
 }
 
-void _traverseLayer(
-    const SdfLayerHandle&           layer,
-    const SdfPath&                  path,
-    AlreadyTraversedPaths&          traversed,
-    const MayaUsd::TraverseLayerFn& fn)
+// Append the children of the spec at the given path, in traversal order.
+// The prim children are appended to subtrees, and the other children (variant
+// sets, properties, etc.) to children.
+//
+// Only the children fields that can exist on the type of spec are looked up,
+// instead of listing all the fields of every spec.
+void getChildren(
+    const SdfLayerHandle& layer,
+    const SdfPath&        path,
+    SdfSpecType           specType,
+    SdfPathVector&        subtrees,
+    SdfPathVector&        children)
 {
-    if (traversed.count(path))
-        return;
-
-    traversed.insert(path);
-
-    if (!fn(path)) {
-        // Prune the traversal as requested by fn.
-        return;
+    switch (specType) {
+    case SdfSpecTypePseudoRoot:
+    case SdfSpecTypePrim:
+    case SdfSpecTypeVariant:
+        appendChildren<Sdf_PrimChildPolicy>(layer, path, subtrees);
+        appendChildren<Sdf_VariantSetChildPolicy>(layer, path, children);
+        appendChildren<Sdf_PropertyChildPolicy>(layer, path, children);
+        break;
+    case SdfSpecTypeVariantSet:
+        appendChildren<Sdf_VariantChildPolicy>(layer, path, children);
+        break;
+    case SdfSpecTypeAttribute:
+        appendChildren<Sdf_AttributeConnectionChildPolicy>(layer, path, children);
+        appendChildren<Sdf_MapperChildPolicy>(layer, path, children);
+        appendChildren<Sdf_ExpressionChildPolicy>(layer, path, children);
+        break;
+    case SdfSpecTypeRelationship:
+        appendChildren<Sdf_RelationshipTargetChildPolicy>(layer, path, children);
+        break;
+    case SdfSpecTypeMapper:
+        appendChildren<Sdf_MapperArgChildPolicy>(layer, path, children);
+        break;
+    default: break;
     }
+}
 
-    auto specHandle = layer->GetObjectAtPath(path);
-    if (!specHandle)
-        return;
-
-    auto fields = specHandle->ListFields();
+// Iterative pre-order traversal using an explicit stack. The layer namespace
+// is a tree, so every spec is reached exactly once from its parent and there
+// is no need to remember the visited paths.
+//
+// When a dispatcher is given, the prim children are traversed in their own
+// task instead of being pushed on the stack.
+class Traversal
+{
+public:
+    Traversal(const SdfLayerHandle& layer, const MayaUsd::TraverseLayerSpecFn& fn)
+        : _layer(layer)
+        , _fn(fn)
+    {
+    }
 
-    TF_FOR_ALL(i, fields)
+    void traverse(const SdfPath& root, WorkDispatcher* dispatcher)
     {
-        if (*i == SdfChildrenKeys->PrimChildren) {
-            TraverseChildren<Sdf_PrimChildPolicy>(layer, path, traversed, fn);
-        } else if (*i == SdfChildrenKeys->PropertyChildren) {
-            TraverseChildren<Sdf_PropertyChildPolicy>(layer, path, traversed, fn);
-        } else if (*i == SdfChildrenKeys->MapperChildren) {
-            TraverseChildren<Sdf_MapperChildPolicy>(layer, path, traversed, fn);
-        } else if (*i == SdfChildrenKeys->MapperArgChildren) {
-            TraverseChildren<Sdf_MapperArgChildPolicy>(layer, path, traversed, fn);
-        } else if (*i == SdfChildrenKeys->VariantChildren) {
-            TraverseChildren<Sdf_VariantChildPolicy>(layer, path, traversed, fn);
-        } else if (*i == SdfChildrenKeys->VariantSetChildren) {
-            TraverseChildren<Sdf_VariantSetChildPolicy>(layer, path, traversed, fn);
-        } else if (*i == SdfChildrenKeys->ConnectionChildren) {
-            TraverseChildren<Sdf_AttributeConnectionChildPolicy>(layer, path, traversed, fn);
-        } else if (*i == SdfChildrenKeys->RelationshipTargetChildren) {
-            TraverseChildren<Sdf_RelationshipTargetChildPolicy>(layer, path, traversed, fn);
-        } else if (*i == SdfChildrenKeys->ExpressionChildren) {
-            TraverseChildren<Sdf_ExpressionChildPolicy>(layer, path, traversed, fn);
+        SdfPathVector stack { root };
+        SdfPathVector subtrees;
+        SdfPathVector children;
+
+        try {
+            while (!stack.empty() && !_failed) {
+                const SdfPath path = std::move(stack.back());
+                stack.pop_back();
+
+                const SdfSpecType specType = _layer->GetSpecType(path);
+                if (!_fn(path, specType)) {
+                    // Prune the traversal as requested by fn.
+                    continue;
+                }
+
+                subtrees.clear();
+                children.clear();
+                getChildren(_layer, path, specType, subtrees, children);
+
+                // Push in reverse so that the children are popped in order.
+                stack.insert(stack.end(), children.rbegin(), children.rend());
+                if (dispatcher) {
+                    for (const SdfPath& subtree : subtrees) {
+                        dispatcher->Run([this, subtree, dispatcher]() {
+                            traverse(subtree, dispatcher);
+                        });
+                    }
+                } else {
+                    stack.insert(stack.end(), subtrees.rbegin(), subtrees.rend());
+                }
+            }
+        } catch (const MayaUsd::TraversalFailure& e) {
+            std::lock_guard<std::mutex> lock(_failureMutex);
+            if (!_failed) {
+                _failureReason = e.reason();
+                _failurePath = e.path();
+                _failed = true;
+            }
         }
     }
-}
+
+    bool report() const
+    {
+        if (!_failed)
+            return true;
+
+        TF_WARN(
+            "Layer traversal failed for path %s: %s",
+            _failurePath.GetText(),
+            _failureReason.c_str());
+        return false;
+    }
+
+private:
+    const SdfLayerHandle&               _layer;
+    const MayaUsd::TraverseLayerSpecFn& _fn;
+
+    std::atomic<bool> _failed { false };
+    std::mutex        _failureMutex;
+    std::string       _failureReason;
+    SdfPath           _failurePath;
+};
 
 } // namespace
 
@@ -130,14 +196,27 @@ bool traverseLayer(
     const PXR_NS::SdfPath&        path,
     const TraverseLayerFn&        fn)
 {
-    try {
-        AlreadyTraversedPaths traversed;
-        _traverseLayer(layer, path, traversed, fn);
-    } catch (const TraversalFailure& e) {
-        TF_WARN("Layer traversal failed for path %s: %s", e.path().GetText(), e.reason().c_str());
-        return false;
+    return traverseLayerSpecs(
+        layer, path, [&fn](const PXR_NS::SdfPath& specPath, PXR_NS::SdfSpecType) {
+            return fn(specPath);
+        });
+}
+
+bool traverseLayerSpecs(
+    const PXR_NS::SdfLayerHandle& layer,
+    const PXR_NS::SdfPath&        path,
+    const TraverseLayerSpecFn&    fn,
+    bool                          parallel)
+{
+    Traversal traversal(layer, fn);
+    if (parallel) {
+        PXR_NS::WorkDispatcher dispatcher;
+        traversal.traverse(path, &dispatcher);
+        dispatcher.Wait();
+    } else {
+        traversal.traverse(path, nullptr);
     }
-    return true;
+    return traversal.report();
 }
 
 } // namespace MAYAUSD_NS_DEF
@@ -20,6 +20,7 @@
 
 #include <pxr/usd/sdf/layer.h>
 
+#include <functional>
 #include <stdexcept>
 
 namespace MAYAUSD_NS_DEF {
@@ -57,12 +58,24 @@ private:
 // failure.
 typedef std::function<bool(const PXR_NS::SdfPath&)> TraverseLayerFn;
 
+//! \brief Type definition for typed layer traversal function.
+//
+// Same as TraverseLayerFn, but also receives the type of the spec at the
+// argument path, which the traversal looks up anyway. The type is
+// SdfSpecTypeUnknown if there is no spec at the path.
+typedef std::function<bool(const PXR_NS::SdfPath&, PXR_NS::SdfSpecType)> TraverseLayerSpecFn;
+
 /*! \brief Layer traversal utility.
 
   Pre-order depth-first traversal of layer, starting at path, so that parents
   are traversed before children.  SdfLayer::Traverse() is depth-first,
   post-order, in which case the parent is traversed after the children.
 
+  The specs below a prim or a variant are traversed in this order: the child
+  prims and their whole subtrees first, then the variant sets with their
+  variants, then the properties with their targets and connections. Each
+  group is traversed in the order of its children field in the layer.
+
   Catches the TraversalFailure exception, and returns false on traversal
   failure.
  */
@@ -72,6 +85,26 @@ bool traverseLayer(
     const PXR_NS::SdfPath&        path,
     const TraverseLayerFn&        fn);
 
+/*! \brief Typed layer traversal utility.
+
+  Same as traverseLayer(), with a typed traversal function. In sequential
+  mode, the specs are traversed in the same order as traverseLayer(), so the
+  child prims of a prim are traversed before its properties.
+
+  In parallel mode, the prim subtrees are traversed concurrently, so the
+  traversal function must be thread-safe. Parents are still traversed before
+  their children, but there is no ordering between sibling prims, nor between
+  the subtrees of the child prims and the properties of their parent. On
+  traversal failure, the traversal of the other subtrees is stopped as soon
+  as possible.
+ */
+MAYAUSD_CORE_PUBLIC
+bool traverseLayerSpecs(
+    const PXR_NS::SdfLayerHandle& layer,
+    const PXR_NS::SdfPath&        path,
+    const TraverseLayerSpecFn&    fn,
+    bool                          parallel = false);
+
 } // namespace MAYAUSD_NS_DEF
 
 #endif
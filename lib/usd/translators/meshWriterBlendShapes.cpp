@@ -24,6 +24,7 @@
 #include <pxr/base/tf/diagnostic.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usdGeom/pointBased.h>
 #include <pxr/usd/usdSkel/bindingAPI.h>
@@ -32,6 +33,7 @@
 #include <maya/MAnimUtil.h>
 #include <maya/MApiNamespace.h>
 #include <maya/MFloatArray.h>
+#include <maya/MFloatVectorArray.h>
 #include <maya/MFnBlendShapeDeformer.h>
 #include <maya/MFnGeometryFilter.h>
 #include <maya/MFnNumericAttribute.h>
@@ -60,6 +62,10 @@ constexpr char kMayaAttrNameBlendShapeInPtsTgt[] = "inputPointsTarget";
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+/// Point and normal offsets with a length at or below this value are considered unchanged when
+/// detecting sparse blendshape targets.
+constexpr float kMayaBlendShapeSparseOffsetTolerance = 1.0e-6f;
+
 /// The information about a single blendshape target.
 struct MayaBlendShapeTargetDatum
 {
@@ -116,67 +122,95 @@ float mayaGetBlendShapeTargetWeightFromIndex(const unsigned int index)
     return targetWeight;
 }
 
-MStatus mayaFindPtAndNormalOffsetsBetweenMeshes(
-    const MObject&    a,
-    const MObject&    b,
+/// Computes the point and normal offsets between two sets of per-vertex mesh buffers for the
+/// given component indices. The offsets are written as flat float triplets so that the inner loop
+/// is a plain gather-and-subtract the compiler can vectorize. Large targets are split into
+/// chunks that are processed in parallel.
+void mayaComputePtAndNormalOffsets(
+    const float*      ptsA,
+    const float*      ptsB,
+    const float*      nrmsA,
+    const float*      nrmsB,
+    const VtIntArray& indices,
     VtVec3fArray&     ptOffsets,
-    VtVec3fArray&     nrmOffsets,
-    const VtIntArray& indices)
+    VtVec3fArray&     nrmOffsets)
 {
-    MStatus status;
-    TF_VERIFY(MObjectHandle(a).isAlive() && MObjectHandle(b).isAlive());
-    if (!a.hasFn(MFn::kMesh) || !b.hasFn(MFn::kMesh)) {
-        return MStatus::kInvalidParameter;
-    }
-
-    size_t numIndices = indices.size();
-    if (numIndices == 0) {
-        return MStatus::kInvalidParameter;
-    }
-
+    const size_t numIndices = indices.size();
     ptOffsets.resize(numIndices);
     nrmOffsets.resize(numIndices);
 
-    MFnMesh fnMesh(a, &status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
-
-    const float* nrmsA = fnMesh.getRawNormals(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
-
-    const GfVec3f* pVtNrmsA = reinterpret_cast<const GfVec3f*>(nrmsA);
-
-    // TODO: (yliangsiew) Need to account for float/double meshes.
-    const float* ptsA = fnMesh.getRawPoints(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
-
-    const GfVec3f* pVtPtsA = reinterpret_cast<const GfVec3f*>(ptsA);
-
-    status = fnMesh.setObject(b);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
-
-    const float* nrmsB = fnMesh.getRawNormals(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
-
-    const GfVec3f* pVtNrmsB = reinterpret_cast<const GfVec3f*>(nrmsB);
+    const int* pIndices = indices.cdata();
+    float*     pPtOffsets = reinterpret_cast<float*>(ptOffsets.data());
+    float*     pNrmOffsets = reinterpret_cast<float*>(nrmOffsets.data());
+
+    auto computeRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const size_t srcIdx = static_cast<size_t>(pIndices[i]) * 3;
+            const size_t dstIdx = i * 3;
+            for (size_t c = 0; c < 3; ++c) {
+                pPtOffsets[dstIdx + c] = ptsB[srcIdx + c] - ptsA[srcIdx + c];
+                pNrmOffsets[dstIdx + c] = nrmsB[srcIdx + c] - nrmsA[srcIdx + c];
+            }
+        }
+    };
 
-    // TODO: (yliangsiew) Need to account for float/double meshes.
-    const float* ptsB = fnMesh.getRawPoints(&status);
-    CHECK_MSTATUS_AND_RETURN_IT(status);
+    // NOTE: Small targets are not worth the scheduling overhead; the caller already
+    // processes separate targets in parallel.
+    constexpr size_t kMinParallelComponents = 16384;
+    if (numIndices < kMinParallelComponents) {
+        computeRange(0, numIndices);
+    } else {
+        WorkParallelForN(numIndices, computeRange, kMinParallelComponents / 4);
+    }
+}
 
-    const GfVec3f* pVtPtsB = reinterpret_cast<const GfVec3f*>(ptsB);
+/// Removes the components of a target whose point and normal offsets are both below
+/// `tolerance`, compacting the indices and offsets arrays in place. Facial rigs commonly
+/// list every vertex of the mesh in each target even though only a small region moves.
+///
+/// A target where every offset falls below the tolerance is left untouched, since an empty
+/// `pointIndices` would make the target apply to every point of the mesh.
+///
+/// @return The number of components removed from the target.
+size_t mayaCompactSparseBlendShapeTarget(MayaBlendShapeTargetDatum& target, const float tolerance)
+{
+    const size_t numIndices = target.indices.size();
+    if (numIndices == 0 || target.ptOffsets.size() != numIndices
+        || target.normalOffsets.size() != numIndices) {
+        return 0;
+    }
 
-    for (unsigned int i = 0; i < numIndices; ++i) {
-        const int     componentIdx = indices[i];
-        const GfVec3f ptA = pVtPtsA[componentIdx];
-        const GfVec3f ptB = pVtPtsB[componentIdx];
-        ptOffsets[i] = ptB - ptA;
+    const float    toleranceSq = tolerance * tolerance;
+    const GfVec3f* pPtOffsets = target.ptOffsets.cdata();
+    const GfVec3f* pNrmOffsets = target.normalOffsets.cdata();
 
-        const GfVec3f nrmA = pVtNrmsA[componentIdx];
-        const GfVec3f nrmB = pVtNrmsB[componentIdx];
-        nrmOffsets[i] = nrmB - nrmA;
+    size_t numKept = 0;
+    for (size_t i = 0; i < numIndices; ++i) {
+        if (pPtOffsets[i].GetLengthSq() > toleranceSq
+            || pNrmOffsets[i].GetLengthSq() > toleranceSq) {
+            ++numKept;
+        }
+    }
+    if (numKept == numIndices || numKept == 0) {
+        return 0;
     }
 
-    return status;
+    VtIntArray   indices(numKept);
+    VtVec3fArray ptOffsets(numKept);
+    VtVec3fArray nrmOffsets(numKept);
+    for (size_t i = 0, k = 0; i < numIndices; ++i) {
+        if (pPtOffsets[i].GetLengthSq() > toleranceSq
+            || pNrmOffsets[i].GetLengthSq() > toleranceSq) {
+            indices[k] = target.indices[i];
+            ptOffsets[k] = pPtOffsets[i];
+            nrmOffsets[k] = pNrmOffsets[i];
+            ++k;
+        }
+    }
+    target.indices.swap(indices);
+    target.ptOffsets.swap(ptOffsets);
+    target.normalOffsets.swap(nrmOffsets);
+    return numIndices - numKept;
 }
 
 #if MAYA_BLENDSHAPE_EVAL_HOTFIX
@@ -199,37 +233,48 @@ MStatus mayaBlendShapeTriggerAllTargets(MObject& blendShape)
     status = fnBS.getBaseObjects(baseObjs);
     CHECK_MSTATUS_AND_RETURN_IT(status);
 
-    MIntArray targetItemIndices;
-    MFnMesh   fnMesh;
+    MIntArray        targetItemIndices;
+    std::vector<int> uniqueTargetItemIndices;
+    MFnMesh          fnMesh;
     // NOTE: (yliangsiew) Save out the original weights first to restore them after.
     for (unsigned int i = 0; i < weightIndices.length(); ++i) {
         const int weightIndex = weightIndices[i];
         origWeights[i] = fnBS.weight(weightIndex, &status);
 
+        // NOTE: Several base objects usually share the same target items, so gather the
+        // distinct target weights first and only trigger each of them once.
+        uniqueTargetItemIndices.clear();
         for (unsigned int j = 0; j < baseObjs.length(); ++j) {
             const MObject baseObj = baseObjs[j];
             targetItemIndices.clear();
             status = fnBS.targetItemIndexList(weightIndex, baseObj, targetItemIndices);
             CHECK_MSTATUS_AND_RETURN_IT(status);
-
             for (unsigned int k = 0; k < targetItemIndices.length(); ++k) {
-                // NOTE: (yliangsiew) For in-between shapes, need to trigger at _all_
-                // full weight values of each target so as to populate the components
-                // list for each of the targets. Yea, this is dumb.
-                float targetWeight = mayaGetBlendShapeTargetWeightFromIndex(targetItemIndices[k]);
-                fnBS.setWeight(weightIndex, targetWeight);
-
-                // NOTE: (yliangsiew) We also just force an evaluation
-                // of the mesh at each time we set the blendshape
-                // weight value in the scene to force the components
-                // list to update.
-                for (unsigned int m = 0; m < baseObjs.length(); ++m) {
-                    status = fnMesh.setObject(baseObjs[m]);
-                    CHECK_MSTATUS_AND_RETURN_IT(status);
-                    const float* meshPts = fnMesh.getRawPoints(&status);
-                    CHECK_MSTATUS_AND_RETURN_IT(status);
-                    (void)meshPts;
-                }
+                uniqueTargetItemIndices.push_back(targetItemIndices[k]);
+            }
+        }
+        std::sort(uniqueTargetItemIndices.begin(), uniqueTargetItemIndices.end());
+        uniqueTargetItemIndices.erase(
+            std::unique(uniqueTargetItemIndices.begin(), uniqueTargetItemIndices.end()),
+            uniqueTargetItemIndices.end());
+
+        for (const int targetItemIndex : uniqueTargetItemIndices) {
+            // NOTE: (yliangsiew) For in-between shapes, need to trigger at _all_
+            // full weight values of each target so as to populate the components
+            // list for each of the targets. Yea, this is dumb.
+            float targetWeight = mayaGetBlendShapeTargetWeightFromIndex(targetItemIndex);
+            fnBS.setWeight(weightIndex, targetWeight);
+
+            // NOTE: (yliangsiew) We also just force an evaluation
+            // of the mesh at each time we set the blendshape
+            // weight value in the scene to force the components
+            // list to update.
+            for (unsigned int m = 0; m < baseObjs.length(); ++m) {
+                status = fnMesh.setObject(baseObjs[m]);
+                CHECK_MSTATUS_AND_RETURN_IT(status);
+                const float* meshPts = fnMesh.getRawPoints(&status);
+                CHECK_MSTATUS_AND_RETURN_IT(status);
+                (void)meshPts;
             }
         }
 
@@ -248,6 +293,126 @@ MStatus mayaBlendShapeTriggerAllTargets(MObject& blendShape)
 }
 #endif
 
+/// A geometry target whose offsets against the base mesh still need to be computed.
+struct _PendingTargetOffsets
+{
+    size_t  weightDataIndex; // Index into `MayaBlendShapeDatum::weightDatas`.
+    size_t  targetIndex;     // Index into `MayaBlendShapeWeightDatum::targets`.
+    MObject targetMesh;
+};
+
+/// Copies the per-vertex normals of a mesh into a flat float buffer, so that they can be
+/// indexed by vertex id like the raw points. The raw normals of a mesh are indexed by normal id
+/// instead, which does not match the blendshape component indices.
+MStatus mayaGetFlatVertexNormals(const MFnMesh& fnMesh, std::vector<float>& normals)
+{
+    MStatus           status;
+    MFloatVectorArray vertexNormals;
+    status = fnMesh.getVertexNormals(false, vertexNormals, MSpace::kObject);
+    CHECK_MSTATUS_AND_RETURN_IT(status);
+
+    const unsigned int numNormals = vertexNormals.length();
+    normals.resize(static_cast<size_t>(numNormals) * 3);
+    for (unsigned int i = 0; i < numNormals; ++i) {
+        const MFloatVector& normal = vertexNormals[i];
+        normals[i * 3] = normal.x;
+        normals[i * 3 + 1] = normal.y;
+        normals[i * 3 + 2] = normal.z;
+    }
+    return status;
+}
+
+/**
+ * Computes the offsets of all the pending geometry targets of a blendshape deformer, then
+ * optionally drops the components that do not move from every target of the deformer.
+ *
+ * The mesh buffers are fetched serially, since the Maya API must be called from the main
+ * thread, after which the offsets of the individual targets are computed in parallel.
+ *
+ * @param baseMesh        The original base mesh shape the offsets are relative to.
+ *
+ * @param pendingTargets  The geometry targets whose offsets are to be computed.
+ *
+ * @param sparseTargets   If set to `true`, the components whose point and normal offsets are
+ *                        both negligible are removed from the targets.
+ *
+ * @param info            The blendshape information holding the targets to fill in.
+ *
+ * @return                A status code.
+ */
+MStatus mayaComputePendingTargetOffsets(
+    const MObject&                            baseMesh,
+    const std::vector<_PendingTargetOffsets>& pendingTargets,
+    const bool                                sparseTargets,
+    MayaBlendShapeDatum&                      info)
+{
+    MStatus status;
+    if (!pendingTargets.empty()) {
+        MFnMesh fnMesh(baseMesh, &status);
+        CHECK_MSTATUS_AND_RETURN_IT(status);
+        std::vector<float> nrmsBase;
+        status = mayaGetFlatVertexNormals(fnMesh, nrmsBase);
+        CHECK_MSTATUS_AND_RETURN_IT(status);
+        // TODO: (yliangsiew) Need to account for float/double meshes.
+        const float* ptsBase = fnMesh.getRawPoints(&status);
+        CHECK_MSTATUS_AND_RETURN_IT(status);
+
+        std::vector<const float*>       targetPts(pendingTargets.size(), nullptr);
+        std::vector<std::vector<float>> targetNrms(pendingTargets.size());
+        for (size_t i = 0; i < pendingTargets.size(); ++i) {
+            const MObject& targetMesh = pendingTargets[i].targetMesh;
+            if (!MObjectHandle(targetMesh).isAlive() || !targetMesh.hasFn(MFn::kMesh)) {
+                continue;
+            }
+            status = fnMesh.setObject(targetMesh);
+            CHECK_MSTATUS_AND_RETURN_IT(status);
+            status = mayaGetFlatVertexNormals(fnMesh, targetNrms[i]);
+            CHECK_MSTATUS_AND_RETURN_IT(status);
+            targetPts[i] = fnMesh.getRawPoints(&status);
+            CHECK_MSTATUS_AND_RETURN_IT(status);
+        }
+
+        WorkParallelForN(pendingTargets.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (!targetPts[i] || targetNrms[i].size() != nrmsBase.size()) {
+                    continue;
+                }
+                const _PendingTargetOffsets& pending = pendingTargets[i];
+                MayaBlendShapeTargetDatum&   target
+                    = info.weightDatas[pending.weightDataIndex].targets[pending.targetIndex];
+                mayaComputePtAndNormalOffsets(
+                    ptsBase,
+                    targetPts[i],
+                    nrmsBase.data(),
+                    targetNrms[i].data(),
+                    target.indices,
+                    target.ptOffsets,
+                    target.normalOffsets);
+            }
+        });
+    }
+
+    if (!sparseTargets) {
+        return status;
+    }
+
+    // NOTE: Gather every target of the deformer so that they can be compacted in parallel,
+    // including the ones already "baked" into the deformer.
+    std::vector<MayaBlendShapeTargetDatum*> targets;
+    for (MayaBlendShapeWeightDatum& weightData : info.weightDatas) {
+        for (MayaBlendShapeTargetDatum& target : weightData.targets) {
+            targets.push_back(&target);
+        }
+    }
+    WorkParallelForN(targets.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            mayaCompactSparseBlendShapeTarget(*targets[i], kMayaBlendShapeSparseOffsetTolerance);
+        }
+    });
+
+    return status;
+}
+
 /**
  * Gets information about available blend shapes for a given deformed mesh (i.e. final result)
  *
@@ -259,12 +424,16 @@ MStatus mayaBlendShapeTriggerAllTargets(MObject& blendShape)
  *                               and retrieve them. If not, empty targets will be skipped in the
  *                               final result.
  *
+ * @param sparseTargets          If set to `true`, the components that do not move are removed
+ *                               from the targets.
+ *
  * @return                       A status code.
  */
 MStatus mayaGetBlendShapeInfosForMesh(
     const MObject&                    deformedMesh,
     std::vector<MayaBlendShapeDatum>& outInfos,
-    const bool                        getEmptyBlendShapes)
+    const bool                        getEmptyBlendShapes,
+    const bool                        sparseTargets)
 {
     // TODO: (yliangsiew) Eh, find a way to avoid incremental allocations like these and just
     // allocate upfront. But hard to do with the iterative search functions of the DG...
@@ -367,6 +536,7 @@ MStatus mayaGetBlendShapeInfosForMesh(
         mayaBlendShapeTriggerAllTargets(curBlendShape);
 #endif
 
+        std::vector<_PendingTargetOffsets> pendingTargets;
         for (unsigned int i = 0; i < weightIndices.length(); ++i) {
             MayaBlendShapeWeightDatum weightInfo = {};
             weightInfo.weightIndex = weightIndices[i];
@@ -451,12 +621,11 @@ MStatus mayaGetBlendShapeInfosForMesh(
                     TF_VERIFY(meshInGeomTgt.hasFn(MFn::kMesh));
 
                     meshTargetDatum.targetMesh = meshInGeomTgt;
-                    mayaFindPtAndNormalOffsetsBetweenMeshes(
-                        inputGeo,
-                        meshInGeomTgt,
-                        meshTargetDatum.ptOffsets,
-                        meshTargetDatum.normalOffsets,
-                        meshTargetDatum.indices);
+
+                    // NOTE: The offsets are computed for all the targets of this deformer at
+                    // once, in parallel, after all the targets have been gathered.
+                    pendingTargets.push_back(
+                        { info.weightDatas.size(), weightInfo.targets.size(), meshInGeomTgt });
                 } else {
                     // NOTE: (yliangsiew) If there is no geometry target, then we have to assume
                     // the target has already been "baked" into the blendshape deformer. In this
@@ -492,6 +661,10 @@ MStatus mayaGetBlendShapeInfosForMesh(
 
             info.weightDatas.push_back(weightInfo);
         }
+
+        stat = mayaComputePendingTargetOffsets(inputGeo, pendingTargets, sparseTargets, info);
+        CHECK_MSTATUS_AND_RETURN_IT(stat);
+
         outInfos.push_back(info);
     }
     return stat;
@@ -602,11 +775,11 @@ MObject PxrUsdTranslators_MeshWriter::writeBlendShapeData(UsdGeomMesh& primSchem
     // TODO: (yliangsiew) Figure out if this can be isolated. It's kind of hard
     // because we want to avoid repeated walks through the DG.
     std::vector<MayaBlendShapeDatum> blendShapeDeformerInfos;
-    if (exportArgs.ignoreWarnings) {
-        stat = mayaGetBlendShapeInfosForMesh(deformedMesh, blendShapeDeformerInfos, true);
-    } else {
-        stat = mayaGetBlendShapeInfosForMesh(deformedMesh, blendShapeDeformerInfos, false);
-    }
+    stat = mayaGetBlendShapeInfosForMesh(
+        deformedMesh,
+        blendShapeDeformerInfos,
+        exportArgs.ignoreWarnings,
+        exportArgs.sparseBlendShapeTargets);
     if (stat != MStatus::kSuccess) {
         TF_WARN(
             "Could not read blendshape information for the mesh: %s.",
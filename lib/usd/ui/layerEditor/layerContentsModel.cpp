@@ -0,0 +1,172 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "layerContentsModel.h"
+
+#include <pxr/usd/sdf/primSpec.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace UsdLayerEditor {
+
+namespace {
+
+// Collect the prim paths of the layer in the depth-first order in which they are written out.
+void collectPrimPaths(
+    const PXR_NS::SdfPrimSpecHandle& parent,
+    std::vector<PXR_NS::SdfPath>&    paths,
+    const std::atomic<bool>&         cancel)
+{
+    for (const PXR_NS::SdfPrimSpecHandle& child : parent->GetNameChildren()) {
+        if (cancel)
+            return;
+        paths.push_back(child->GetPath());
+        collectPrimPaths(child, paths, cancel);
+    }
+}
+
+// Check if a line of text starts a prim spec, and if so return the name of the prim.
+bool parsePrimHeader(const char* begin, const char* end, std::string* name)
+{
+    while (begin < end && (*begin == ' ' || *begin == '\t'))
+        ++begin;
+
+    static const char* const specifiers[] = { "def ", "over ", "class " };
+    for (const char* specifier : specifiers) {
+        const size_t len = std::strlen(specifier);
+        if (static_cast<size_t>(end - begin) > len && std::strncmp(begin, specifier, len) == 0) {
+            const char* nameBegin = std::find(begin + len, end, '"');
+            if (nameBegin == end)
+                return false;
+            ++nameBegin;
+            const char* nameEnd = std::find(nameBegin, end, '"');
+            if (nameEnd == end)
+                return false;
+            name->assign(nameBegin, nameEnd);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+LayerContentsModel::LayerContentsModel(
+    std::string&&                 text,
+    const PXR_NS::SdfLayerHandle& layer,
+    const std::atomic<bool>&      cancel)
+    : _text(std::move(text))
+{
+    buildLineOffsets(cancel);
+    buildPrimIndex(layer, cancel);
+}
+
+void LayerContentsModel::buildLineOffsets(const std::atomic<bool>& cancel)
+{
+    _lineOffsets.clear();
+    if (_text.empty())
+        return;
+
+    // Rough guess to avoid most of the re-allocations on large layers.
+    _lineOffsets.reserve(_text.size() / 32);
+    _lineOffsets.push_back(0);
+
+    size_t pos = 0;
+    while (!cancel && (pos = _text.find('\n', pos)) != std::string::npos) {
+        ++pos;
+        if (pos < _text.size())
+            _lineOffsets.push_back(pos);
+    }
+}
+
+void LayerContentsModel::buildPrimIndex(
+    const PXR_NS::SdfLayerHandle& layer,
+    const std::atomic<bool>&      cancel)
+{
+    if (!layer || cancel)
+        return;
+
+    std::vector<PXR_NS::SdfPath> specPaths;
+    collectPrimPaths(layer->GetPseudoRoot(), specPaths, cancel);
+
+    // Index the lines of the prim headers by prim name, in a single pass over the text.
+    std::unordered_map<std::string, std::vector<size_t>> headerLines;
+    std::string                                          name;
+    for (size_t line = 0; line < lineCount(); ++line) {
+        if (cancel)
+            return;
+
+        const char* begin = _text.data() + _lineOffsets[line];
+        const char* end
+            = _text.data() + (line + 1 < lineCount() ? _lineOffsets[line + 1] : _text.size());
+        if (parsePrimHeader(begin, end, &name))
+            headerLines[name].push_back(line);
+    }
+
+    // Prims are written in the same order as the spec hierarchy, so each prim is the first
+    // header with its name after the previous prim. A prim that cannot be found is skipped
+    // without moving on, so the following prims can still be found.
+    _primPaths.reserve(specPaths.size());
+    size_t searchLine = 0;
+    for (const PXR_NS::SdfPath& path : specPaths) {
+        auto lines = headerLines.find(path.GetName());
+        if (lines == headerLines.end())
+            continue;
+
+        auto line = std::lower_bound(lines->second.begin(), lines->second.end(), searchLine);
+        if (line == lines->second.end())
+            continue;
+
+        _primPaths.push_back(path);
+        _primLines.emplace(path, *line);
+        searchLine = *line + 1;
+    }
+}
+
+size_t LayerContentsModel::pageLineCount(size_t page) const
+{
+    const size_t firstLine = pageFirstLine(page);
+    if (firstLine >= lineCount())
+        return 0;
+    return std::min(kLinesPerPage, lineCount() - firstLine);
+}
+
+std::string LayerContentsModel::pageText(size_t page) const
+{
+    const size_t numLines = pageLineCount(page);
+    if (numLines == 0)
+        return {};
+
+    const size_t firstLine = pageFirstLine(page);
+    const size_t begin = _lineOffsets[firstLine];
+    size_t       end = (firstLine + numLines < lineCount()) ? _lineOffsets[firstLine + numLines]
+                                                            : _text.size();
+    if (end > begin && _text[end - 1] == '\n')
+        --end;
+    return _text.substr(begin, end - begin);
+}
+
+bool LayerContentsModel::findPrimLine(const PXR_NS::SdfPath& path, size_t* line) const
+{
+    auto it = _primLines.find(path);
+    if (it == _primLines.end())
+        return false;
+    if (line)
+        *line = it->second;
+    return true;
+}
+
+} // namespace UsdLayerEditor
@@ -0,0 +1,83 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LAYERCONTENTSMODEL_H
+#define LAYERCONTENTSMODEL_H
+
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace UsdLayerEditor {
+
+/**
+ * @brief Paged, read-only view of the exported text of a layer.
+ *
+ * The text is split into fixed-size pages of lines so that the UI only ever holds (and
+ * syntax-highlights) a single page, no matter how large the layer is. An index of the prim
+ * paths of the layer to the line where their spec starts allows jumping directly to a prim.
+ *
+ * The model is built on a worker thread and is immutable once handed over to the UI.
+ */
+class LayerContentsModel
+{
+public:
+    static constexpr size_t kLinesPerPage = 2000;
+
+    /**
+     * @brief Build the model from the text of the layer. Stops early, leaving the model
+     * incomplete, if \p cancel becomes true.
+     * @param text The exported text of the layer.
+     * @param layer The layer whose spec hierarchy is used to build the prim path index. It
+     *              must not be modified by another thread while the model is being built.
+     * @param cancel Flag set by the UI when the result is no longer wanted.
+     */
+    LayerContentsModel(
+        std::string&&                 text,
+        const PXR_NS::SdfLayerHandle& layer,
+        const std::atomic<bool>&      cancel);
+
+    size_t lineCount() const { return _lineOffsets.size(); }
+    size_t pageCount() const { return (lineCount() + kLinesPerPage - 1) / kLinesPerPage; }
+    size_t pageOfLine(size_t line) const { return line / kLinesPerPage; }
+    size_t pageFirstLine(size_t page) const { return page * kLinesPerPage; }
+    size_t pageLineCount(size_t page) const;
+
+    /// Returns the UTF-8 text of the given page, without its trailing new line.
+    std::string pageText(size_t page) const;
+
+    /// Prim paths in the order they appear in the text.
+    const std::vector<PXR_NS::SdfPath>& primPaths() const { return _primPaths; }
+
+    /// Find the line where the spec of the given prim starts.
+    bool findPrimLine(const PXR_NS::SdfPath& path, size_t* line) const;
+
+private:
+    void buildLineOffsets(const std::atomic<bool>& cancel);
+    void buildPrimIndex(const PXR_NS::SdfLayerHandle& layer, const std::atomic<bool>& cancel);
+
+    std::string                                                        _text;
+    std::vector<size_t>                                                _lineOffsets;
+    std::vector<PXR_NS::SdfPath>                                       _primPaths;
+    std::unordered_map<PXR_NS::SdfPath, size_t, PXR_NS::SdfPath::Hash> _primLines;
+};
+
+} // namespace UsdLayerEditor
+
+#endif // LAYERCONTENTSMODEL_H
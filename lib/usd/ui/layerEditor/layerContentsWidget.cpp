@@ -15,6 +15,7 @@
 //
 #include "layerContentsWidget.h"
 
+#include "layerContentsModel.h"
 #include "layerTreeModel.h"
 #include "stringResources.h"
 #include "usdSyntaxHighlighter.h"
@@ -38,8 +39,16 @@
 #endif
 
 #include <maya/MGlobal.h>
+#include <maya/MQtUtil.h>
 
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QStringListModel>
+
+#include <algorithm>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -95,7 +104,6 @@ enum OutputType {
 // We use this structure to represent all the parameters for reporting. 
 struct ReportParams
 {
-    std::shared_ptr<TfPatternMatcher> pathMatcher;
     std::shared_ptr<TfPatternMatcher> fieldMatcher;
 
     // Default to the most human readable output (pseudoLayer) which is the only
@@ -106,20 +114,6 @@ struct ReportParams
     int64_t timeSamplesSizeLimit = 8;
 };
 
-// Find all the paths in layer that match, or all paths if matcher is null.
-std::vector<SdfPath>
-CollectMatchingSpecPaths(SdfLayerHandle const &layer,
-                         TfPatternMatcher const *matcher)
-{
-    std::vector<SdfPath> result;
-    layer->Traverse(SdfPath::AbsoluteRootPath(),
-                    [&result, &matcher](SdfPath const &path) {
-                        if (!matcher || matcher->Match(path.GetString()))
-                            result.push_back(path);
-                    });
-    return result;
-}
-
 // Closeness check with relative tolerance.
 bool IsClose(double a, double b, double tol)
 {
@@ -206,17 +200,14 @@ GetReportFieldValue(SdfLayerHandle const &layer,
     return result;
 }
 
-// Utility function to filter a layer by the params p.  This copies fields,
-// replacing large arrays and timeSamples with human readable values if
-// appropriate, and skipping paths and fields that do not match the matchers in
-// p.
-void
-FilterLayer(SdfLayerHandle const &inLayer,
-            SdfLayerHandle const &outLayer,
-            ReportParams const &p)
+// Utility function to make the value copy function that filters a layer by the
+// params p.  It replaces large arrays and timeSamples with human readable values
+// if appropriate, and skips fields that do not match the matcher in p.  The
+// params are captured by value, as the copy of the layer is done in steps.
+SdfShouldCopyValueFn
+MakeFilterCopyValueFn(ReportParams const &p)
 {
-    namespace ph = std::placeholders;
-    auto copyValueFn = [&p](
+    return [p](
         SdfSpecType specType, TfToken const &field,
         SdfLayerHandle const &srcLayer, const SdfPath& srcPath, bool fieldInSrc,
         const SdfLayerHandle& dstLayer, const SdfPath& dstPath, bool fieldInDst,
@@ -235,23 +226,6 @@ FilterLayer(SdfLayerHandle const &inLayer,
             return false;
         }
     };
-
-    std::vector<SdfPath> paths =
-        CollectMatchingSpecPaths(inLayer, p.pathMatcher.get());
-    for (auto const &path: paths) {
-        if (path == SdfPath::AbsoluteRootPath() ||
-            path.IsPrimPath()) {
-            if (path.IsPrimPath()) {
-                SdfPrimSpecHandle outPrim = SdfCreatePrimInLayer(outLayer, path);
-            }
-            SdfCopySpec(inLayer, path, outLayer, path,
-                        copyValueFn,
-                        std::bind(SdfShouldCopyChildren,
-                                  std::cref(path), std::cref(path),
-                                  ph::_1, ph::_2, ph::_3, ph::_4, ph::_5,
-                                  ph::_6, ph::_7, ph::_8, ph::_9));
-        }
-    }
 }
 
 // clang-format on
@@ -264,13 +238,89 @@ struct SuspendUsdNotices
     ~SuspendUsdNotices() { LayerTreeModel::suspendUsdNotices(false); }
 };
 
+namespace {
+
+// Longest time spent copying the layer into the snapshot before giving control back to the UI.
+constexpr int kSnapshotStepMilliseconds = 10;
+
+// Copy the fields and the properties of a spec, but not its prim children, which are copied on
+// their own so that the copy of a large layer can be split into small steps.
+void copySpecWithoutPrimChildren(
+    const PXR_NS::SdfLayerHandle&       source,
+    const PXR_NS::SdfLayerHandle&       destination,
+    const PXR_NS::SdfPath&              path,
+    const PXR_NS::SdfShouldCopyValueFn& copyValueFn)
+{
+    PXR_NS::SdfCopySpec(
+        source,
+        path,
+        destination,
+        path,
+        copyValueFn,
+        [&path](
+            const PXR_NS::TfToken&        childrenField,
+            const PXR_NS::SdfLayerHandle& srcLayer,
+            const PXR_NS::SdfPath&        srcPath,
+            bool                          fieldInSrc,
+            const PXR_NS::SdfLayerHandle& dstLayer,
+            const PXR_NS::SdfPath&        dstPath,
+            bool                          fieldInDst,
+            auto*                         srcChildren,
+            auto*                         dstChildren) {
+            if (srcPath == path && childrenField == PXR_NS::SdfChildrenKeys->PrimChildren)
+                return false;
+            return PXR_NS::SdfShouldCopyChildren(
+                path,
+                path,
+                childrenField,
+                srcLayer,
+                srcPath,
+                fieldInSrc,
+                dstLayer,
+                dstPath,
+                fieldInDst,
+                srcChildren,
+                dstChildren);
+        });
+}
+
+// Export the header of the snapshot, then each of its root prims, checking for cancellation in
+// between so that a cancelled export does not have to write out the whole layer first.
+bool exportSnapshot(
+    const PXR_NS::SdfLayerRefPtr& snapshot,
+    const PXR_NS::SdfLayerRefPtr& header,
+    const std::atomic<bool>&      cancel,
+    std::string&                  text)
+{
+    if (!header->ExportToString(&text))
+        return false;
+
+    const PXR_NS::SdfFileFormatConstPtr format = snapshot->GetFileFormat();
+    std::ostringstream                  stream;
+    for (const PXR_NS::SdfPrimSpecHandle& rootPrim : snapshot->GetRootPrims()) {
+        if (cancel)
+            return false;
+        stream << '\n';
+        if (!format->WriteToStream(rootPrim, stream, 0))
+            return false;
+    }
+    text += stream.str();
+    return !cancel;
+}
+
+} // namespace
+
 LayerContentsWidget::LayerContentsWidget(QWidget* in_parent)
     : QWidget(in_parent)
 {
     createUI();
 }
 
-LayerContentsWidget::~LayerContentsWidget() { }
+LayerContentsWidget::~LayerContentsWidget()
+{
+    cancelSnapshot();
+    cancelExport();
+}
 
 void LayerContentsWidget::createUI()
 {
@@ -278,6 +328,51 @@ void LayerContentsWidget::createUI()
     mainLayout->setContentsMargins(0, 0, 0, 0);
     mainLayout->setSpacing(0);
 
+    // Navigation bar: jump to a prim path and move between pages of large layers.
+    _navigationBar = new QWidget;
+    auto navLayout = new QHBoxLayout(_navigationBar);
+    navLayout->setContentsMargins(0, 0, 0, 0);
+
+    _primPathEdit = new QLineEdit;
+    _primPathEdit->setPlaceholderText(
+        StringResources::getAsQString(StringResources::kDisplayLayerContentsGoToPrim));
+    _primPathEdit->setClearButtonEnabled(true);
+    auto completer = new QCompleter(new QStringListModel(_primPathEdit), _primPathEdit);
+    completer->setCaseSensitivity(Qt::CaseInsensitive);
+    completer->setFilterMode(Qt::MatchContains);
+    _primPathEdit->setCompleter(completer);
+    connect(_primPathEdit, &QLineEdit::returnPressed, this, &LayerContentsWidget::goToPrim);
+    connect(
+        completer,
+        QOverload<const QString&>::of(&QCompleter::activated),
+        this,
+        &LayerContentsWidget::goToPrim);
+    navLayout->addWidget(_primPathEdit, 1);
+
+    _prevPageButton = new QToolButton;
+    _prevPageButton->setArrowType(Qt::LeftArrow);
+    _prevPageButton->setAutoRaise(true);
+    connect(_prevPageButton, &QToolButton::clicked, this, [this]() {
+        if (_currentPage > 0)
+            showPage(_currentPage - 1);
+    });
+    navLayout->addWidget(_prevPageButton);
+
+    _pageLabel = new QLabel;
+    navLayout->addWidget(_pageLabel);
+
+    _nextPageButton = new QToolButton;
+    _nextPageButton->setArrowType(Qt::RightArrow);
+    _nextPageButton->setAutoRaise(true);
+    connect(_nextPageButton, &QToolButton::clicked, this, [this]() {
+        if (_model && _currentPage + 1 < _model->pageCount())
+            showPage(_currentPage + 1);
+    });
+    navLayout->addWidget(_nextPageButton);
+
+    _navigationBar->setVisible(false);
+    mainLayout->addWidget(_navigationBar);
+
     _layerContents = new QTextEdit;
     _layerContents->setFont(QFont("Courier New"));
     _layerContents->setAcceptRichText(true);
@@ -286,7 +381,8 @@ void LayerContentsWidget::createUI()
         StringResources::getAsQString(StringResources::kDisplayLayerContentsEmpty));
     _layerContents->setReadOnly(true);
 
-    // Apply USD syntax highlighting
+    // Apply USD syntax highlighting. Only the current page is ever in the document,
+    // so only the lines the user can actually reach get highlighted.
     _syntaxHighlighter = new UsdSyntaxHighlighter(_layerContents->document());
 
     mainLayout->addWidget(_layerContents);
@@ -302,36 +398,262 @@ void LayerContentsWidget::setLayer(
         // Note: that will be the case when there is no layer selected, or if there is
         //       more than one layer selected. We only display the contents of a layer
         //       when there is exactly one layer selected.
-        _layerContents->clear();
+        clear();
         if (nullptr != in_layer) {
-            std::string layerText;
-            // Note: potentially slow operation for large layers.
-            //       We could consider doing this in a worker thread if needed.
-
-            bool layerExported { false };
-            if (!expandAllValues) {
-                layerExported = exportPseudoLayer(in_layer, layerText);
-            } else {
-                layerExported = in_layer->ExportToString(&layerText);
-            }
-
-            if (layerExported) {
-                _layerContents->setPlainText(QString::fromStdString(layerText));
-                _isEmpty = false;
-            }
+            _layerContents->setPlaceholderText(
+                StringResources::getAsQString(StringResources::kDisplayLayerContentsLoading));
+            startSnapshot(in_layer, expandAllValues);
         }
     }
 }
 
-bool LayerContentsWidget::exportPseudoLayer(
+void LayerContentsWidget::startSnapshot(
     const PXR_NS::SdfLayerRefPtr in_layer,
-    std::string&                 out_contents)
+    bool                         expandAllValues)
+{
+    // Take a private copy of the layer, so that the (slow) text export can be done on a worker
+    // thread without racing with edits to the layer. The copy is done on the UI thread, where
+    // the layer is edited, but in small steps run from a timer so that the UI stays responsive.
+    // The layer editor sets the layer again when it changes, which restarts the copy.
+    SuspendUsdNotices suspendNotices;
+
+    _snapshotSource = in_layer;
+    if (expandAllValues) {
+        _snapshot = createLayerSnapshot();
+    } else {
+        _snapshot = createPseudoLayer(in_layer);
+    }
+
+    // The header holds the layer metadata without any prim, and is exported on its own.
+    _snapshotHeader = PXR_NS::SdfLayer::CreateAnonymous(std::string(), _snapshot->GetFileFormat());
+    copySpecWithoutPrimChildren(
+        in_layer, _snapshot, PXR_NS::SdfPath::AbsoluteRootPath(), _snapshotCopyValue);
+    copySpecWithoutPrimChildren(
+        in_layer, _snapshotHeader, PXR_NS::SdfPath::AbsoluteRootPath(), _snapshotCopyValue);
+
+    // The prims are copied depth-first, in the order of the layer, so that the children of
+    // each prim are created in order. The pending prims are a stack, hence reversed.
+    for (const PXR_NS::SdfPrimSpecHandle& rootPrim : in_layer->GetRootPrims()) {
+        _snapshotPending.push_back(rootPrim->GetPath());
+    }
+    std::reverse(_snapshotPending.begin(), _snapshotPending.end());
+
+    _snapshotTimer.start(0, this);
+}
+
+void LayerContentsWidget::continueSnapshot()
 {
-    // Suspend all notices while we do this, since the pseudo layer is not a real layer and may have
-    // fields that would trigger notices that we don't want which cause the LE to rebuild.
     SuspendUsdNotices suspendNotices;
 
-    // Make the pseudo layer and copy into it, then export.
+    QElapsedTimer stepTimer;
+    stepTimer.start();
+    while (!_snapshotPending.empty() && stepTimer.elapsed() < kSnapshotStepMilliseconds) {
+        const PXR_NS::SdfPath path = _snapshotPending.back();
+        _snapshotPending.pop_back();
+
+        const PXR_NS::SdfPrimSpecHandle prim = _snapshotSource->GetPrimAtPath(path);
+        if (!prim)
+            continue;
+
+        PXR_NS::SdfCreatePrimInLayer(_snapshot, path);
+        copySpecWithoutPrimChildren(_snapshotSource, _snapshot, path, _snapshotCopyValue);
+
+        const size_t firstChild = _snapshotPending.size();
+        for (const PXR_NS::SdfPrimSpecHandle& child : prim->GetNameChildren()) {
+            _snapshotPending.push_back(child->GetPath());
+        }
+        std::reverse(_snapshotPending.begin() + firstChild, _snapshotPending.end());
+    }
+
+    if (_snapshotPending.empty()) {
+        _snapshotTimer.stop();
+        _snapshotSource.Reset();
+        startExport(_snapshot, _snapshotHeader);
+        _snapshot.Reset();
+        _snapshotHeader.Reset();
+    }
+}
+
+void LayerContentsWidget::cancelSnapshot()
+{
+    _snapshotTimer.stop();
+    _snapshotPending.clear();
+    _snapshotSource.Reset();
+    _snapshot.Reset();
+    _snapshotHeader.Reset();
+    _snapshotCopyValue = nullptr;
+}
+
+void LayerContentsWidget::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() == _snapshotTimer.timerId()) {
+        continueSnapshot();
+    } else {
+        QWidget::timerEvent(event);
+    }
+}
+
+void LayerContentsWidget::startExport(
+    PXR_NS::SdfLayerRefPtr snapshot,
+    PXR_NS::SdfLayerRefPtr header)
+{
+    cancelExport();
+
+    // Note: the thread is detached rather than joined when cancelled, since the export of a
+    //       single large root prim cannot be interrupted and joining it would block the UI.
+    //       A cancelled export drops its result, and so does the UI thread if the widget was
+    //       destroyed or a different layer has been requested since.
+    const uint64_t                           requestId = ++_exportRequestId;
+    const std::shared_ptr<std::atomic<bool>> cancelled = std::make_shared<std::atomic<bool>>(false);
+    const QPointer<LayerContentsWidget>      self(this);
+    _exportCancelled = cancelled;
+
+    std::thread([self, snapshot, header, requestId, cancelled]() {
+        std::shared_ptr<const LayerContentsModel> model;
+        std::string                               layerText;
+        if (exportSnapshot(snapshot, header, *cancelled, layerText)) {
+            model
+                = std::make_shared<LayerContentsModel>(std::move(layerText), snapshot, *cancelled);
+        }
+        if (*cancelled)
+            return;
+
+        QMetaObject::invokeMethod(
+            QCoreApplication::instance(),
+            [self, requestId, model]() {
+                if (self)
+                    self->onExportFinished(requestId, model);
+            },
+            Qt::QueuedConnection);
+    }).detach();
+}
+
+void LayerContentsWidget::cancelExport()
+{
+    if (_exportCancelled) {
+        *_exportCancelled = true;
+        _exportCancelled.reset();
+    }
+}
+
+void LayerContentsWidget::onExportFinished(
+    uint64_t                                  requestId,
+    std::shared_ptr<const LayerContentsModel> model)
+{
+    // Ignore results from a previous layer that finished after a new one was requested.
+    if (requestId != _exportRequestId || !_layerContents)
+        return;
+
+    _layerContents->setPlaceholderText(
+        StringResources::getAsQString(StringResources::kDisplayLayerContentsEmpty));
+
+    if (!model || model->lineCount() == 0)
+        return;
+
+    _model = model;
+    _isEmpty = false;
+
+    QStringList primPaths;
+    primPaths.reserve(static_cast<int>(_model->primPaths().size()));
+    for (const PXR_NS::SdfPath& path : _model->primPaths()) {
+        primPaths.append(QString::fromStdString(path.GetString()));
+    }
+    if (auto completerModel = qobject_cast<QStringListModel*>(_primPathEdit->completer()->model()))
+        completerModel->setStringList(primPaths);
+
+    _navigationBar->setVisible(true);
+    showPage(0);
+}
+
+void LayerContentsWidget::showPage(size_t page)
+{
+    if (!_model || page >= _model->pageCount())
+        return;
+
+    _currentPage = page;
+    _layerContents->setPlainText(QString::fromStdString(_model->pageText(page)));
+
+    const size_t firstLine = _model->pageFirstLine(page);
+    MString      pageInfo;
+    pageInfo.format(
+        StringResources::getAsMString(StringResources::kDisplayLayerContentsPageInfo),
+        MString(std::to_string(firstLine + 1).c_str()),
+        MString(std::to_string(firstLine + _model->pageLineCount(page)).c_str()),
+        MString(std::to_string(_model->lineCount()).c_str()));
+    _pageLabel->setText(MQtUtil::toQString(pageInfo));
+
+    _prevPageButton->setEnabled(page > 0);
+    _nextPageButton->setEnabled(page + 1 < _model->pageCount());
+}
+
+void LayerContentsWidget::showLine(size_t line)
+{
+    if (!_model || line >= _model->lineCount())
+        return;
+
+    const size_t page = _model->pageOfLine(line);
+    if (page != _currentPage || _layerContents->document()->isEmpty())
+        showPage(page);
+
+    const int   block = static_cast<int>(line - _model->pageFirstLine(page));
+    QTextCursor cursor(_layerContents->document()->findBlockByNumber(block));
+    _layerContents->setTextCursor(cursor);
+
+    // Put the line at the top of the view rather than just somewhere in it.
+    QScrollBar* scrollBar = _layerContents->verticalScrollBar();
+    scrollBar->setValue(scrollBar->maximum());
+    _layerContents->ensureCursorVisible();
+}
+
+void LayerContentsWidget::goToPrim()
+{
+    if (!_model)
+        return;
+
+    const std::string text = _primPathEdit->text().trimmed().toStdString();
+    if (text.empty() || !PXR_NS::SdfPath::IsValidPathString(text))
+        return;
+
+    size_t line = 0;
+    if (_model->findPrimLine(PXR_NS::SdfPath(text), &line))
+        showLine(line);
+}
+
+PXR_NS::SdfLayerRefPtr LayerContentsWidget::createLayerSnapshot()
+{
+    // The snapshot is always a text layer, whatever the format of the layer, since it is only
+    // used to export the layer as text.
+    _snapshotCopyValue = [](PXR_NS::SdfSpecType           specType,
+                            const PXR_NS::TfToken&        field,
+                            const PXR_NS::SdfLayerHandle& srcLayer,
+                            const PXR_NS::SdfPath&        srcPath,
+                            bool                          fieldInSrc,
+                            const PXR_NS::SdfLayerHandle& dstLayer,
+                            const PXR_NS::SdfPath&        dstPath,
+                            bool                          fieldInDst,
+                            auto*                         valueToCopy) {
+        return PXR_NS::SdfShouldCopyValue(
+            PXR_NS::SdfPath::AbsoluteRootPath(),
+            PXR_NS::SdfPath::AbsoluteRootPath(),
+            specType,
+            field,
+            srcLayer,
+            srcPath,
+            fieldInSrc,
+            dstLayer,
+            dstPath,
+            fieldInDst,
+            valueToCopy);
+    };
+    return PXR_NS::SdfLayer::CreateAnonymous(".usda");
+}
+
+PXR_NS::SdfLayerRefPtr
+LayerContentsWidget::createPseudoLayer(const PXR_NS::SdfLayerRefPtr in_layer)
+{
+    // Make the empty pseudo layer. The pseudo layer is not a real layer and may have fields
+    // that would trigger notices that we don't want which cause the LE to rebuild, so notices
+    // are suspended while it is filled in.
     PXR_NS::SdfFileFormatConstRefPtr fmt;
     OutputType::ReportParams         params;
 
@@ -350,18 +672,25 @@ bool LayerContentsWidget::exportPseudoLayer(
 
     fmt = PXR_NS::TfCreateRefPtr(new OutputType::SdfFilterPseudoFileFormat(
         PXR_NS::TfStringPrintf("from @%s@", in_layer->GetIdentifier().c_str())));
-    auto pseudoLayer = PXR_NS::SdfLayer::CreateAnonymous(".pseudousda", fmt);
-
-    // Generate the layer content.
-    OutputType::FilterLayer(in_layer, pseudoLayer, params);
-
-    return pseudoLayer->ExportToString(&out_contents);
+    _snapshotCopyValue = OutputType::MakeFilterCopyValueFn(params);
+    return PXR_NS::SdfLayer::CreateAnonymous(".pseudousda", fmt);
 }
 
 void LayerContentsWidget::clear()
 {
+    cancelSnapshot();
+    cancelExport();
+    ++_exportRequestId;
+    _model.reset();
+    _currentPage = 0;
+    if (_navigationBar) {
+        _navigationBar->setVisible(false);
+        _primPathEdit->clear();
+    }
     if (_layerContents) {
         _layerContents->clear();
+        _layerContents->setPlaceholderText(
+            StringResources::getAsQString(StringResources::kDisplayLayerContentsEmpty));
         _isEmpty = true;
     }
 }
@@ -19,18 +19,32 @@
 // Needs to come first when used with VS2017 and Qt5.
 #include "pxr/usd/sdf/layer.h"
 
+#include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/path.h>
+
 #include <QtWidgets/QTextEdit>
 #include <QtWidgets/QtWidgets>
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 class QSyntaxHighlighter;
 QT_END_NAMESPACE
 
 namespace UsdLayerEditor {
 
+class LayerContentsModel;
+
 /**
  * @brief Widget used to display the contents of a layer. Owned by the LayerEditorWidget
  *
+ * The layer is copied in small steps on the UI thread, then exported to text on a worker thread
+ * and displayed one page at a time, so that only the visible page is held by the text editor
+ * and syntax-highlighted. Large layers can be
+ * navigated by page or by jumping directly to a prim path.
  */
 class LayerContentsWidget : public QWidget
 {
@@ -48,11 +62,45 @@ public:
 private:
     void createUI();
 
-    bool exportPseudoLayer(const PXR_NS::SdfLayerRefPtr in_layer, std::string& out_contents);
+    PXR_NS::SdfLayerRefPtr createPseudoLayer(const PXR_NS::SdfLayerRefPtr in_layer);
+    PXR_NS::SdfLayerRefPtr createLayerSnapshot();
+
+    void startSnapshot(const PXR_NS::SdfLayerRefPtr in_layer, bool expandAllValues);
+    void continueSnapshot();
+    void cancelSnapshot();
+    void timerEvent(QTimerEvent* event) override;
+
+    void startExport(PXR_NS::SdfLayerRefPtr snapshot, PXR_NS::SdfLayerRefPtr header);
+    void cancelExport();
+    void onExportFinished(uint64_t requestId, std::shared_ptr<const LayerContentsModel> model);
+
+    void showPage(size_t page);
+    void showLine(size_t line);
+    void goToPrim();
+
+    QPointer<QTextEdit>                       _layerContents;
+    QPointer<QSyntaxHighlighter>              _syntaxHighlighter;
+    QPointer<QWidget>                         _navigationBar;
+    QPointer<QLineEdit>                       _primPathEdit;
+    QPointer<QToolButton>                     _prevPageButton;
+    QPointer<QToolButton>                     _nextPageButton;
+    QPointer<QLabel>                          _pageLabel;
+    std::shared_ptr<const LayerContentsModel> _model;
+
+    // The layer being copied, the copy and its header, and the prims left to copy.
+    PXR_NS::SdfLayerRefPtr       _snapshotSource;
+    PXR_NS::SdfLayerRefPtr       _snapshot;
+    PXR_NS::SdfLayerRefPtr       _snapshotHeader;
+    std::vector<PXR_NS::SdfPath> _snapshotPending;
+    PXR_NS::SdfShouldCopyValueFn _snapshotCopyValue;
+    QBasicTimer                  _snapshotTimer;
 
-    QPointer<QTextEdit>          _layerContents;
-    QPointer<QSyntaxHighlighter> _syntaxHighlighter;
-    bool                         _isEmpty { true };
+    // Cancellation flag shared with the export thread, if any. The thread is detached, so it
+    // may outlive the widget: it only holds the flag and the layers it exports.
+    std::shared_ptr<std::atomic<bool>> _exportCancelled;
+    uint64_t                           _exportRequestId { 0 };
+    size_t                             _currentPage { 0 };
+    bool                               _isEmpty { true };
 };
 
 } // namespace UsdLayerEditor
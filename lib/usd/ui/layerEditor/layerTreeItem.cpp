@@ -131,6 +131,50 @@ int LayerTreeItem::depth() const
     return (parent == nullptr) ? 0 : 1 + parent->depth();
 }
 
+LayerTreeItem*
+LayerTreeItem::createSubLayerItem(const std::string& path, RecursionDetector* recursionDetector)
+{
+#if PXR_VERSION >= 2308
+    // Resolve any variable expressions in the path using the stage's expression variables,
+    // composed from root and session layer variables.
+    std::string resolvedPath = path;
+    if (_stage && SdfVariableExpression::IsExpression(path)) {
+        const auto stageRootLayerStack
+            = _stage->GetPseudoRoot().GetPrimIndex().GetRootNode().GetLayerStack();
+
+        if (stageRootLayerStack) {
+            const auto& expressionVars
+                = stageRootLayerStack->GetExpressionVariables().GetVariables();
+
+            const auto result
+                = SdfVariableExpression(path).EvaluateTyped<std::string>(expressionVars);
+
+            if (result.errors.empty() && !result.value.IsEmpty()) {
+                resolvedPath = result.value.UncheckedGet<std::string>();
+            }
+        }
+    }
+
+    std::string actualPath = SdfComputeAssetPathRelativeToLayer(_layer, resolvedPath);
+    auto        subLayer = SdfLayer::FindOrOpen(actualPath);
+#else
+    std::string actualPath = SdfComputeAssetPathRelativeToLayer(_layer, path);
+    auto        subLayer = SdfLayer::FindOrOpen(actualPath);
+#endif
+    if (subLayer && recursionDetector->contains(subLayer->GetRealPath())) {
+        return nullptr;
+    }
+    return new LayerTreeItem(
+        subLayer,
+        _stage,
+        LayerType::SubLayer,
+        path,
+        &_incomingLayers,
+        _isSharedStage,
+        &_sharedLayers,
+        recursionDetector);
+}
+
 // this algorithm works with muted layers
 void LayerTreeItem::populateChildren(RecursionDetector* recursionDetector)
 {
@@ -147,43 +191,7 @@ void LayerTreeItem::populateChildren(RecursionDetector* recursionDetector)
     recursionDetector->push(_layer->GetRealPath());
 
     for (auto const path : subPaths) {
-#if PXR_VERSION >= 2308
-        // Resolve any variable expressions in the path using the stage's expression variables,
-        // composed from root and session layer variables.
-        std::string resolvedPath = path;
-        if (_stage && SdfVariableExpression::IsExpression(path)) {
-            const auto stageRootLayerStack
-                = _stage->GetPseudoRoot().GetPrimIndex().GetRootNode().GetLayerStack();
-
-            if (stageRootLayerStack) {
-                const auto& expressionVars
-                    = stageRootLayerStack->GetExpressionVariables().GetVariables();
-
-                const auto result
-                    = SdfVariableExpression(path).EvaluateTyped<std::string>(expressionVars);
-
-                if (result.errors.empty() && !result.value.IsEmpty()) {
-                    resolvedPath = result.value.UncheckedGet<std::string>();
-                }
-            }
-        }
-
-        std::string actualPath = SdfComputeAssetPathRelativeToLayer(_layer, resolvedPath);
-        auto        subLayer = SdfLayer::FindOrOpen(actualPath);
-#else
-        std::string actualPath = SdfComputeAssetPathRelativeToLayer(_layer, path);
-        auto        subLayer = SdfLayer::FindOrOpen(actualPath);
-#endif
-        if (!subLayer || !recursionDetector->contains(subLayer->GetRealPath())) {
-            auto item = new LayerTreeItem(
-                subLayer,
-                _stage,
-                LayerType::SubLayer,
-                path,
-                &_incomingLayers,
-                _isSharedStage,
-                &_sharedLayers,
-                recursionDetector);
+        if (auto item = createSubLayerItem(path, recursionDetector)) {
             appendRow(item);
         }
     }
@@ -191,6 +199,63 @@ void LayerTreeItem::populateChildren(RecursionDetector* recursionDetector)
     recursionDetector->pop();
 }
 
+// only insert and remove the rows of the sublayers that changed
+void LayerTreeItem::updateSubLayers()
+{
+    if (isInvalidLayer()) {
+        if (rowCount() > 0)
+            removeRows(0, rowCount());
+        return;
+    }
+
+    const std::vector<std::string> newPaths = _layer->GetSubLayerPaths();
+    const LayerItemVector          oldItems = childrenVector();
+
+    // Find the range of sublayers that differ, keeping the unchanged rows at both ends.
+    // A single insertion, removal or move thus only touches the rows in between.
+    size_t prefix = 0;
+    while (prefix < oldItems.size() && prefix < newPaths.size()
+           && oldItems[prefix]->subLayerPath() == newPaths[prefix]) {
+        ++prefix;
+    }
+    size_t suffix = 0;
+    while (suffix < oldItems.size() - prefix && suffix < newPaths.size() - prefix
+           && oldItems[oldItems.size() - 1 - suffix]->subLayerPath()
+               == newPaths[newPaths.size() - 1 - suffix]) {
+        ++suffix;
+    }
+
+    const size_t numRemoved = oldItems.size() - prefix - suffix;
+    if (numRemoved > 0) {
+        removeRows(static_cast<int>(prefix), static_cast<int>(numRemoved));
+    }
+
+    const size_t numAdded = newPaths.size() - prefix - suffix;
+    if (numAdded == 0)
+        return;
+
+    // Children must not include any of their ancestors, so rebuild the ancestry.
+    RecursionDetector                 recursionDetector;
+    std::vector<const LayerTreeItem*> ancestors;
+    for (const LayerTreeItem* item = this; item; item = item->parentLayerItem()) {
+        ancestors.push_back(item);
+    }
+    for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+        if (!(*it)->isInvalidLayer())
+            recursionDetector.push((*it)->layer()->GetRealPath());
+    }
+
+    QList<QStandardItem*> newItems;
+    for (size_t i = prefix; i < prefix + numAdded; ++i) {
+        if (auto item = createSubLayerItem(newPaths[i], &recursionDetector)) {
+            newItems.append(item);
+        }
+    }
+    if (!newItems.isEmpty()) {
+        insertRows(static_cast<int>(prefix), newItems);
+    }
+}
+
 LayerItemVector LayerTreeItem::childrenVector() const
 {
     LayerItemVector result;
@@ -108,6 +108,8 @@ public:
 
     // refresh our data from the USD Layer
     void fetchData(RebuildChildren in_rebuild, RecursionDetector* in_recursionDetector = nullptr);
+    // refresh our children after the sublayer paths of the USD Layer changed
+    void updateSubLayers();
 
     enum Roles
     {
@@ -223,6 +225,9 @@ protected:
 
 protected:
     void populateChildren(RecursionDetector* in_recursionDetector);
+    // create the item of one of our sublayers, or nullptr if it would be recursive
+    LayerTreeItem*
+    createSubLayerItem(const std::string& path, RecursionDetector* in_recursionDetector);
     // helper to save anon layers called by saveEdits()
     void saveAnonymousLayer(QWidget* in_parent);
 
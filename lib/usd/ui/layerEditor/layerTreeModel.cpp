@@ -35,6 +35,7 @@
 #endif
 
 #include <pxr/base/tf/notice.h>
+#include <pxr/usd/sdf/schema.h>
 
 #include <maya/MDagModifier.h>
 #include <maya/MGlobal.h>
@@ -84,6 +85,7 @@ void LayerTreeModel::registerUsdNotifications(bool in_register)
         TfWeakPtr<LayerTreeModel> me(this);
         _noticeKeys.push_back(TfNotice::Register(me, &LayerTreeModel::usd_layerChanged));
         _noticeKeys.push_back(TfNotice::Register(me, &LayerTreeModel::usd_editTargetChanged));
+        _noticeKeys.push_back(TfNotice::Register(me, &LayerTreeModel::usd_layerMutingChanged));
         _noticeKeys.push_back(TfNotice::Register(
             me, &LayerTreeModel::usd_layerDirtinessChanged, TfWeakPtr<SdfLayer>(nullptr)));
 #ifdef WANT_ADSK_USD_EDIT_FORWARD_BUILD
@@ -318,6 +320,9 @@ void LayerTreeModel::rebuildModel(bool refreshLockState /*= false*/)
     _rebuildOnIdlePending = false;
     _lastAskedAnonLayerNameSinceRebuild = 0;
 
+    // A full rebuild supersedes any pending incremental update.
+    _pendingLayerUpdates.clear();
+
     if (_selectedLayerDataChanged) {
         Q_EMIT selectedLayerDataChangedSignal();
         _selectedLayerDataChanged = false;
@@ -477,12 +482,128 @@ void LayerTreeModel::updateTargetLayer(InRebuildModel inRebuild)
     }
 }
 
+void LayerTreeModel::updateLayerOnIdle(const SdfLayerHandle& layer, int updates)
+{
+    // Coalesce the updates of all the layers within one event-loop turn.
+    _pendingLayerUpdates[layer] |= updates;
+    if (!_updateOnIdlePending) {
+        _updateOnIdlePending = true;
+        QTimer::singleShot(0, this, [this]() { this->updateLayers(); });
+    }
+}
+
+void LayerTreeModel::updateLayers()
+{
+    _updateOnIdlePending = false;
+    if (_pendingLayerUpdates.empty())
+        return;
+
+    std::map<SdfLayerHandle, int> pendingUpdates;
+    pendingUpdates.swap(_pendingLayerUpdates);
+
+    // Content edits to any layer may affect what the layer contents widget displays.
+    Q_EMIT selectedLayerDataChangedSignal();
+
+    if (_rebuildOnIdlePending || !_sessionState->isValid() || rowCount() == 0) {
+        rebuildModelOnIdle();
+        return;
+    }
+
+    // The session layer gets shown or hidden depending on its dirty state when auto-hidden,
+    // which changes the top-level rows: let the full rebuild deal with it.
+    auto sessionLayer = _sessionState->stage()->GetSessionLayer();
+    if (_sessionState->autoHideSessionLayer()
+        && pendingUpdates.find(sessionLayer) != pendingUpdates.end()) {
+        auto       firstItem = dynamic_cast<LayerTreeItem*>(invisibleRootItem()->child(0));
+        const bool sessionShown = firstItem && firstItem->isSessionLayer();
+        const bool showSession
+            = sessionLayer->IsDirty() || sessionLayer == _sessionState->effectiveTargetLayer();
+        if (sessionShown != showSession) {
+            rebuildModelOnIdle();
+            return;
+        }
+    }
+
+    // A layer can appear more than once in the tree, so gather all the items of each layer
+    // with a single walk of the tree.
+    std::map<SdfLayerHandle, LayerItemVector> itemsByLayer;
+    for (auto item : getAllItems()) {
+        if (!item->isInvalidLayer() && pendingUpdates.count(item->layer()) > 0)
+            itemsByLayer[item->layer()].push_back(item);
+    }
+
+    bool subLayersChanged = false;
+    for (const auto& layerAndItems : itemsByLayer) {
+        const int updates = pendingUpdates[layerAndItems.first];
+        for (auto item : layerAndItems.second) {
+            if (updates & LayerUpdate_SubLayers) {
+                item->updateSubLayers();
+                subLayersChanged = true;
+            }
+            if (updates & LayerUpdate_Data) {
+                item->fetchData(RebuildChildren::No);
+            }
+            if (updates & LayerUpdate_Muting) {
+                // Muting a layer makes all its sublayers appear muted.
+                auto filter = [](const LayerTreeItem*) { return true; };
+                item->emitDataChanged();
+                for (auto child : getAllItems(filter, item))
+                    child->emitDataChanged();
+            }
+        }
+    }
+
+    if (subLayersChanged) {
+        _lastAskedAnonLayerNameSinceRebuild = 0;
+        // New items need to know if they are the edit target.
+        updateTargetLayer(InRebuildModel::Yes);
+    }
+}
+
 // notification from USD
 void LayerTreeModel::usd_layerChanged(SdfNotice::LayersDidChangeSentPerLayer const& notice)
 {
-    // experienced crashes in python prototype  For now, rebuild everything
-    if (!_blockUsdNotices)
-        rebuildModelOnIdle(true);
+    if (_blockUsdNotices)
+        return;
+
+    // Only the changes made to the layer itself (as opposed to the specs it contains) affect
+    // the tree: sublayers added, removed or reordered, and the layer being renamed, replaced
+    // or reloaded. Only the items of the affected layers are updated.
+    for (const auto& layerAndChanges : notice.GetChangeListVec()) {
+        int updates = LayerUpdate_Data;
+        for (const auto& pathAndEntry : layerAndChanges.second.GetEntryList()) {
+            if (pathAndEntry.first != SdfPath::AbsoluteRootPath())
+                continue;
+
+            const SdfChangeList::Entry& entry = pathAndEntry.second;
+            if (!entry.subLayerChanges.empty() || entry.flags.didReplaceContent
+                || entry.flags.didReloadContent) {
+                updates |= LayerUpdate_SubLayers;
+            }
+            for (const auto& info : entry.infoChanged) {
+                if (info.first == SdfFieldKeys->SubLayers) {
+                    updates |= LayerUpdate_SubLayers;
+                }
+            }
+        }
+        updateLayerOnIdle(layerAndChanges.first, updates);
+    }
+}
+
+// notification from USD
+void LayerTreeModel::usd_layerMutingChanged(UsdNotice::LayerMutingChanged const& notice)
+{
+    if (_blockUsdNotices)
+        return;
+    if (!_sessionState || notice.GetStage() != _sessionState->stage())
+        return;
+
+    for (const auto& layers : { notice.GetMutedLayers(), notice.GetUnmutedLayers() }) {
+        for (const std::string& identifier : layers) {
+            if (auto layer = SdfLayer::Find(identifier))
+                updateLayerOnIdle(layer, LayerUpdate_Muting);
+        }
+    }
 }
 
 // notification from USD
@@ -26,6 +26,7 @@
 
 #include <QtGui/QStandardItemModel>
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -137,6 +138,7 @@ protected:
     void registerUsdNotifications(bool in_register);
     void usd_layerChanged(PXR_NS::SdfNotice::LayersDidChangeSentPerLayer const& notice);
     void usd_editTargetChanged(PXR_NS::UsdNotice::StageEditTargetChanged const& notice);
+    void usd_layerMutingChanged(PXR_NS::UsdNotice::LayerMutingChanged const& notice);
 #ifdef WANT_ADSK_USD_EDIT_FORWARD_BUILD
     void usd_efFallbackTargetChanged(MayaUsdEFFallbackTargetChangedNotice const& notice);
 #endif
@@ -156,6 +158,18 @@ protected:
     bool _rebuildOnIdleRefreshLockState = false;
     void rebuildModel(bool refreshLockState = false);
 
+    // incremental updates of the items of individual layers, coalesced per event-loop turn
+    enum LayerUpdate
+    {
+        LayerUpdate_Data = (1 << 0),      // display name and other item data
+        LayerUpdate_SubLayers = (1 << 1), // sublayers were added, removed or reordered
+        LayerUpdate_Muting = (1 << 2)     // the layer was muted or unmuted
+    };
+    void updateLayerOnIdle(const PXR_NS::SdfLayerHandle& layer, int updates);
+    void updateLayers();
+    std::map<PXR_NS::SdfLayerHandle, int> _pendingLayerUpdates;
+    bool                                  _updateOnIdlePending = false;
+
     void updateTargetLayer(InRebuildModel inRebuild);
 };
 
@@ -52,6 +52,9 @@ const auto kAddSublayer                  { create("kAddSublayer", "Add sublayer"
 const auto kAutoHideSessionLayer         { create("kAutoHideSessionLayer", "Auto-Hide Session Layer") };
 const auto kDisplayLayerContents         { create("kDisplayLayerContents", "Display Layer Content") };
 const auto kDisplayLayerContentsEmpty    { create("kDisplayLayerContentsEmpty", "Select a single layer to display the contents.\n\nLarge layers may take longer to load.") };
+const auto kDisplayLayerContentsLoading  { create("kDisplayLayerContentsLoading", "Loading layer contents...") };
+const auto kDisplayLayerContentsGoToPrim { create("kDisplayLayerContentsGoToPrim", "Go to prim path") };
+const auto kDisplayLayerContentsPageInfo { create("kDisplayLayerContentsPageInfo", "Lines ^1s-^2s of ^3s") };
 #ifdef WANT_ADSK_USD_EDIT_FORWARD_BUILD
 const auto kToggleEditForwarding         { create("kToggleEditForwarding", "Toggle Edit Forwarding") };
 const auto kEchoEditForwarding           { create("kEchoEditForwarding", "Echo Edit Forwarding in Script Editor") };
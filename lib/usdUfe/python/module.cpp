@@ -29,4 +29,6 @@ TF_WRAP_MODULE
     TF_WRAP(Tokens);
     TF_WRAP(Utils);
     TF_WRAP(Commands);
+    TF_WRAP(BatchAttributes);
+    TF_WRAP(ChildrenCursor);
 }
@@ -0,0 +1,115 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <usdUfe/ufe/UsdBatchAttributes.h>
+
+#include <pxr/base/tf/pyObjWrapper.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/pyConversions.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr_python.h>
+
+#include <string>
+#include <vector>
+
+using namespace PXR_BOOST_PYTHON_NAMESPACE;
+
+namespace {
+
+UsdUfe::UsdBatchAttributes* BatchAttributesInit(
+    const std::vector<PXR_NS::UsdPrim>& prims,
+    const std::vector<std::string>&     names)
+{
+    return new UsdUfe::UsdBatchAttributes(prims, names);
+}
+
+// Values are returned as a list of columns, one per attribute name, with None
+// for the items that do not have the attribute.
+list _getValues(const UsdUfe::UsdBatchAttributes& self, PXR_NS::UsdTimeCode time)
+{
+    list columns;
+    for (const auto& column : self.getValues(time)) {
+        list pyColumn;
+        for (const PXR_NS::VtValue& value : column) {
+            pyColumn.append(value);
+        }
+        columns.append(pyColumn);
+    }
+    return columns;
+}
+
+UsdUfe::UsdUndoBatchSetAttributesCommand::Ptr _setValuesCmd(
+    const UsdUfe::UsdBatchAttributes& self,
+    const object&                     pyColumns,
+    PXR_NS::UsdTimeCode               time)
+{
+    // Convert the Python values to the type of each attribute, as
+    // Usd.Attribute.Set() does, so that strings can be set on tokens, etc.
+    std::vector<UsdUfe::UsdBatchAttributes::Column> columns;
+    size_t                                          nameIndex = 0;
+    for (stl_input_iterator<object> pyColumn(pyColumns), end; pyColumn != end; ++pyColumn) {
+        UsdUfe::UsdBatchAttributes::Column column;
+        size_t                             itemIndex = 0;
+        for (stl_input_iterator<object> pyValue(*pyColumn); pyValue != end; ++pyValue) {
+            const PXR_NS::UsdAttribute attr = self.attribute(itemIndex++, nameIndex);
+            if ((*pyValue).is_none() || !attr) {
+                column.emplace_back();
+            } else {
+                column.push_back(PXR_NS::UsdPythonToSdfType(
+                    PXR_NS::TfPyObjWrapper(*pyValue), attr.GetTypeName()));
+            }
+        }
+        columns.push_back(std::move(column));
+        ++nameIndex;
+    }
+
+    return std::dynamic_pointer_cast<UsdUfe::UsdUndoBatchSetAttributesCommand>(
+        self.setValuesCmd(columns, time));
+}
+
+} // namespace
+
+void wrapBatchAttributes()
+{
+    {
+        using This = UsdUfe::UsdBatchAttributes;
+        class_<This, PXR_BOOST_PYTHON_NAMESPACE::noncopyable>("BatchAttributes", no_init)
+            .def("__init__", make_constructor(BatchAttributesInit))
+            .def("itemCount", &This::itemCount)
+            .def("names", &This::names, return_value_policy<copy_const_reference>())
+            .def("hasAttribute", &This::hasAttribute)
+            .def(
+                "getValues",
+                _getValues,
+                (arg("self"), arg("time") = PXR_NS::UsdTimeCode::Default()))
+            .def(
+                "setValuesCmd",
+                _setValuesCmd,
+                (arg("self"), arg("columns"), arg("time") = PXR_NS::UsdTimeCode::Default()));
+    }
+    {
+        using This = UsdUfe::UsdUndoBatchSetAttributesCommand;
+        class_<This, This::Ptr, PXR_BOOST_PYTHON_NAMESPACE::noncopyable>(
+            "BatchSetAttributesCommand", no_init)
+            .def("execute", &This::execute)
+#ifdef UFE_V4_FEATURES_AVAILABLE
+            .def("commandString", &This::commandString)
+#endif
+            .def("undo", &This::undo)
+            .def("redo", &This::redo);
+    }
+}
@@ -0,0 +1,81 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <usdUfe/ufe/UsdHierarchy.h>
+
+#include <pxr_python.h>
+
+#include <ufe/hierarchy.h>
+#include <ufe/pathString.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace PXR_BOOST_PYTHON_NAMESPACE;
+
+namespace {
+
+UsdUfe::UsdHierarchy::Ptr _usdHierarchy(const std::string& ufePathString)
+{
+    const auto item = Ufe::Hierarchy::createItem(Ufe::PathString::path(ufePathString));
+    auto       hierarchy = item
+              ? std::dynamic_pointer_cast<UsdUfe::UsdHierarchy>(Ufe::Hierarchy::hierarchy(item))
+              : nullptr;
+    if (!hierarchy) {
+        throw std::runtime_error("No USD hierarchy for " + ufePathString);
+    }
+    return hierarchy;
+}
+
+UsdUfe::UsdChildrenCursor* ChildrenCursorInit(const std::string& ufePathString)
+{
+    return new UsdUfe::UsdChildrenCursor(_usdHierarchy(ufePathString));
+}
+
+// The child filter is given as the names of the filter flags to turn on, for
+// example "InactivePrims", since UFE objects cannot be passed in here.
+UsdUfe::UsdChildrenCursor* FilteredChildrenCursorInit(
+    const std::string&              ufePathString,
+    const std::vector<std::string>& enabledFilterFlags)
+{
+    Ufe::Hierarchy::ChildFilter childFilter;
+    for (const auto& name : enabledFilterFlags) {
+        childFilter.emplace_back(name, name, true);
+    }
+    return new UsdUfe::UsdChildrenCursor(_usdHierarchy(ufePathString), childFilter);
+}
+
+// The children are returned as UFE path strings.
+list _next(UsdUfe::UsdChildrenCursor& self, size_t count)
+{
+    list paths;
+    for (const auto& child : self.next(count)) {
+        paths.append(Ufe::PathString::string(child->path()));
+    }
+    return paths;
+}
+
+} // namespace
+
+void wrapChildrenCursor()
+{
+    using This = UsdUfe::UsdChildrenCursor;
+    class_<This, PXR_BOOST_PYTHON_NAMESPACE::noncopyable>("ChildrenCursor", no_init)
+        .def("__init__", make_constructor(ChildrenCursorInit))
+        .def("__init__", make_constructor(FilteredChildrenCursorInit))
+        .def("next", _next, (arg("self"), arg("count")))
+        .def("atEnd", &This::atEnd);
+}
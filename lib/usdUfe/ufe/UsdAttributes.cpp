@@ -270,18 +270,17 @@ Ufe::Attribute::Ptr UsdAttributes::attribute(const std::string& name)
 std::vector<std::string> UsdAttributes::attributeNames() const
 {
     std::vector<std::string> names;
-    std::set<std::string>    nameSet;
-    std::string              name;
+    PXR_NS::TfToken::HashSet shaderNames;
 #ifdef UFE_V4_FEATURES_AVAILABLE
     PXR_NS::SdrShaderNodeConstPtr shaderNode = usdShaderNodeFromSceneItem(_item);
     if (shaderNode) {
         auto addAttributeNames
-            = [&names, &nameSet, &name](
+            = [&names, &shaderNames](
                   auto const& shortNames, PXR_NS::UsdShadeAttributeType attrType) {
                   for (auto const& shortName : shortNames) {
-                      name = PXR_NS::UsdShadeUtils::GetFullName(shortName, attrType);
-                      names.push_back(name);
-                      nameSet.insert(name);
+                      auto fullName = PXR_NS::UsdShadeUtils::GetFullName(shortName, attrType);
+                      names.push_back(fullName.GetString());
+                      shaderNames.insert(std::move(fullName));
                   }
               };
 #if PXR_VERSION >= 2505
@@ -295,11 +294,12 @@ std::vector<std::string> UsdAttributes::attributeNames() const
     }
 #endif
     if (_prim) {
-        auto primAttrs = _prim.GetProperties();
-        for (const auto& attr : primAttrs) {
-            name = attr.GetName();
-            if (nameSet.find(name) == nameSet.end()) {
-                names.push_back(name);
+        // Only the names are needed: avoid building a UsdProperty per property.
+        const PXR_NS::TfTokenVector propNames = _prim.GetPropertyNames();
+        names.reserve(names.size() + propNames.size());
+        for (const auto& propName : propNames) {
+            if (shaderNames.empty() || shaderNames.count(propName) == 0) {
+                names.push_back(propName.GetString());
             }
         }
     }
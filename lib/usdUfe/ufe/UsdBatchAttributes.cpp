@@ -0,0 +1,328 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UsdBatchAttributes.h"
+
+#include <usdUfe/ufe/StagesSubject.h>
+#include <usdUfe/ufe/UfeNotifGuard.h>
+#include <usdUfe/ufe/Utils.h>
+#include <usdUfe/utils/editRouterContext.h>
+
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usd/stage.h>
+
+namespace USDUFE_NS_DEF {
+
+USDUFE_VERIFY_CLASS_SETUP(Ufe::UndoableCommand, UsdUndoBatchSetAttributesCommand);
+
+//------------------------------------------------------------------------------
+// UsdBatchAttributes
+//------------------------------------------------------------------------------
+
+UsdBatchAttributes::UsdBatchAttributes(
+    const std::vector<PXR_NS::UsdPrim>& prims,
+    const std::vector<std::string>&     names)
+    : _stages(prims.size())
+    , _paths(prims.size())
+    , _names(names)
+    , _dirty(prims.size(), false)
+    , _prims(prims)
+    , _queries(prims.size() * names.size())
+{
+    _nameTokens.reserve(_names.size());
+    for (const std::string& name : _names) {
+        _nameTokens.emplace_back(name);
+    }
+
+    for (size_t itemIndex = 0; itemIndex < _prims.size(); ++itemIndex) {
+        const PXR_NS::UsdPrim& prim = _prims[itemIndex];
+        if (prim) {
+            _stages[itemIndex] = prim.GetStage();
+            _paths[itemIndex] = prim.GetPath();
+            _itemsByPath.emplace(_paths[itemIndex], itemIndex);
+        }
+    }
+
+    // Resolving the value sources is the costly part of a query, and it only
+    // reads the stage, so the items are resolved in parallel.
+    PXR_NS::WorkParallelForN(_prims.size(), [this](size_t begin, size_t end) {
+        for (size_t itemIndex = begin; itemIndex < end; ++itemIndex) {
+            createQueries(itemIndex);
+        }
+    });
+
+    _objectsChangedKey = PXR_NS::TfNotice::Register(
+        PXR_NS::TfCreateWeakPtr(this), &UsdBatchAttributes::onObjectsChanged);
+}
+
+UsdBatchAttributes::~UsdBatchAttributes() { PXR_NS::TfNotice::Revoke(_objectsChangedKey); }
+
+/*static*/
+UsdBatchAttributes::Ptr UsdBatchAttributes::create(
+    const std::vector<PXR_NS::UsdPrim>& prims,
+    const std::vector<std::string>&     names)
+{
+    return std::make_shared<UsdBatchAttributes>(prims, names);
+}
+
+/*static*/
+UsdBatchAttributes::Ptr
+UsdBatchAttributes::create(const Ufe::Selection& selection, const std::vector<std::string>& names)
+{
+    std::vector<PXR_NS::UsdPrim> prims;
+    prims.reserve(selection.size());
+    for (const Ufe::SceneItem::Ptr& item : selection) {
+        const UsdSceneItem::Ptr usdItem = downcast(item);
+        prims.push_back(usdItem ? usdItem->prim() : PXR_NS::UsdPrim());
+    }
+    return create(prims, names);
+}
+
+bool UsdBatchAttributes::hasAttribute(size_t itemIndex, size_t nameIndex) const
+{
+    if (itemIndex >= _prims.size() || nameIndex >= _names.size()) {
+        return false;
+    }
+    updateQueries();
+    return _queries[itemIndex * _names.size() + nameIndex].IsValid();
+}
+
+PXR_NS::UsdAttribute UsdBatchAttributes::attribute(size_t itemIndex, size_t nameIndex) const
+{
+    if (!hasAttribute(itemIndex, nameIndex)) {
+        return {};
+    }
+    return _queries[itemIndex * _names.size() + nameIndex].GetAttribute();
+}
+
+std::vector<UsdBatchAttributes::Column>
+UsdBatchAttributes::getValues(PXR_NS::UsdTimeCode time) const
+{
+    const size_t        nameCount = _names.size();
+    std::vector<Column> columns(nameCount, Column(_prims.size()));
+    if (_queries.empty()) {
+        return columns;
+    }
+    updateQueries();
+
+    PXR_NS::WorkParallelForN(_prims.size(), [&](size_t begin, size_t end) {
+        for (size_t itemIndex = begin; itemIndex < end; ++itemIndex) {
+            const PXR_NS::UsdAttributeQuery* queries = &_queries[itemIndex * nameCount];
+            for (size_t nameIndex = 0; nameIndex < nameCount; ++nameIndex) {
+                if (queries[nameIndex].IsValid()) {
+                    queries[nameIndex].Get(&columns[nameIndex][itemIndex], time);
+                }
+            }
+        }
+    });
+
+    return columns;
+}
+
+UsdBatchAttributes::Column
+UsdBatchAttributes::getValues(size_t nameIndex, PXR_NS::UsdTimeCode time) const
+{
+    if (nameIndex >= _names.size()) {
+        return {};
+    }
+
+    const size_t nameCount = _names.size();
+    Column       column(_prims.size());
+    updateQueries();
+
+    PXR_NS::WorkParallelForN(_prims.size(), [&](size_t begin, size_t end) {
+        for (size_t itemIndex = begin; itemIndex < end; ++itemIndex) {
+            const PXR_NS::UsdAttributeQuery& query = _queries[itemIndex * nameCount + nameIndex];
+            if (query.IsValid()) {
+                query.Get(&column[itemIndex], time);
+            }
+        }
+    });
+
+    return column;
+}
+
+Ufe::UndoableCommand::Ptr
+UsdBatchAttributes::setValuesCmd(const std::vector<Column>& columns, PXR_NS::UsdTimeCode time) const
+{
+    const size_t nameCount = _names.size();
+    if (columns.size() != nameCount) {
+        return nullptr;
+    }
+    for (const Column& column : columns) {
+        if (column.size() != _prims.size()) {
+            return nullptr;
+        }
+    }
+    updateQueries();
+
+    std::vector<UsdUndoBatchSetAttributesCommand::Edit> edits;
+    for (size_t itemIndex = 0; itemIndex < _prims.size(); ++itemIndex) {
+        for (size_t nameIndex = 0; nameIndex < nameCount; ++nameIndex) {
+            const PXR_NS::VtValue& value = columns[nameIndex][itemIndex];
+            if (value.IsEmpty()) {
+                continue;
+            }
+
+            const PXR_NS::UsdAttributeQuery& query = _queries[itemIndex * nameCount + nameIndex];
+            if (!query.IsValid()) {
+                continue;
+            }
+
+            const PXR_NS::UsdAttribute& attr = query.GetAttribute();
+            std::string                 errMsg;
+            AttributeEditRouterContext  ctx(attr.GetPrim(), attr.GetName());
+            if (!isAttributeEditAllowed(attr, &errMsg)) {
+                displayMessage(MessageType::kError, errMsg);
+                return nullptr;
+            }
+
+            edits.push_back({ attr, value });
+        }
+    }
+
+    return UsdUndoBatchSetAttributesCommand::create(std::move(edits), time);
+}
+
+void UsdBatchAttributes::onObjectsChanged(const PXR_NS::UsdNotice::ObjectsChanged& notice)
+{
+    const PXR_NS::UsdStageWeakPtr stage = notice.GetStage();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto markDirty = [this, &stage](size_t itemIndex) {
+        if (_stages[itemIndex] == stage) {
+            _dirty[itemIndex] = true;
+            _anyDirty = true;
+        }
+    };
+
+    // A resync affects the items at or below the resynced path.
+    for (const PXR_NS::SdfPath& path : notice.GetResyncedPaths()) {
+        const PXR_NS::SdfPath primPath = path.GetPrimPath();
+        for (auto it = _itemsByPath.lower_bound(primPath);
+             it != _itemsByPath.end() && it->first.HasPrefix(primPath);
+             ++it) {
+            markDirty(it->second);
+        }
+    }
+
+    // A new opinion, like one set through this batch, changes where the value
+    // of the attribute comes from.
+    for (const PXR_NS::SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        if (path.IsAbsoluteRootPath()) {
+            for (size_t itemIndex = 0; itemIndex < _dirty.size(); ++itemIndex) {
+                markDirty(itemIndex);
+            }
+            continue;
+        }
+        const auto range = _itemsByPath.equal_range(path.GetPrimPath());
+        for (auto it = range.first; it != range.second; ++it) {
+            markDirty(it->second);
+        }
+    }
+}
+
+void UsdBatchAttributes::updateQueries() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_anyDirty) {
+        return;
+    }
+
+    std::vector<size_t> dirtyItems;
+    for (size_t itemIndex = 0; itemIndex < _dirty.size(); ++itemIndex) {
+        if (_dirty[itemIndex]) {
+            dirtyItems.push_back(itemIndex);
+            _dirty[itemIndex] = false;
+        }
+    }
+    _anyDirty = false;
+
+    PXR_NS::WorkParallelForN(dirtyItems.size(), [this, &dirtyItems](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const size_t itemIndex = dirtyItems[i];
+
+            // A resync replaces the prim, so look it up again.
+            const PXR_NS::UsdStageWeakPtr& stage = _stages[itemIndex];
+            _prims[itemIndex] = stage ? stage->GetPrimAtPath(_paths[itemIndex]) : PXR_NS::UsdPrim();
+            createQueries(itemIndex);
+        }
+    });
+}
+
+void UsdBatchAttributes::createQueries(size_t itemIndex) const
+{
+    const size_t nameCount = _names.size();
+    const auto   first = _queries.begin() + itemIndex * nameCount;
+
+    const PXR_NS::UsdPrim& prim = _prims[itemIndex];
+    if (!prim) {
+        for (auto query = first; query != first + nameCount; ++query) {
+            *query = PXR_NS::UsdAttributeQuery();
+        }
+        return;
+    }
+    std::vector<PXR_NS::UsdAttributeQuery> queries
+        = PXR_NS::UsdAttributeQuery::CreateQueries(prim, _nameTokens);
+    std::move(queries.begin(), queries.end(), first);
+}
+
+//------------------------------------------------------------------------------
+// UsdUndoBatchSetAttributesCommand
+//------------------------------------------------------------------------------
+
+UsdUndoBatchSetAttributesCommand::UsdUndoBatchSetAttributesCommand(
+    std::vector<Edit>&& edits,
+    PXR_NS::UsdTimeCode time)
+    : _edits(std::move(edits))
+    , _time(time)
+{
+}
+
+/*static*/
+UsdUndoBatchSetAttributesCommand::Ptr
+UsdUndoBatchSetAttributesCommand::create(std::vector<Edit>&& edits, PXR_NS::UsdTimeCode time)
+{
+    return std::make_shared<UsdUndoBatchSetAttributesCommand>(std::move(edits), time);
+}
+
+void UsdUndoBatchSetAttributesCommand::executeImplementation()
+{
+    // The guard must outlive the change block, so that the UFE notifications
+    // are sent once USD has processed the whole batch.
+    InSetAttribute                    inSetAttr;
+    AttributeChangedNotificationGuard guard;
+    PXR_NS::SdfChangeBlock            changeBlock;
+
+    for (const Edit& edit : _edits) {
+        AttributeEditRouterContext ctx(edit.attribute.GetPrim(), edit.attribute.GetName());
+        edit.attribute.Set(edit.value, _time);
+    }
+}
+
+void UsdUndoBatchSetAttributesCommand::undo()
+{
+    InSetAttribute inSetAttr;
+    UsdUndoableCommand<Ufe::UndoableCommand>::undo();
+}
+
+void UsdUndoBatchSetAttributesCommand::redo()
+{
+    InSetAttribute inSetAttr;
+    UsdUndoableCommand<Ufe::UndoableCommand>::redo();
+}
+
+} // namespace USDUFE_NS_DEF
@@ -0,0 +1,180 @@
+//
+// Copyright 2025 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef USDUFE_USDBATCHATTRIBUTES_H
+#define USDUFE_USDBATCHATTRIBUTES_H
+
+#include <usdUfe/base/api.h>
+#include <usdUfe/ufe/UfeVersionCompat.h>
+#include <usdUfe/ufe/UsdUndoableCommand.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/attributeQuery.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <ufe/selection.h>
+#include <ufe/undoableCommand.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace USDUFE_NS_DEF {
+
+//! \brief Access to the same attributes on many USD scene items at once.
+/*!
+    Going through Ufe::Attributes for each selected item and each attribute
+    rebuilds the attribute names and resolves the value sources of the USD
+    attribute on every get. This class resolves a UsdAttributeQuery once per
+    item and attribute name, and then reads all the values in parallel in
+    columnar form: one column per attribute name, one row per item, in the
+    order of the items given at construction.
+
+    Items that are not USD scene items, or that do not have a given attribute,
+    get an empty VtValue in the corresponding row.
+
+    The queries cache the value resolution of the attributes, so the queries
+    of the items touched by a stage change, including the values set through
+    setValuesCmd(), are rebuilt before they are next used.
+*/
+class USDUFE_PUBLIC UsdBatchAttributes : public PXR_NS::TfWeakBase
+{
+public:
+    using Ptr = std::shared_ptr<UsdBatchAttributes>;
+
+    //! Values of one attribute for all items, in item order.
+    using Column = std::vector<PXR_NS::VtValue>;
+
+    UsdBatchAttributes(
+        const std::vector<PXR_NS::UsdPrim>& prims,
+        const std::vector<std::string>&     names);
+
+    ~UsdBatchAttributes();
+
+    USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UsdBatchAttributes);
+
+    //! Create a UsdBatchAttributes for the given prims.
+    static Ptr
+    create(const std::vector<PXR_NS::UsdPrim>& prims, const std::vector<std::string>& names);
+
+    //! Create a UsdBatchAttributes for the items of the selection.
+    static Ptr create(const Ufe::Selection& selection, const std::vector<std::string>& names);
+
+    //! Number of items, which is the size of each column.
+    size_t itemCount() const { return _prims.size(); }
+
+    //! Names of the attributes, in column order.
+    const std::vector<std::string>& names() const { return _names; }
+
+    //! Returns true if the item at \p itemIndex has the attribute at \p nameIndex.
+    bool hasAttribute(size_t itemIndex, size_t nameIndex) const;
+
+    //! Attribute at \p nameIndex on the item at \p itemIndex, invalid if none.
+    PXR_NS::UsdAttribute attribute(size_t itemIndex, size_t nameIndex) const;
+
+    //! Get the values of all attributes for all items at the given time.
+    std::vector<Column> getValues(PXR_NS::UsdTimeCode time = PXR_NS::UsdTimeCode::Default()) const;
+
+    //! Get the values of the attribute at \p nameIndex for all items.
+    Column
+    getValues(size_t nameIndex, PXR_NS::UsdTimeCode time = PXR_NS::UsdTimeCode::Default()) const;
+
+    //! Create a command setting the values of all attributes for all items.
+    //! \p columns must have one column per attribute name, each with one row
+    //! per item. Empty values are left untouched. Returns nullptr if the sizes
+    //! do not match or if editing any of the attributes is not allowed.
+    Ufe::UndoableCommand::Ptr setValuesCmd(
+        const std::vector<Column>& columns,
+        PXR_NS::UsdTimeCode        time = PXR_NS::UsdTimeCode::Default()) const;
+
+private:
+    void onObjectsChanged(const PXR_NS::UsdNotice::ObjectsChanged& notice);
+
+    //! Rebuild the queries of the items marked dirty by stage changes.
+    void updateQueries() const;
+    void createQueries(size_t itemIndex) const;
+
+    std::vector<PXR_NS::UsdStageWeakPtr> _stages;
+    std::vector<PXR_NS::SdfPath>         _paths;
+    std::vector<std::string>             _names;
+    PXR_NS::TfTokenVector                _nameTokens;
+    PXR_NS::TfNotice::Key                _objectsChangedKey;
+
+    // Item indices by prim path, ordered so that the items below a resynced
+    // path form a single range.
+    std::multimap<PXR_NS::SdfPath, size_t> _itemsByPath;
+
+    mutable std::mutex                   _mutex;
+    mutable std::vector<bool>            _dirty;
+    mutable bool                         _anyDirty = false;
+    mutable std::vector<PXR_NS::UsdPrim> _prims;
+
+    // One query per item and attribute name, indexed by
+    // itemIndex * _names.size() + nameIndex.
+    mutable std::vector<PXR_NS::UsdAttributeQuery> _queries;
+
+}; // UsdBatchAttributes
+
+//! \brief Undoable command setting many attribute values at once.
+/*!
+    All values are authored inside a single SdfChangeBlock and captured in a
+    single undoable item, so that undo and redo are one operation, and a
+    single round of USD change processing happens for the whole batch.
+*/
+class USDUFE_PUBLIC UsdUndoBatchSetAttributesCommand
+    : public UsdUndoableCommand<Ufe::UndoableCommand>
+{
+public:
+    using Ptr = std::shared_ptr<UsdUndoBatchSetAttributesCommand>;
+
+    //! Value to author on an attribute.
+    struct Edit
+    {
+        PXR_NS::UsdAttribute attribute;
+        PXR_NS::VtValue      value;
+    };
+
+    UsdUndoBatchSetAttributesCommand(std::vector<Edit>&& edits, PXR_NS::UsdTimeCode time);
+
+    USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UsdUndoBatchSetAttributesCommand);
+
+    //! Create a UsdUndoBatchSetAttributesCommand.
+    static Ptr create(std::vector<Edit>&& edits, PXR_NS::UsdTimeCode time);
+
+    void undo() override;
+    void redo() override;
+
+    UFE_V4(std::string commandString() const override { return "BatchSetAttributes"; })
+
+protected:
+    void executeImplementation() override;
+
+private:
+    const std::vector<Edit>   _edits;
+    const PXR_NS::UsdTimeCode _time;
+
+}; // UsdUndoBatchSetAttributesCommand
+
+} // namespace USDUFE_NS_DEF
+
+#endif // USDUFE_USDBATCHATTRIBUTES_H
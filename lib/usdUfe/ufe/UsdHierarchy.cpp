@@ -149,35 +149,23 @@ Ufe::SceneItem::Ptr UsdHierarchy::sceneItem() const { return _item; }
 
 bool UsdHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !children().empty();
+    // The Outliner asks every visible row whether it has children, so stop at
+    // the first child instead of creating the scene items of all of them.
+    return hasUFEChildren(getUSDFilteredChildren(_item), true /*filterInactive*/);
 }
 
 bool UsdHierarchy::hasFilteredChildren(const ChildFilter& childFilter) const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !filteredChildren(childFilter).empty();
+    Usd_PrimFlagsPredicate flags = UsdUfe::getUsdPredicate(childFilter);
+    return hasUFEChildren(getUSDFilteredChildren(_item, flags), false);
 }
 
 #else
 
 bool UsdHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
     const bool isFilteringInactive = false;
-    return !createUFEChildList(getUSDFilteredChildren(_item), isFilteringInactive).empty();
+    return hasUFEChildren(getUSDFilteredChildren(_item), isFilteringInactive);
 }
 
 #endif
@@ -212,15 +200,40 @@ UsdHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool filterIn
     // empty scene item list as a result.
     Ufe::SceneItemList children;
     for (const auto& child : range) {
-        // Give derived classes a chance to process this child.
-        if (childrenHook(child, children, filterInactive))
-            continue;
+        appendUFEChildren(child, filterInactive, children);
+    }
+    return children;
+}
+
+void UsdHierarchy::appendUFEChildren(
+    const UsdPrim&      child,
+    bool                filterInactive,
+    Ufe::SceneItemList& children) const
+{
+    // Give derived classes a chance to process this child.
+    if (childrenHook(child, children, filterInactive))
+        return;
 
-        if (!filterInactive || child.IsActive()) {
-            children.emplace_back(UsdSceneItem::create(_item->path() + child.GetName(), child));
+    if (!filterInactive || child.IsActive()) {
+        children.emplace_back(UsdSceneItem::create(_item->path() + child.GetName(), child));
+    }
+}
+
+bool UsdHierarchy::hasUFEChildren(const UsdPrimSiblingRange& range, bool filterInactive) const
+{
+    // Same logic as createUFEChildList(), without creating the scene items.
+    Ufe::SceneItemList hookChildren;
+    for (const auto& child : range) {
+        if (childrenHook(child, hookChildren, filterInactive)) {
+            if (!hookChildren.empty())
+                return true;
+            continue;
         }
+
+        if (!filterInactive || child.IsActive())
+            return true;
     }
-    return children;
+    return false;
 }
 
 Ufe::SceneItem::Ptr UsdHierarchy::parent() const
@@ -332,4 +345,54 @@ Ufe::UndoableCommand::Ptr UsdHierarchy::ungroupCmd() const
 }
 #endif // UFE_V3_FEATURES_AVAILABLE
 
+//------------------------------------------------------------------------------
+// UsdChildrenCursor
+//------------------------------------------------------------------------------
+
+UsdChildrenCursor::UsdChildrenCursor(const UsdHierarchy::Ptr& hierarchy)
+    : _hierarchy(hierarchy)
+    , _filterInactive(true)
+{
+    const UsdPrimSiblingRange range = getUSDFilteredChildren(_hierarchy->_item);
+    _current = range.begin();
+    _end = range.end();
+    fetch();
+}
+
+UsdChildrenCursor::UsdChildrenCursor(
+    const UsdHierarchy::Ptr&           hierarchy,
+    const Ufe::Hierarchy::ChildFilter& childFilter)
+    : _hierarchy(hierarchy)
+    , _filterInactive(false)
+{
+    const UsdPrimSiblingRange range
+        = getUSDFilteredChildren(_hierarchy->_item, UsdUfe::getUsdPredicate(childFilter));
+    _current = range.begin();
+    _end = range.end();
+    fetch();
+}
+
+Ufe::SceneItemList UsdChildrenCursor::next(size_t count)
+{
+    Ufe::SceneItemList children;
+    while (children.size() < count && !_pending.empty()) {
+        children.emplace_back(std::move(_pending.front()));
+        _pending.pop_front();
+        if (_pending.empty())
+            fetch();
+    }
+    return children;
+}
+
+void UsdChildrenCursor::fetch()
+{
+    // Stay one child ahead of the returned ones so that atEnd() is exact.
+    Ufe::SceneItemList children;
+    while (children.empty() && _current != _end) {
+        _hierarchy->appendUFEChildren(*_current, _filterInactive, children);
+        ++_current;
+    }
+    _pending.insert(_pending.end(), children.begin(), children.end());
+}
+
 } // namespace USDUFE_NS_DEF
@@ -20,10 +20,14 @@
 #include <usdUfe/ufe/UfeVersionCompat.h>
 #include <usdUfe/ufe/UsdSceneItem.h>
 
+#include <pxr/usd/usd/prim.h>
+
 #include <ufe/hierarchy.h>
 #include <ufe/path.h>
 #include <ufe/selection.h>
 
+#include <deque>
+
 namespace USDUFE_NS_DEF {
 
 //! \brief USD run-time hierarchy interface
@@ -97,14 +101,62 @@ protected:
         bool                   filterInactive) const;
 
 private:
+    friend class UsdChildrenCursor;
+
     Ufe::SceneItemList
     createUFEChildList(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
 
+    //! Append the UFE children of a single USD child to \p children.
+    void appendUFEChildren(
+        const PXR_NS::UsdPrim& child,
+        bool                   filterInactive,
+        Ufe::SceneItemList&    children) const;
+
+    //! Return true if createUFEChildList() would return a non-empty list,
+    //! stopping at the first child found.
+    bool hasUFEChildren(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
+
 private:
     UsdSceneItem::Ptr _item;
 
 }; // UsdHierarchy
 
+//! \brief Cursor walking the children of a USD hierarchy one page at a time.
+/*!
+    Each page resumes where the previous one stopped, so paging through all the
+    children walks the USD children only once. Lets views with many children only
+    create the scene items they display. The pages hold the same children, in the
+    same order, as children() or filteredChildren(). The cursor must be created
+    again when the children change.
+*/
+class USDUFE_PUBLIC UsdChildrenCursor
+{
+public:
+    //! Walk the children() of the hierarchy.
+    UsdChildrenCursor(const UsdHierarchy::Ptr& hierarchy);
+
+    //! Walk the filteredChildren() of the hierarchy for the given filter.
+    UsdChildrenCursor(
+        const UsdHierarchy::Ptr&           hierarchy,
+        const Ufe::Hierarchy::ChildFilter& childFilter);
+
+    //! Return at most \p count of the next children.
+    Ufe::SceneItemList next(size_t count);
+
+    //! Return true once all the children were returned.
+    bool atEnd() const { return _pending.empty(); }
+
+private:
+    //! Walk the USD children until one has UFE children or none is left.
+    void fetch();
+
+    UsdHierarchy::Ptr               _hierarchy;
+    PXR_NS::UsdPrimSiblingIterator  _current;
+    PXR_NS::UsdPrimSiblingIterator  _end;
+    bool                            _filterInactive;
+    std::deque<Ufe::SceneItem::Ptr> _pending;
+};
+
 } // namespace USDUFE_NS_DEF
 
 #endif // USDUFE_USDHIERARCHY_H
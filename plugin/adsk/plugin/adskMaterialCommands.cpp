@@ -26,12 +26,17 @@
 #include <mayaUsd/utils/query.h>
 #include <mayaUsd/utils/util.h>
 
+#if HAS_LOOKDEVXUSD
+#include <lookdevXUsd/UsdMaterialValidationService.h>
+#endif
+
 #include <pxr/usd/sdr/registry.h>
 #include <pxr/usd/usd/stage.h>
 
 #include <maya/MArgParser.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MGlobal.h>
+#include <maya/MIntArray.h>
 #include <maya/MStringArray.h>
 #include <maya/MSyntax.h>
 #include <ufe/hierarchy.h>
@@ -48,6 +53,9 @@ const MString
               ADSKMayaUSDGetMaterialsForRenderersCommand::commandName("mayaUsdGetMaterialsFromRenderers");
 const MString ADSKMayaUSDGetMaterialsInStageCommand::commandName("mayaUsdGetMaterialsInStage");
 const MString ADSKMayaUSDMaterialBindingsCommand::commandName("mayaUsdMaterialBindings");
+#if HAS_LOOKDEVXUSD
+const MString ADSKMayaUSDValidateMaterialsCommand::commandName("mayaUsdValidateMaterials");
+#endif
 
 /*
 // ADSKMayaUSDGetMaterialsForRenderersCommand
@@ -353,4 +361,88 @@ MSyntax ADSKMayaUSDMaterialBindingsCommand::createSyntax()
     return syntax;
 }
 
-} // namespace MAYAUSD_NS_DEF
\ No newline at end of file
+#if HAS_LOOKDEVXUSD
+/*
+// ADSKMayaUSDValidateMaterialsCommand
+*/
+
+// plug-in callback to create the command object
+void* ADSKMayaUSDValidateMaterialsCommand::creator()
+{
+    return static_cast<MPxCommand*>(new ADSKMayaUSDValidateMaterialsCommand());
+}
+
+// main MPxCommand execution point
+MStatus ADSKMayaUSDValidateMaterialsCommand::doIt(const MArgList& argList)
+{
+    clearResult();
+
+    MStatus      status;
+    MArgDatabase args(syntax(), argList, &status);
+    if (!status)
+        return status;
+
+    MString ufePathString = args.commandArgumentString(0);
+    if (ufePathString.length() == 0) {
+        MGlobal::displayError("Missing argument 'UFE Path'.");
+        return MS::kFailure;
+    }
+
+    const auto  ufePath = Ufe::PathString::path(ufePathString.asChar());
+    UsdStagePtr stage = ufe::getStage(ufePath);
+    if (!stage) {
+        MGlobal::displayError("Could not find the USD stage of: " + ufePathString);
+        return MS::kFailure;
+    }
+
+    auto service = LookdevXUsd::UsdMaterialValidationService::instance(stage);
+
+    if (args.isFlagSet(kClearCacheFlag)) {
+        service->clear();
+        return MS::kSuccess;
+    }
+
+    if (args.isFlagSet(kStatisticsFlag)) {
+        MIntArray statistics;
+        statistics.append(static_cast<int>(service->validationCount()));
+        statistics.append(static_cast<int>(service->cacheHitCount()));
+        statistics.append(static_cast<int>(service->cacheSize()));
+        setResult(statistics);
+        return MS::kSuccess;
+    }
+
+    LookdevXUsd::UsdMaterialValidationService::Results results;
+    if (args.isFlagSet(kMaterialFlag)) {
+        SdfPathVector materialPaths;
+        for (unsigned int i = 0, n = args.numberOfFlagUses(kMaterialFlag); i < n; ++i) {
+            MArgList flagArgs;
+            args.getFlagArgumentList(kMaterialFlag, i, flagArgs);
+            materialPaths.emplace_back(flagArgs.asString(0).asChar());
+        }
+        results = service->validate(materialPaths);
+    } else {
+        results = service->validateAll();
+    }
+
+    for (const auto& result : results) {
+        appendToResult(MString(result.first.GetText()));
+    }
+
+    return MS::kSuccess;
+}
+
+MSyntax ADSKMayaUSDValidateMaterialsCommand::createSyntax()
+{
+    MSyntax syntax;
+    syntax.addArg(MSyntax::kString);
+    syntax.addFlag(kMaterialFlag, kMaterialFlagLong, MSyntax::kString);
+    syntax.makeFlagMultiUse(kMaterialFlag);
+    syntax.addFlag(kStatisticsFlag, kStatisticsFlagLong);
+    syntax.addFlag(kClearCacheFlag, kClearCacheFlagLong);
+    syntax.enableQuery(false);
+    syntax.enableEdit(false);
+    return syntax;
+}
+#endif
+
+} // namespace MAYAUSD_NS_DEF
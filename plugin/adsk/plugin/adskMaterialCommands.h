@@ -94,6 +94,30 @@ private:
     MStatus parseArgs(const MArgList& argList);
 };
 
+#if HAS_LOOKDEVXUSD
+//! \brief Validates the materials of the USD stage of the object passed in via argument, through
+//! the cached validation service of the stage. Validates all the materials of the stage unless
+//! some are given with the material flag, and returns the paths of the validated materials.
+class MAYAUSD_PLUGIN_PUBLIC ADSKMayaUSDValidateMaterialsCommand : public MPxCommand
+{
+public:
+    static constexpr auto kMaterialFlag = "m";
+    static constexpr auto kMaterialFlagLong = "material";
+    static constexpr auto kStatisticsFlag = "st";
+    static constexpr auto kStatisticsFlagLong = "statistics";
+    static constexpr auto kClearCacheFlag = "cc";
+    static constexpr auto kClearCacheFlagLong = "clearCache";
+
+    // plugin registration requirements
+    static const MString commandName;
+    static void*         creator();
+    static MSyntax       createSyntax();
+
+    MStatus doIt(const MArgList& argList) override;
+    bool    isUndoable() const override { return false; }
+};
+#endif
+
 } // namespace MAYAUSD_NS_DEF
 
 #endif /* ADSK_MAYA_MATERIAL_COMMANDS_H */
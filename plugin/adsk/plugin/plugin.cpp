@@ -218,6 +218,9 @@ MStatus initializePlugin(MObject obj)
     registerCommandCheck<MayaUsd::ADSKMayaUSDGetMaterialsInStageCommand>(plugin);
     registerCommandCheck<MayaUsd::ADSKMayaUSDMaterialBindingsCommand>(plugin);
 #endif
+#if HAS_LOOKDEVXUSD
+    registerCommandCheck<MayaUsd::ADSKMayaUSDValidateMaterialsCommand>(plugin);
+#endif
 
     status = plugin.registerCommand(
         MayaUsd::MayaUsdUndoBlockCmd::commandName, MayaUsd::MayaUsdUndoBlockCmd::creator);
@@ -584,6 +587,9 @@ MStatus uninitializePlugin(MObject obj)
     deregisterCommandCheck<MayaUsd::ADSKMayaUSDGetMaterialsInStageCommand>(plugin);
     deregisterCommandCheck<MayaUsd::ADSKMayaUSDMaterialBindingsCommand>(plugin);
 #endif
+#if HAS_LOOKDEVXUSD
+    deregisterCommandCheck<MayaUsd::ADSKMayaUSDValidateMaterialsCommand>(plugin);
+#endif
 
     status = plugin.deregisterNode(MayaUsd::ProxyShapeListener::typeId);
     CHECK_MSTATUS(status);
@@ -20,14 +20,145 @@
 #include "AL/usdmaya/fileio/translators/TransformTranslator.h"
 #include "AL/usdmaya/utils/MeshUtils.h"
 
+#include <mayaUsd/fileio/utils/animCurveSampler.h>
+#include <mayaUsd/fileio/utils/frameSampler.h>
+
+#include <pxr/base/gf/traits.h>
+#include <pxr/base/gf/vec2d.h>
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/usd/sdf/types.h>
+
 #include <maya/MAnimControl.h>
 #include <maya/MAnimUtil.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MFnMatrixData.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MMatrix.h>
 #include <maya/MNodeClass.h>
 
+#include <type_traits>
+
+namespace {
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, T>::type
+makeSample(const double* values, double scale)
+{
+    return static_cast<T>(values[0] * scale);
+}
+
+template <typename T>
+typename std::enable_if<GfIsGfVec<T>::value, T>::type
+makeSample(const double* values, double scale)
+{
+    T sample;
+    for (size_t i = 0; i < T::dimension; ++i) {
+        sample[i] = static_cast<typename T::ScalarType>(values[i] * scale);
+    }
+    return sample;
+}
+
+template <typename T>
+void setSamples(
+    UsdAttribute&              attr,
+    const std::vector<double>& frames,
+    const std::vector<double>& values,
+    double                     scale)
+{
+    const size_t dimension = values.size() / frames.size();
+    for (size_t f = 0; f < frames.size(); ++f) {
+        attr.Set(makeSample<T>(values.data() + f * dimension, scale), UsdTimeCode(frames[f]));
+    }
+}
+
+// With mergeOffsetParentMatrix, the transform values of a node with an offset
+// parent matrix are decomposed from its composed local matrix, which needs the
+// scene to be evaluated at each frame.
+bool hasOffsetParentMatrix(const MPlug& plug)
+{
+    MStatus     status;
+    const MPlug offsetPlug
+        = MFnDependencyNode(plug.node()).findPlug("offsetParentMatrix", true, &status);
+    if (!status) {
+        return false;
+    }
+    if (offsetPlug.isDestination()) {
+        return true;
+    }
+    MFnMatrixData matrixData(offsetPlug.asMObject());
+    return !matrixData.matrix().isEquivalent(MMatrix::identity);
+}
+
+// Writes all the samples of a plug driven only by animation curves at once,
+// without changing the current time. Returns false if the plug or the type
+// of the attribute is not supported, in which case the plug has to be sampled
+// by changing the current time.
+bool exportAnimCurveSamples(
+    const AL::usdmaya::fileio::ExporterParams& params,
+    const MPlug&                               plug,
+    UsdAttribute&                              attr,
+    double                                     scale,
+    const std::vector<double>&                 frames)
+{
+    const SdfValueTypeName typeName = attr.GetTypeName();
+    size_t                 dimension = 0;
+    if (typeName == SdfValueTypeNames->Float || typeName == SdfValueTypeNames->Double) {
+        dimension = 1;
+    } else if (typeName == SdfValueTypeNames->Float2 || typeName == SdfValueTypeNames->Double2) {
+        dimension = 2;
+    } else if (typeName == SdfValueTypeNames->Float3 || typeName == SdfValueTypeNames->Double3) {
+        dimension = 3;
+    } else {
+        return false;
+    }
+
+    // Other compounds are not written as vectors.
+    switch (plug.attribute().apiType()) {
+    case MFn::kAttribute2Double:
+    case MFn::kAttribute2Float:
+    case MFn::kAttribute3Double:
+    case MFn::kAttribute3Float: break;
+    default:
+        if (plug.isCompound()) {
+            return false;
+        }
+        break;
+    }
+
+    const size_t numChannels = plug.isCompound() ? plug.numChildren() : 1;
+    if (numChannels != dimension || frames.empty()) {
+        return false;
+    }
+    if (params.m_mergeOffsetParentMatrix && hasOffsetParentMatrix(plug)) {
+        return false;
+    }
+
+    std::vector<double> values;
+    if (!UsdMayaAnimCurveSampler::Sample(plug, frames, &values)) {
+        return false;
+    }
+
+    if (typeName == SdfValueTypeNames->Float) {
+        setSamples<float>(attr, frames, values, scale);
+    } else if (typeName == SdfValueTypeNames->Double) {
+        setSamples<double>(attr, frames, values, scale);
+    } else if (typeName == SdfValueTypeNames->Float2) {
+        setSamples<GfVec2f>(attr, frames, values, scale);
+    } else if (typeName == SdfValueTypeNames->Double2) {
+        setSamples<GfVec2d>(attr, frames, values, scale);
+    } else if (typeName == SdfValueTypeNames->Float3) {
+        setSamples<GfVec3f>(attr, frames, values, scale);
+    } else {
+        setSamples<GfVec3d>(attr, frames, values, scale);
+    }
+    return true;
+}
+
+} // namespace
+
 namespace AL {
 namespace usdmaya {
 namespace fileio {
@@ -35,10 +166,28 @@ namespace fileio {
 //----------------------------------------------------------------------------------------------------------------------
 void AnimationTranslator::exportAnimation(const ExporterParams& params)
 {
-    auto const startAttrib = m_animatedPlugs.begin();
-    auto const endAttrib = m_animatedPlugs.end();
-    auto const startAttribScaled = m_scaledAnimatedPlugs.begin();
-    auto const endAttribScaled = m_scaledAnimatedPlugs.end();
+    const std::vector<double> frames = UsdMayaFrameSampler::GetSubframeTimeSamples(
+        params.m_minFrame, params.m_maxFrame, params.m_subSamples);
+
+    // Plugs driven only by animation curves are sampled over the whole frame
+    // range at once, the others need the scene to be evaluated at each frame.
+    PlugAttrVector       steppedPlugs;
+    PlugAttrScaledVector steppedScaledPlugs;
+    for (auto& it : m_animatedPlugs) {
+        if (!exportAnimCurveSamples(params, it.first, it.second, 1.0, frames)) {
+            steppedPlugs.emplace(it.first, it.second);
+        }
+    }
+    for (auto& it : m_scaledAnimatedPlugs) {
+        if (!exportAnimCurveSamples(params, it.first, it.second.attr, it.second.scale, frames)) {
+            steppedScaledPlugs.emplace(it.first, it.second);
+        }
+    }
+
+    auto const startAttrib = steppedPlugs.begin();
+    auto const endAttrib = steppedPlugs.end();
+    auto const startAttribScaled = steppedScaledPlugs.begin();
+    auto const endAttribScaled = steppedScaledPlugs.end();
     auto const startTransformAttrib = m_animatedTransformPlugs.begin();
     auto const endTransformAttrib = m_animatedTransformPlugs.end();
     auto const startMultiAttrib = m_animatedMultiPlugs.begin();
@@ -51,8 +200,7 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
     if ((startAttrib != endAttrib) || (startAttribScaled != endAttribScaled)
         || (startTransformAttrib != endTransformAttrib) || (startMultiAttrib != endMultiAttrib)
         || (startMesh != endMesh) || (startWSM != endWSM) || (!m_animatedNodes.empty())) {
-        double increment = 1.0 / std::max(1U, params.m_subSamples);
-        for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment) {
+        for (double t : frames) {
             MAnimControl::setCurrentTime(t);
             UsdTimeCode timeCode(t);
             for (auto it = startAttrib; it != endAttrib; ++it) {
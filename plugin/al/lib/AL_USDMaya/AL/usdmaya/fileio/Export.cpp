@@ -26,6 +26,8 @@
 #include "AL/usdmaya/utils/MeshUtils.h"
 #include "AL/usdmaya/utils/Utils.h"
 
+#include <mayaUsd/utils/timeSampleCompactor.h>
+
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/nurbsCurves.h>
@@ -35,11 +37,14 @@
 #include <maya/MArgDatabase.h>
 #include <maya/MFnMesh.h>
 #include <maya/MFnTransform.h>
+#include <maya/MGlobal.h>
 #include <maya/MItDag.h>
 #include <maya/MNodeClass.h>
 #include <maya/MPlugArray.h>
 #include <maya/MSyntax.h>
 
+#include <sstream>
+
 namespace AL {
 namespace usdmaya {
 namespace fileio {
@@ -253,11 +258,32 @@ struct Export::Impl
         }
     }
 
-    void
-    doExport(const char* const filename, bool toFilter = false, SdfPath defaultPrim = SdfPath())
+    void compactTimeSamples()
+    {
+        // Drop the samples held by their neighbours, and the time samples of the attributes
+        // which never change.
+        MayaUsd::TimeSampleCompactorOptions options;
+        options.collapseConstant = true;
+        const MayaUsd::TimeSampleCompactorStats stats
+            = MayaUsd::compactTimeSamples(m_stage->GetRootLayer(), options);
+
+        std::stringstream strstr;
+        strstr << "Compacted " << stats.removedSamples << " time samples of " << stats.attributes
+               << " attributes, " << stats.collapsedAttributes << " of them constant, saving about "
+               << stats.bytesSaved << " bytes";
+        MGlobal::displayInfo(AL::maya::utils::convert(strstr.str()));
+    }
+
+    void doExport(
+        const char* const filename,
+        bool              toFilter = false,
+        SdfPath           defaultPrim = SdfPath(),
+        bool              toCompact = false)
     {
         setDefaultPrimIfOnlyOneRoot(defaultPrim);
-        if (toFilter) {
+        if (toCompact) {
+            compactTimeSamples();
+        } else if (toFilter) {
             filterSample();
         }
         m_stage->GetRootLayer()->Save();
@@ -1024,7 +1050,11 @@ void Export::doExport()
     }
 
     m_impl->processInstances();
-    m_impl->doExport(m_params.m_fileName.asChar(), m_params.m_filterSample, defaultPrim);
+    m_impl->doExport(
+        m_params.m_fileName.asChar(),
+        m_params.m_filterSample,
+        defaultPrim,
+        m_params.m_compactTimeSamples);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1138,6 +1168,11 @@ MStatus ExportCommand::doIt(const MArgList& args)
             argData.getFlagArgument("fs", 0, m_params.m_filterSample),
             "ALUSDExport: Unable to fetch \"filter sample\" argument");
     }
+    if (argData.isFlagSet("cts", &status)) {
+        AL_MAYA_CHECK_ERROR(
+            argData.getFlagArgument("cts", 0, m_params.m_compactTimeSamples),
+            "ALUSDExport: Unable to fetch \"compact time samples\" argument");
+    }
     if (argData.isFlagSet("eac", &status)) {
         AL_MAYA_CHECK_ERROR(
             argData.getFlagArgument("eac", 0, m_params.m_extensiveAnimationCheck),
@@ -1273,6 +1308,8 @@ MSyntax ExportCommand::createSyntax()
     AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-fs", "-filterSample", MSyntax::kBoolean);
     AL_MAYA_CHECK_ERROR2(status, errorString);
+    status = syntax.addFlag("-cts", "-compactTimeSamples", MSyntax::kBoolean);
+    AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-eac", "-extensiveAnimationCheck", MSyntax::kBoolean);
     AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-ss", "-subSamples", MSyntax::kUnsigned);
@@ -1318,6 +1355,10 @@ ExportCommand Overview:
 
   The exporter can remove samples that contain the same data for adjacent samples
     1. AL_usdmaya_ExportCommand -f "<path/to/out/file.usd>" -fs
+
+  It can also remove the samples that the other samples reproduce, and replace the samples of the
+  attributes that never change by a default value, working on the exported layer directly
+    1. AL_usdmaya_ExportCommand -f "<path/to/out/file.usd>" -cts true
 )";
 
 //----------------------------------------------------------------------------------------------------------------------
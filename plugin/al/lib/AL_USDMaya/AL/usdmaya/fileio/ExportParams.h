@@ -60,6 +60,9 @@ struct ExporterParams
     bool m_animation = false;        ///< if true, animation will be exported.
     bool m_useTimelineRange = false; ///< if true, then the export uses Maya's timeline range.
     bool m_filterSample = false; ///< if true, duplicate sample of attribute will be filtered out
+    bool m_compactTimeSamples
+        = false; ///< if true, the time samples that the other samples reproduce are removed, and
+                 ///< the attributes which never change get a default value instead
     bool m_exportInWorldSpace = false; ///< if true, transform will be baked at the root prim,
                                        ///< children under the root will be untouched.
     AnimationTranslator* m_animTranslator
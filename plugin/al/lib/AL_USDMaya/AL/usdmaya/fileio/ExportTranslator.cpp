@@ -89,6 +89,7 @@ MStatus ExportTranslator::writer(
         params.m_animTranslator = new AnimationTranslator;
     }
     params.m_filterSample = options.getBool(kFilterSample);
+    params.m_compactTimeSamples = options.getBool(kCompactTimeSamples);
     if (params.m_selected) {
         MGlobal::getActiveSelectionList(params.m_nodes);
     } else {
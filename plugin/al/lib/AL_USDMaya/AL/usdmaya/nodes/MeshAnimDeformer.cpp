@@ -22,6 +22,7 @@
 #include "AL/usdmaya/utils/Utils.h"
 
 #include <mayaUsd/nodes/stageData.h>
+#include <mayaUsd/utils/attributeReadAheadCache.h>
 
 #include <pxr/usd/usdGeom/mesh.h>
 
@@ -96,13 +97,16 @@ MStatus MeshAnimDeformer::compute(const MPlug& plug, MDataBlock& data)
         UsdPrim     prim = stage->GetPrimAtPath(m_cachePath);
         UsdGeomMesh mesh(prim);
 
+        // The animated points and normals are read ahead of the playback.
+        UsdMayaAttributeReadAheadCache& cache = UsdMayaAttributeReadAheadCache::GetInstance();
+
         MFnMesh      fnMesh(obj);
         float* const ptr = (float*)fnMesh.getRawPoints(&status);
         if (ptr) {
             UsdAttribute points = mesh.GetPointsAttr();
             if (points.GetNumTimeSamples() > 1) {
                 VtArray<GfVec3f> pointData;
-                points.Get(&pointData, usdTime);
+                cache.Get(points, usdTime, &pointData);
                 const size_t numPoints = pointData.size();
                 std::memcpy(ptr, pointData.cdata(), sizeof(float) * 3 * numPoints);
             }
@@ -113,7 +117,7 @@ MStatus MeshAnimDeformer::compute(const MPlug& plug, MDataBlock& data)
             UsdAttribute normals = mesh.GetNormalsAttr();
             if (normals.GetNumTimeSamples() > 1) {
                 VtArray<GfVec3f> normalData;
-                normals.Get(&normalData, usdTime);
+                cache.Get(normals, usdTime, &normalData);
                 const size_t numNormals = normalData.size();
                 std::memcpy(nptr, normalData.cdata(), sizeof(float) * 3 * numNormals);
             }
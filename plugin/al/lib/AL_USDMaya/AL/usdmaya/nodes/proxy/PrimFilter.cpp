@@ -19,6 +19,11 @@
 #include "AL/usdmaya/nodes/ProxyShape.h"
 
 #include <maya/MProfiler.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace {
 const int _primFilterProfilerCategory = MProfiler::addCategory("PrimFIlter", "PrimFIlter");
 } // namespace
@@ -34,7 +39,7 @@ PrimFilter::PrimFilter(
     const std::vector<UsdPrim>& newPrimSet,
     PrimFilterInterface*        proxy,
     bool                        forceImport)
-    : m_newPrimSet(newPrimSet)
+    : m_newPrimSet()
     , m_transformsToCreate()
     , m_updatablePrimSet()
     , m_removedPrimSet()
@@ -49,11 +54,13 @@ PrimFilter::PrimFilter(
             return b < a;
         });
 
-    for (auto it = m_newPrimSet.begin(); it != m_newPrimSet.end();) {
-        UsdPrim prim = *it;
-        auto    lastIt = it;
-        ++it;
+    // The previous prims that are kept are only flagged here, then compacted at the end, rather
+    // than erased one by one from the middle of the vector. Likewise, the prims to create are
+    // appended to m_newPrimSet instead of being erased from a copy of newPrimSet.
+    std::vector<bool> keptPrims(m_removedPrimSet.size(), false);
+    m_newPrimSet.reserve(newPrimSet.size());
 
+    for (const UsdPrim& prim : newPrimSet) {
         SdfPath path = prim.GetPath();
 
         // check previous prim type (if it exists at all?)
@@ -63,7 +70,6 @@ PrimFilter::PrimFilter(
 
         // inactive prims should be removed
         if (!prim.IsActive()) {
-            it = m_newPrimSet.erase(lastIt);
             continue;
         }
 
@@ -74,18 +80,24 @@ PrimFilter::PrimFilter(
             newTranslatorId, supportsUpdate, requiresParent, importableByDefault);
 
         if (importableByDefault || forceImport) {
+            bool isNewPrim = true;
+
             // if the type remains the same, and the type supports update
             if (existingTranslatorId == newTranslatorId) {
-                // locate the path and delete from the removed set (we do not want to delete this
-                // prim! Note that m_removedPrimSet is reverse sorted
+                // locate the path and flag it as kept (we do not want to delete this prim!)
+                // Note that m_removedPrimSet is reverse sorted
                 auto iter = std::lower_bound(
                     m_removedPrimSet.begin(),
                     m_removedPrimSet.end(),
                     path,
                     [](const SdfPath& a, const SdfPath& b) { return b < a; });
-                if (iter != removedPrimSet().end() && *iter == path) {
+                while (iter != m_removedPrimSet.end() && *iter == path
+                       && keptPrims[iter - m_removedPrimSet.begin()]) {
+                    ++iter;
+                }
+                if (iter != m_removedPrimSet.end() && *iter == path) {
                     if (supportsUpdate) {
-                        m_removedPrimSet.erase(iter);
+                        keptPrims[iter - m_removedPrimSet.begin()] = true;
                         if (proxy->isPrimDirty(prim)) {
                             TF_DEBUG(ALUSDMAYA_TRANSLATORS)
                                 .Msg(
@@ -100,7 +112,7 @@ PrimFilter::PrimFilter(
                         }
                         // supporting update means it's not a new prim,
                         // otherwise we still want the prim to be re-created.
-                        it = m_newPrimSet.erase(lastIt);
+                        isNewPrim = false;
 
                         // skip creating transforms in this case.
                         requiresParent = false;
@@ -119,22 +131,35 @@ PrimFilter::PrimFilter(
                                     "PrimFilter::PrimFilter %s prim remains unchanged.\n",
                                     path.GetText());
 
-                            m_removedPrimSet.erase(iter);
-                            it = m_newPrimSet.erase(lastIt);
+                            keptPrims[iter - m_removedPrimSet.begin()] = true;
+                            isNewPrim = false;
                             // skip creating transforms in this case.
                             requiresParent = false;
                         }
                     }
                 }
             }
+            if (isNewPrim) {
+                m_newPrimSet.push_back(prim);
+            }
             // if we need a transform, make a note of it now
             if (requiresParent) {
                 m_transformsToCreate.push_back(prim);
             }
-        } else {
-            it = m_newPrimSet.erase(lastIt);
         }
     }
+
+    // remove the kept prims from the removed set, preserving its order
+    size_t removedCount = 0;
+    for (size_t i = 0, n = m_removedPrimSet.size(); i < n; ++i) {
+        if (!keptPrims[i]) {
+            if (removedCount != i) {
+                m_removedPrimSet[removedCount] = std::move(m_removedPrimSet[i]);
+            }
+            ++removedCount;
+        }
+    }
+    m_removedPrimSet.resize(removedCount);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
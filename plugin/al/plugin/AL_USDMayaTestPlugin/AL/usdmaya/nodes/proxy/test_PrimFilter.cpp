@@ -21,8 +21,11 @@
 #include "AL/usdmaya/nodes/proxy/PrimFilter.h"
 #include "test_usdmaya.h"
 
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/sdf/types.h>
 #include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
@@ -35,7 +38,10 @@
 #include <maya/MSelectionList.h>
 #include <maya/MStringArray.h>
 
+#include <algorithm>
 #include <fstream>
+#include <map>
+#include <random>
 #include <set>
 
 using AL::maya::test::buildTempPath;
@@ -315,3 +321,249 @@ TEST(PrimFilter, removedPaths)
         EXPECT_TRUE(filter.transformsToCreate().empty());
     }
 }
+
+/// Translators known to the randomized test: cameras cannot be updated, scopes are not imported.
+struct RandomPrimFilterInterface : public AL::usdmaya::nodes::proxy::PrimFilterInterface
+{
+    std::map<SdfPath, std::string> translatedPaths;
+    std::set<SdfPath>              cleanPaths;
+
+    std::string getTranslatorIdForPath(const SdfPath& path) override
+    {
+        auto it = translatedPaths.find(path);
+        return it != translatedPaths.end() ? it->second : std::string();
+    }
+
+    bool getTranslatorInfo(
+        const std::string& translatorId,
+        bool&              supportsUpdate,
+        bool&              requiresParent,
+        bool&              importableByDefault) override
+    {
+        supportsUpdate = translatorId != "schematype:Camera";
+        requiresParent = translatorId != "schematype:Scope";
+        importableByDefault
+            = translatorId == "schematype:Xform" || translatorId == "schematype:Camera";
+        return !translatorId.empty();
+    }
+
+    std::string generateTranslatorId(UsdPrim prim) override
+    {
+        const std::string typeName = prim.GetTypeName().GetString();
+        return typeName.empty() ? std::string() : std::string("schematype:") + typeName;
+    }
+
+    bool isPrimDirty(const UsdPrim& prim) override { return !cleanPaths.count(prim.GetPath()); }
+};
+
+static SdfPathVector primPaths(const std::vector<UsdPrim>& prims)
+{
+    SdfPathVector paths;
+    for (const UsdPrim& prim : prims) {
+        paths.push_back(prim.GetPath());
+    }
+    return paths;
+}
+
+/// The prim filter as it was when it still erased the classified prims from the middle of its
+/// vectors, which is slow but straightforward. matchesReferenceFilter uses its results as the
+/// expected outputs of the current filter on random hierarchies.
+struct ReferencePrimFilter
+{
+    std::vector<UsdPrim> newPrimSet;
+    std::vector<UsdPrim> transformsToCreate;
+    std::vector<UsdPrim> updatablePrimSet;
+    SdfPathVector        removedPrimSet;
+
+    ReferencePrimFilter(
+        const SdfPathVector&                            previousPrims,
+        const std::vector<UsdPrim>&                     newPrims,
+        AL::usdmaya::nodes::proxy::PrimFilterInterface* proxy,
+        bool                                            forceImport)
+        : newPrimSet(newPrims)
+        , removedPrimSet(previousPrims)
+    {
+        auto reversed = [](const SdfPath& a, const SdfPath& b) { return b < a; };
+        std::sort(removedPrimSet.begin(), removedPrimSet.end(), reversed);
+
+        for (auto it = newPrimSet.begin(); it != newPrimSet.end();) {
+            UsdPrim prim = *it;
+            auto    lastIt = it;
+            ++it;
+
+            const SdfPath     path = prim.GetPath();
+            const std::string existingTranslatorId = proxy->getTranslatorIdForPath(path);
+            const std::string newTranslatorId = proxy->generateTranslatorId(prim);
+            if (!prim.IsActive()) {
+                it = newPrimSet.erase(lastIt);
+                continue;
+            }
+
+            bool supportsUpdate = false;
+            bool requiresParent = false;
+            bool importableByDefault = false;
+            proxy->getTranslatorInfo(
+                newTranslatorId, supportsUpdate, requiresParent, importableByDefault);
+            if (!importableByDefault && !forceImport) {
+                it = newPrimSet.erase(lastIt);
+                continue;
+            }
+
+            if (existingTranslatorId == newTranslatorId) {
+                auto iter = std::lower_bound(
+                    removedPrimSet.begin(), removedPrimSet.end(), path, reversed);
+                if (iter != removedPrimSet.end() && *iter == path) {
+                    if (supportsUpdate) {
+                        removedPrimSet.erase(iter);
+                        if (proxy->isPrimDirty(prim)) {
+                            updatablePrimSet.push_back(prim);
+                        }
+                        it = newPrimSet.erase(lastIt);
+                        requiresParent = false;
+                    } else if (!proxy->isPrimDirty(prim)) {
+                        removedPrimSet.erase(iter);
+                        it = newPrimSet.erase(lastIt);
+                        requiresParent = false;
+                    }
+                }
+            }
+            if (requiresParent) {
+                transformsToCreate.push_back(prim);
+            }
+        }
+    }
+};
+
+/// PrimFilter(const SdfPathVector& previousPrims, const std::vector<UsdPrim>& newPrimSet,
+///   PrimFilterInterface* proxy, bool forceImport);
+TEST(PrimFilter, matchesReferenceFilter)
+{
+    const std::string types[] = { "Xform", "Camera", "Scope", "" };
+
+    std::mt19937 generator(1234);
+    auto         randomType = [&generator, &types]() { return types[generator() % 4]; };
+    auto         chance = [&generator](unsigned percent) { return generator() % 100 < percent; };
+
+    // build a random hierarchy
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous(".usda");
+    SdfPathVector  specPaths;
+    for (int i = 0; i < 4; ++i) {
+        auto spec = SdfPrimSpec::New(layer, TfStringPrintf("root%d", i), SdfSpecifierDef, types[0]);
+        specPaths.push_back(spec->GetPath());
+    }
+    for (int i = 0; i < 400; ++i) {
+        const SdfPath parentPath = specPaths[generator() % specPaths.size()];
+        auto          spec = SdfPrimSpec::New(
+            layer->GetPrimAtPath(parentPath),
+            TfStringPrintf("prim%d", i),
+            SdfSpecifierDef,
+            randomType());
+        specPaths.push_back(spec->GetPath());
+    }
+    UsdStageRefPtr stage = UsdStage::Open(layer);
+
+    // the prims found under the resynced paths, the way the proxy shape would hunt for them
+    auto huntPrims = [&stage](SdfPathVector roots) {
+        SdfPath::RemoveDescendentPaths(&roots);
+        std::vector<UsdPrim> prims;
+        for (const SdfPath& root : roots) {
+            UsdPrim rootPrim = stage->GetPrimAtPath(root);
+            if (!rootPrim) {
+                continue;
+            }
+            for (const UsdPrim& prim : UsdPrimRange(rootPrim, UsdPrimAllPrimsPredicate)) {
+                if (!prim.IsPseudoRoot()) {
+                    prims.push_back(prim);
+                }
+            }
+        }
+        return prims;
+    };
+
+    RandomPrimFilterInterface mockInterface;
+
+    // translate the whole stage first
+    {
+        const SdfPathVector                   resynced = { SdfPath::AbsoluteRootPath() };
+        AL::usdmaya::nodes::proxy::PrimFilter filter(
+            SdfPathVector(), huntPrims(resynced), &mockInterface, false);
+        EXPECT_FALSE(filter.newPrimSet().empty());
+        EXPECT_TRUE(filter.removedPrimSet().empty());
+        for (const UsdPrim& prim : filter.newPrimSet()) {
+            mockInterface.translatedPaths[prim.GetPath()]
+                = mockInterface.generateTranslatorId(prim);
+        }
+    }
+
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        SCOPED_TRACE(iteration);
+
+        // randomly edit a few prims, recording the paths that the stage would report as resynced
+        SdfPathVector resynced;
+        const int     editCount = 1 + generator() % 3;
+        for (int edit = 0; edit < editCount; ++edit) {
+            const SdfPath     path = specPaths[generator() % specPaths.size()];
+            SdfPrimSpecHandle spec = layer->GetPrimAtPath(path);
+            if (!spec) {
+                continue;
+            }
+            switch (generator() % 4) {
+            case 0: spec->SetTypeName(randomType()); break;
+            case 1: spec->SetActive(!spec->GetActive()); break;
+            case 2: {
+                auto child = SdfPrimSpec::New(
+                    spec,
+                    TfStringPrintf("added%d_%d", iteration, edit),
+                    SdfSpecifierDef,
+                    randomType());
+                specPaths.push_back(child->GetPath());
+                break;
+            }
+            default:
+                if (spec->GetNameParent()) {
+                    spec->GetNameParent()->RemoveNameChild(spec);
+                }
+                break;
+            }
+            resynced.push_back(path);
+        }
+
+        mockInterface.cleanPaths.clear();
+        for (const SdfPath& path : specPaths) {
+            if (chance(30)) {
+                mockInterface.cleanPaths.insert(path);
+            }
+        }
+
+        // the previous prims are the translated prims under the resynced paths
+        SdfPathVector previous;
+        for (const auto& translated : mockInterface.translatedPaths) {
+            for (const SdfPath& path : resynced) {
+                if (translated.first.HasPrefix(path)) {
+                    previous.push_back(translated.first);
+                    break;
+                }
+            }
+        }
+
+        const bool                 forceImport = chance(20);
+        const std::vector<UsdPrim> newPrims = huntPrims(resynced);
+        AL::usdmaya::nodes::proxy::PrimFilter filter(
+            previous, newPrims, &mockInterface, forceImport);
+        ReferencePrimFilter reference(previous, newPrims, &mockInterface, forceImport);
+
+        EXPECT_EQ(primPaths(reference.newPrimSet), primPaths(filter.newPrimSet()));
+        EXPECT_EQ(primPaths(reference.transformsToCreate), primPaths(filter.transformsToCreate()));
+        EXPECT_EQ(primPaths(reference.updatablePrimSet), primPaths(filter.updatablePrimSet()));
+        EXPECT_EQ(reference.removedPrimSet, filter.removedPrimSet());
+
+        // apply the result, the way the proxy shape would
+        for (const SdfPath& path : filter.removedPrimSet()) {
+            mockInterface.translatedPaths.erase(path);
+        }
+        for (const UsdPrim& prim : filter.newPrimSet()) {
+            mockInterface.translatedPaths[prim.GetPath()]
+                = mockInterface.generateTranslatorId(prim);
+        }
+    }
+}
@@ -14,8 +14,14 @@
 // limitations under the License.
 //
 #include "AL/usdmaya/fileio/AnimationTranslator.h"
+#include "AL/usdmaya/fileio/ExportParams.h"
 #include "test_usdmaya.h"
 
+#include <mayaUsd/fileio/utils/animCurveSampler.h>
+
+#include <pxr/usd/usd/stage.h>
+
+#include <maya/MAnimControl.h>
 #include <maya/MDGModifier.h>
 #include <maya/MDoubleArray.h>
 #include <maya/MFileIO.h>
@@ -28,6 +34,7 @@
 #include <maya/MSelectionList.h>
 
 using AL::usdmaya::fileio::AnimationTranslator;
+using AL::usdmaya::fileio::ExporterParams;
 
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  Test USD to attribute enum mappings
@@ -476,3 +483,55 @@ TEST(translators_AnimationTranslator, isAnimatedTransform)
     mod.deleteNode(root);
     mod.doIt();
 }
+
+TEST(translators_AnimationTranslator, animCurveSampledExport)
+{
+    MFileIO::newFile(true);
+    setUp();
+    MStatus status;
+
+    MFnDagNode transformFN;
+    MObject    transform = transformFN.create("transform", MObject::kNullObj, &status);
+    EXPECT_EQ(MStatus(MS::kSuccess), status);
+
+    MFnAnimCurve fna;
+    MObject      animCurve
+        = fna.create(transformFN.findPlug("translateY"), MFnAnimCurve::kAnimCurveTL, 0, &status);
+    EXPECT_EQ(MStatus(MS::kSuccess), status);
+    fna.addKey(MTime(1.0), 0.0);
+    fna.addKey(MTime(10.0), 9.0);
+
+    MPlug translate = transformFN.findPlug("translate");
+    EXPECT_TRUE(UsdMayaAnimCurveSampler::CanSample(translate));
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdAttribute   attr = stage->DefinePrim(SdfPath("/transform"))
+                            .CreateAttribute(TfToken("translate"), SdfValueTypeNames->Double3);
+
+    AnimationTranslator translator;
+    translator.forceAddPlug(translate, attr);
+
+    ExporterParams params;
+    params.m_minFrame = 1.0;
+    params.m_maxFrame = 10.0;
+    params.m_subSamples = 2;
+
+    // Plugs driven by animation curves are sampled without changing the current time.
+    MAnimControl::setCurrentTime(MTime(5.0));
+    translator.exportAnimation(params);
+    EXPECT_EQ(5.0, MAnimControl::currentTime().value());
+
+    EXPECT_EQ(19u, attr.GetNumTimeSamples());
+    for (double t = 1.0; t <= 10.0; t += 0.5) {
+        MAnimControl::setCurrentTime(MTime(t));
+        GfVec3d value;
+        EXPECT_TRUE(attr.Get(&value, UsdTimeCode(t)));
+        EXPECT_EQ(0.0, value[0]);
+        EXPECT_NEAR(translate.child(1).asDouble(), value[1], 1e-6);
+    }
+
+    MDGModifier mod;
+    mod.deleteNode(animCurve);
+    mod.deleteNode(transform);
+    mod.doIt();
+}
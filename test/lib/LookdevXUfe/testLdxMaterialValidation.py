@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2025 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License")
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http:#www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+from maya import cmds
+from maya import standalone
+
+from pxr import UsdGeom, UsdShade, Sdf
+
+import unittest
+
+class LookdevXUfeMaterialValidationTestCase(unittest.TestCase):
+    '''Verify the cached material validation service of the USD stages.
+    '''
+    pluginsLoaded = False
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = mayaUtils.isMayaUsdPluginLoaded()
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+        self.proxyShape, self.stage = mayaUtils.createProxyAndStage()
+
+        UsdGeom.Xform.Define(self.stage, '/geo')
+        UsdGeom.Scope.Define(self.stage, '/mtl')
+        self.shaders = {}
+        for name in ['A', 'B', 'C']:
+            self.shaders[name] = self.createMaterial('/mtl/' + name)
+
+    def createMaterial(self, materialPath):
+        material = UsdShade.Material.Define(self.stage, materialPath)
+        shader = UsdShade.Shader.Define(self.stage, materialPath + '/surface')
+        shader.CreateIdAttr('UsdPreviewSurface')
+        shader.CreateInput('roughness', Sdf.ValueTypeNames.Float).Set(0.5)
+        shader.CreateOutput('surface', Sdf.ValueTypeNames.Token)
+        material.CreateSurfaceOutput().ConnectToSource(shader.ConnectableAPI(), 'surface')
+        return shader
+
+    def validate(self, materials=None):
+        if materials is None:
+            return cmds.mayaUsdValidateMaterials(self.proxyShape) or []
+        return cmds.mayaUsdValidateMaterials(self.proxyShape, material=materials) or []
+
+    def statistics(self):
+        '''Return the validation count, the cache hit count and the cache size.'''
+        return list(cmds.mayaUsdValidateMaterials(self.proxyShape, statistics=True))
+
+    def testValidateMaterial(self):
+        self.assertEqual(self.validate(['/mtl/A']), ['/mtl/A'])
+        self.assertEqual(self.statistics(), [1, 0, 1])
+
+        # An unchanged material is not validated again.
+        self.assertEqual(self.validate(['/mtl/A']), ['/mtl/A'])
+        self.assertEqual(self.statistics(), [1, 1, 1])
+
+        # Editing its network validates it again.
+        self.shaders['A'].GetInput('roughness').Set(0.25)
+        self.assertEqual(self.validate(['/mtl/A']), ['/mtl/A'])
+        self.assertEqual(self.statistics(), [2, 1, 1])
+
+        # Edits outside of the network do not.
+        UsdGeom.Xform(self.stage.GetPrimAtPath('/geo')).AddTranslateOp().Set((1, 2, 3))
+        self.shaders['B'].GetInput('roughness').Set(0.75)
+        self.assertEqual(self.validate(['/mtl/A']), ['/mtl/A'])
+        self.assertEqual(self.statistics(), [2, 2, 1])
+
+        # Neither do edits that leave the content of the network unchanged.
+        roughness = self.shaders['A'].GetInput('roughness')
+        roughness.Set(1.0)
+        roughness.Set(0.25)
+        self.assertEqual(self.validate(['/mtl/A']), ['/mtl/A'])
+        self.assertEqual(self.statistics(), [2, 3, 1])
+
+    def testValidateBatched(self):
+        # The results follow the order of the request and skip what is not a material.
+        self.assertEqual(
+            self.validate(['/mtl/B', '/geo', '/mtl/A', '/missing']), ['/mtl/B', '/mtl/A'])
+        self.assertEqual(self.statistics(), [2, 0, 2])
+
+        # Validating the whole stage only validates the material not seen yet.
+        self.assertEqual(self.validate(), ['/mtl/A', '/mtl/B', '/mtl/C'])
+        self.assertEqual(self.statistics(), [3, 2, 3])
+
+        # Only the edited material is validated again.
+        self.shaders['C'].GetInput('roughness').Set(0.1)
+        self.assertEqual(self.validate(), ['/mtl/A', '/mtl/B', '/mtl/C'])
+        self.assertEqual(self.statistics(), [4, 4, 3])
+
+        # Removed materials leave the cache.
+        self.stage.RemovePrim('/mtl/B')
+        self.assertEqual(self.validate(), ['/mtl/A', '/mtl/C'])
+        self.assertEqual(self.statistics(), [4, 6, 2])
+
+        # Everything is validated again once the cache is cleared.
+        cmds.mayaUsdValidateMaterials(self.proxyShape, clearCache=True)
+        self.assertEqual(self.statistics(), [4, 6, 0])
+        self.assertEqual(self.validate(), ['/mtl/A', '/mtl/C'])
+        self.assertEqual(self.statistics(), [6, 6, 2])
+
+if __name__ == '__main__':
+    fixturesUtils.runTests(globals())
@@ -655,5 +655,58 @@ class CopyLayerPrimsTestCase(unittest.TestCase):
         self._verifyDestinationConnections(dstStage, expectedDstConnections)
 
 
+    def testCopyLayerPrimsManyRenamedTargets(self):
+        '''
+        Copy a layer containing many prims, each with both a relationship and
+        a connection to the same prim, which will collide in the destination.
+        Verify that every copied target gets renamed.
+        '''
+        count = 500
+
+        srcPrims = { "/group": "Xform", "/r1": "Sphere" }
+        targets = {}
+        for i in range(count):
+            path = "/group/item%d" % i
+            srcPrims[path] = "Cube"
+            targets[path] = "/r1"
+
+        # Map of destination prim path indexed by the corresponding source path.
+        expectedDstPrims = { path: path for path in targets }
+        expectedDstPrims["/group"] = "/group"
+        expectedDstPrims["/r1"] = "/r2"
+
+        # Map of relationship targets indexed by the destination path that
+        # containing the targeting 'arrow' relationship or 'tunnel' connection.
+        expectedDstTargets = { path: "/r2" for path in targets }
+
+        # Create the source stage, layer and prims.
+        srcStage, srcLayer = self._createStageLayerAndPrims(srcPrims)
+        self._createRelationships(srcStage, targets)
+        self._createConnections(srcStage, targets)
+
+        toCopy = [Sdf.Path("/group")]
+        srcParentPath = Sdf.Path("/")
+        dstParentPath = Sdf.Path("/")
+        followRelationships = True
+
+        # Create the destination stage, layer and a prim that will collide
+        # with the relationship target.
+        dstStage, dstLayer = self._createStageAndLayer()
+        dstStage.DefinePrim("/r1")
+
+        # Copy the desired prims for the test.
+        copiedPrims = mayaUsd.lib.copyLayerPrims(srcStage, srcLayer, srcParentPath,
+                                                 dstStage, dstLayer, dstParentPath,
+                                                 toCopy, followRelationships)
+
+        # Verify the results.
+        self._verifyDestinationPrims(dstStage, copiedPrims, srcPrims, expectedDstPrims)
+        self._verifyDestinationRelationships(dstStage, expectedDstTargets)
+        self._verifyDestinationConnections(dstStage, expectedDstTargets)
+        for path in targets:
+            self.assertNotIn(Sdf.Path("/r1"),
+                             dstStage.GetPrimAtPath(path).GetRelationship('arrow').GetTargets())
+
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -34,6 +34,9 @@ def getJobArgsProperties():
         "allMaterialConversions",
         "chaserNames",
         "compatibility",
+        "compactTimeSamples",
+        "compactTimeSamplesTolerance",
+        "collapseConstantTimeSamples",
         "convertMaterialsTo",
         "remapUVSetsTo",
         "defaultMeshScheme",
@@ -97,6 +100,7 @@ def getJobArgsProperties():
         "disableModelKindProcessor",
         "rootMapFunction",
         "shadingMode",
+        "sparseBlendShapeTargets",
         "staticSingleSample",
         "stripNamespaces",
         "worldspace",
@@ -1161,6 +1161,41 @@ class testXformStack(unittest.TestCase):
                 else:
                     self.assertEqual(resultList, expectedList, str(stackNames))
 
+    def testMatchingCache(self):
+        self.makeMayaStackAttrs()
+        mayaStack = mayaUsdLib.XformStack.MayaStack()
+        commonStack = mayaUsdLib.XformStack.CommonStack()
+        orderedOps, expected = self.makeXformOpsAndExpectedClassifications(
+            mayaStack, ['translate', 'rotate', 'scale'])
+
+        mayaUsdLib.XformStack.ClearMatchingCache()
+        self.assertEqual(mayaUsdLib.XformStack.GetMatchingCacheStats(), (0, 0))
+
+        # The first lookup runs the matching, the following ones reuse it.
+        for i in range(3):
+            self.assertEqual(mayaStack.MatchingSubstack(orderedOps), expected)
+        self.assertEqual(mayaUsdLib.XformStack.GetMatchingCacheStats(), (2, 1))
+
+        # Results are cached separately for each list of stacks.
+        for i in range(2):
+            self.assertEqual(
+                mayaUsdLib.XformStack.FirstMatchingSubstack(
+                    [mayaStack, commonStack], orderedOps), expected)
+            self.assertEqual(
+                mayaUsdLib.XformStack.FirstMatchingSubstack(
+                    [commonStack], orderedOps[1:]), [])
+        self.assertEqual(mayaUsdLib.XformStack.GetMatchingCacheStats(), (4, 3))
+
+        # A different op order is matched again.
+        rotateX = self.xform.AddRotateXOp(opSuffix='rotate')
+        self.assertEqual(
+            mayaStack.MatchingSubstack([orderedOps[0], rotateX]),
+            [expected[0], expected[1]])
+        self.assertEqual(mayaUsdLib.XformStack.GetMatchingCacheStats(), (4, 4))
+
+        mayaUsdLib.XformStack.ClearMatchingCache()
+        self.assertEqual(mayaUsdLib.XformStack.GetMatchingCacheStats(), (0, 0))
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
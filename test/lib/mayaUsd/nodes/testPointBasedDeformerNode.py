@@ -16,15 +16,21 @@
 #
 
 from pxr import Gf
+from pxr import Usd
+from pxr import UsdGeom
+from pxr import Vt
 
 from maya import OpenMaya as OM
 from maya import OpenMayaAnim as OMA
 from maya import cmds
 from maya import standalone
 
+from mayaUsd import lib as mayaUsdLib
+
 import fixturesUtils
 
 import os
+import time
 import unittest
 
 
@@ -51,6 +57,17 @@ class testPointBasedDeformerNode(unittest.TestCase):
     def setUp(self):
         cmds.file(new=True, force=True)
 
+    def _CreateDeformer(self, meshName, usdFilePath, primPath):
+        stageNode = cmds.createNode('pxrUsdStageNode')
+        cmds.setAttr('%s.filePath' % stageNode, usdFilePath, type='string')
+
+        cmds.select(meshName, replace=True)
+        deformerNode = cmds.deformer(type='pxrUsdPointBasedDeformerNode')[0]
+        cmds.setAttr('%s.primPath' % deformerNode, primPath, type='string')
+        cmds.connectAttr('%s.outUsdStage' % stageNode, '%s.inUsdStage' % deformerNode)
+        cmds.connectAttr('time1.outTime', '%s.time' % deformerNode)
+        return deformerNode
+
     def _ValidateControlPoint(self, nodeName, cpId, expectedPosition):
         cpX = cmds.getAttr('%s.controlPoints[%d].xValue' % (nodeName, cpId))
         cpY = cmds.getAttr('%s.controlPoints[%d].yValue' % (nodeName, cpId))
@@ -110,6 +127,110 @@ class testPointBasedDeformerNode(unittest.TestCase):
         self._ValidateControlPoint(testCube, 2, Gf.Vec3d(-1.0, 0.0, 1.0))
         self._ValidateControlPoint(testCube, 3, Gf.Vec3d(0.0, 1.0, 1.0))
 
+    def testCubeWithDeformerSubframeInterpolation(self):
+        """
+        Tests that the deformer interpolates the points between the USD time
+        samples bracketing a sub-frame time when asked to.
+        """
+        testCube = cmds.polyCube(depth=1.0, height=1.0, width=1.0)[0]
+        deformerNode = self._CreateDeformer(
+            testCube, self._deformingCubeUsdFilePath, self._deformingCubePrimPath)
+        cmds.setAttr('%s.interpolateSamples' % deformerNode, True)
+
+        stage = Usd.Stage.Open(self._deformingCubeUsdFilePath)
+        pointsAttr = UsdGeom.PointBased(
+            stage.GetPrimAtPath(self._deformingCubePrimPath)).GetPointsAttr()
+        lowerPoints = pointsAttr.Get(self.MID_TIMECODE - 1.0)
+        upperPoints = pointsAttr.Get(self.MID_TIMECODE)
+
+        cmds.currentTime(self.MID_TIMECODE - 0.25)
+
+        for cpId in range(4):
+            expected = Gf.Vec3d(lowerPoints[cpId] + 0.75 * (upperPoints[cpId] - lowerPoints[cpId]))
+            self._ValidateControlPoint(testCube, cpId, expected)
+
+    def testReadAheadCacheStatistics(self):
+        """
+        Tests that frames near the last evaluated one are served from the
+        read-ahead cache, that farther samples are released and that the cache
+        reports the memory it holds.
+        """
+        cache = mayaUsdLib.AttributeReadAheadCache
+        cache.Clear()
+        cache.ResetStatistics()
+        readAheadCount = cache.GetReadAheadCount()
+        cache.SetReadAheadCount(2)
+
+        testCube = cmds.polyCube(depth=1.0, height=1.0, width=1.0)[0]
+        self._CreateDeformer(
+            testCube, self._deformingCubeUsdFilePath, self._deformingCubePrimPath)
+        sampleBytes = cmds.polyEvaluate(testCube, vertex=True) * 3 * 4
+
+        for frame in range(int(self.START_TIMECODE), int(self.END_TIMECODE) + 1):
+            cmds.currentTime(frame)
+            cmds.dgeval('%s.outMesh' % testCube)
+        self.assertGreater(cache.GetMissCount(), 0)
+        self.assertGreater(cache.GetBytesResident(), 0)
+
+        # Only the samples within the read-ahead count of the last evaluated
+        # one are kept, whether playing back or not.
+        self.assertLessEqual(cache.GetBytesResident(), (2 * 2 + 1) * sampleBytes)
+
+        cache.ResetStatistics()
+        for frame in range(int(self.END_TIMECODE) - 1, int(self.END_TIMECODE) - 3, -1):
+            cmds.currentTime(frame)
+            cmds.dgeval('%s.outMesh' % testCube)
+        self.assertEqual(cache.GetMissCount(), 0)
+        self.assertAlmostEqual(cache.GetHitRate(), 1.0)
+
+        cmds.currentTime(self.START_TIMECODE)
+        cmds.dgeval('%s.outMesh' % testCube)
+        self.assertGreater(cache.GetMissCount(), 0)
+        self.assertLessEqual(cache.GetBytesResident(), (2 * 2 + 1) * sampleBytes)
+
+        cache.SetReadAheadCount(readAheadCount)
+        cache.Clear()
+        self.assertEqual(cache.GetBytesResident(), 0)
+
+    def testPlaybackPerformance(self):
+        """
+        Measures the playback rate of a deformer driving a one million point
+        cache. The rate is only reported, not validated.
+        """
+        numFrames = 10
+
+        # A 999x999 subdivided plane has one million vertices.
+        testPlane = cmds.polyPlane(width=10.0, height=10.0,
+            subdivisionsX=999, subdivisionsY=999)[0]
+        numPoints = cmds.polyEvaluate(testPlane, vertex=True)
+        self.assertEqual(numPoints, 1000000)
+
+        usdFilePath = os.path.abspath('PointBasedDeformerNodePlayback.usdc')
+        stage = Usd.Stage.CreateNew(usdFilePath)
+        stage.SetStartTimeCode(1.0)
+        stage.SetEndTimeCode(numFrames)
+        mesh = UsdGeom.Mesh.Define(stage, '/Plane')
+        pointsAttr = mesh.CreatePointsAttr()
+        for frame in range(1, numFrames + 1):
+            points = Vt.Vec3fArray(numPoints, Gf.Vec3f(0.0, float(frame), 0.0))
+            pointsAttr.Set(points, frame)
+        stage.GetRootLayer().Save()
+
+        self._CreateDeformer(testPlane, usdFilePath, '/Plane')
+
+        start = time.perf_counter()
+        for frame in range(1, numFrames + 1):
+            cmds.currentTime(frame)
+            cmds.dgeval('%s.outMesh' % testPlane)
+        elapsed = time.perf_counter() - start
+
+        self._ValidateControlPoint(testPlane, numPoints - 1, Gf.Vec3d(0.0, numFrames, 0.0))
+        print('Deformed %d frames of %d points at %.1f frames per second'
+            % (numFrames, numPoints, numFrames / elapsed))
+        print('Read-ahead cache hit rate: %.2f, %d bytes resident'
+            % (mayaUsdLib.AttributeReadAheadCache.GetHitRate(),
+               mayaUsdLib.AttributeReadAheadCache.GetBytesResident()))
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
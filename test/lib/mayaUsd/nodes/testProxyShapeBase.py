@@ -23,6 +23,7 @@ import fixturesUtils
 import mayaUsd_createStageWithNewLayer
 
 import os
+import shutil
 import tempfile
 import unittest
 import json
@@ -1147,6 +1148,119 @@ class testProxyShapeBase(unittest.TestCase):
             translate = xform.GetOrderedXformOps()[0].Get()
             self.assertEqual(translate[2], 2)
 
+    def testLoadStageAsync(self):
+        '''
+        Test that the stage is an empty placeholder while loading asynchronously,
+        and that cancelling the load keeps the placeholder.
+        '''
+        self.setupEmptyScene()
+
+        # Use a copy of the USD file, so that its stage is not already open.
+        usdFilePath = self.getTempFileName('AsyncCubeModel.usda')
+        shutil.copyfile(self.usdFilePath, usdFilePath)
+
+        shapeNode = cmds.createNode('mayaUsdProxyShape')
+        fullPath = cmds.ls(shapeNode, long=True)[0]
+        cmds.setAttr('{}.loadStageAsync'.format(shapeNode), True)
+        cmds.setAttr('{}.filePath'.format(shapeNode), usdFilePath, type='string')
+
+        stage = mayaUsdLib.GetPrim(fullPath).GetStage()
+        self.assertFalse(stage.GetPrimAtPath('/CubeModel'))
+
+        # The placeholder is kept once the load is cancelled.
+        mayaUsdLib.CancelStageLoad(fullPath)
+        self.assertFalse(mayaUsdLib.IsStageLoading(fullPath))
+        stage = mayaUsdLib.GetPrim(fullPath).GetStage()
+        self.assertFalse(stage.GetPrimAtPath('/CubeModel'))
+
+        # Turning off the asynchronous load opens the stage right away.
+        cmds.setAttr('{}.loadStageAsync'.format(shapeNode), False)
+        stage = mayaUsdLib.GetPrim(fullPath).GetStage()
+        self.assertTrue(stage.GetPrimAtPath('/CubeModel'))
+        self.assertFalse(mayaUsdLib.IsStageLoading(fullPath))
+
+    def testLoadStageAsyncWait(self):
+        '''
+        Test that waiting for an asynchronous load swaps in the loaded stage,
+        with its stage cache entry and the proxy shape outputs.
+        '''
+        self.setupEmptyScene()
+
+        # Use a copy of the USD file, so that its stage is not already open.
+        usdFilePath = self.getTempFileName('AsyncWaitCubeModel.usda')
+        shutil.copyfile(self.usdFilePath, usdFilePath)
+
+        shapeNode = cmds.createNode('mayaUsdProxyShape')
+        fullPath = cmds.ls(shapeNode, long=True)[0]
+        cmds.setAttr('{}.loadStageAsync'.format(shapeNode), True)
+        cmds.setAttr('{}.filePath'.format(shapeNode), usdFilePath, type='string')
+
+        placeholder = mayaUsdLib.GetPrim(fullPath).GetStage()
+        self.assertFalse(placeholder.GetPrimAtPath('/CubeModel'))
+
+        self.assertTrue(mayaUsdLib.WaitForStageLoad(fullPath))
+        self.assertFalse(mayaUsdLib.IsStageLoading(fullPath))
+
+        stage = mayaUsdLib.GetPrim(fullPath).GetStage()
+        self.assertNotEqual(stage, placeholder)
+        self.assertTrue(stage.GetPrimAtPath('/CubeModel'))
+        self.assertEqual(
+            os.path.normcase(stage.GetRootLayer().realPath), os.path.normcase(usdFilePath))
+
+        # The loaded stage is in the shared stage cache of the proxy shape.
+        self.assertTrue(mayaUsdLib.StageCache.Get(True, True).Contains(stage))
+
+        # The outputs of the proxy shape are the loaded stage.
+        cacheId = Usd.StageCache.Id.FromLongInt(
+            cmds.getAttr('{}.outStageCacheId'.format(shapeNode)))
+        self.assertEqual(UsdUtils.StageCache.Get().Find(cacheId), stage)
+        self.assertEqual(mayaUsd.ufe.getStage(fullPath), stage)
+
+        # Waiting again, or once the load is complete, does nothing.
+        self.assertTrue(mayaUsdLib.WaitForStageLoad(fullPath))
+        self.assertEqual(mayaUsdLib.GetPrim(fullPath).GetStage(), stage)
+
+        # Waiting for a cancelled load leaves the placeholder.
+        cancelledFilePath = self.getTempFileName('AsyncCancelledCubeModel.usda')
+        shutil.copyfile(self.usdFilePath, cancelledFilePath)
+        cmds.setAttr('{}.filePath'.format(shapeNode), cancelledFilePath, type='string')
+        mayaUsdLib.GetPrim(fullPath)  # Starts the load.
+        mayaUsdLib.CancelStageLoad(fullPath)
+        self.assertFalse(mayaUsdLib.WaitForStageLoad(fullPath))
+        self.assertFalse(mayaUsdLib.GetPrim(fullPath).GetStage().GetPrimAtPath('/CubeModel'))
+
+    def testLoadStageAsyncSave(self):
+        '''
+        Test that saving the Maya scene while a stage loads asynchronously waits
+        for the load and saves the loaded stage.
+        '''
+        tempMayaFile = self.setupEmptyScene()
+
+        # Use a copy of the USD file, so that its stage is not already open.
+        usdFilePath = self.getTempFileName('AsyncSaveCubeModel.usda')
+        shutil.copyfile(self.usdFilePath, usdFilePath)
+
+        shapeNode = cmds.createNode('mayaUsdProxyShape')
+        fullPath = cmds.ls(shapeNode, long=True)[0]
+        cmds.setAttr('{}.loadStageAsync'.format(shapeNode), True)
+        cmds.setAttr('{}.filePath'.format(shapeNode), usdFilePath, type='string')
+        self.assertFalse(mayaUsdLib.GetPrim(fullPath).GetStage().GetPrimAtPath('/CubeModel'))
+
+        cmds.file(save=True, force=True, type='mayaAscii')
+
+        stage = mayaUsdLib.GetPrim(fullPath).GetStage()
+        self.assertTrue(stage.GetPrimAtPath('/CubeModel'))
+        self.assertFalse(stage.GetRootLayer().anonymous)
+
+        # The saved scene loads the stage from its file again.
+        cmds.file(new=True, force=True)
+        cmds.file(tempMayaFile, open=True, force=True)
+        self.assertTrue(mayaUsdLib.WaitForStageLoad(fullPath))
+        stage = mayaUsdLib.GetPrim(fullPath).GetStage()
+        self.assertTrue(stage.GetPrimAtPath('/CubeModel'))
+        self.assertEqual(
+            os.path.normcase(stage.GetRootLayer().realPath), os.path.normcase(usdFilePath))
+
     def testRegisterFilePathEditor(self):
         '''
         Test registering USD file to Maya file path editor
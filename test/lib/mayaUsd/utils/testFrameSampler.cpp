@@ -0,0 +1,115 @@
+#include <mayaUsd/fileio/utils/frameSampler.h>
+
+#include <pxr/base/gf/interval.h>
+#include <pxr/base/tf/errorMark.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+bool isStrictlyIncreasing(const std::vector<double>& samples)
+{
+    return std::adjacent_find(samples.begin(), samples.end(), std::greater_equal<double>())
+        == samples.end();
+}
+
+} // namespace
+
+TEST(FrameSampler, timeSamples)
+{
+    EXPECT_EQ(
+        std::vector<double>({ 1, 1.9, 3, 3.9, 5, 5.9 }),
+        UsdMayaFrameSampler::GetTimeSamples(GfInterval(1, 5), { 0.0, 0.9 }, 2.0));
+    EXPECT_EQ(
+        std::vector<double>({ 1, 2, 3 }),
+        UsdMayaFrameSampler::GetTimeSamples(GfInterval(1, 3), {}, 1.0));
+    EXPECT_EQ(
+        std::vector<double>({ 1, 3 }),
+        UsdMayaFrameSampler::GetTimeSamples(GfInterval(1, 4), {}, 2.0));
+    EXPECT_EQ(
+        std::vector<double>({ 2 }), UsdMayaFrameSampler::GetTimeSamples(GfInterval(2), {}, 1.0));
+    EXPECT_TRUE(UsdMayaFrameSampler::GetTimeSamples(GfInterval(), {}, 1.0).empty());
+
+    // Open ends of the range are excluded.
+    EXPECT_EQ(
+        std::vector<double>({ 2 }),
+        UsdMayaFrameSampler::GetTimeSamples(GfInterval(1, 3, false, false), {}, 1.0));
+
+    // The last frame is kept, even when the stride does not add up to it exactly.
+    const std::vector<double> tenths
+        = UsdMayaFrameSampler::GetTimeSamples(GfInterval(0.0, 0.3), {}, 0.1);
+    ASSERT_EQ(4u, tenths.size());
+    EXPECT_EQ(0.3, tenths.back());
+}
+
+TEST(FrameSampler, duplicates)
+{
+    TfErrorMark mark;
+
+    // Offsets landing on other samples do not duplicate them.
+    EXPECT_EQ(
+        std::vector<double>({ 1, 2, 3, 4 }),
+        UsdMayaFrameSampler::GetTimeSamples(GfInterval(1, 3), { 0.0, 1.0 }, 1.0));
+    EXPECT_EQ(
+        std::vector<double>({ 0.5, 1, 1.5, 2, 2.5 }),
+        UsdMayaFrameSampler::GetTimeSamples(GfInterval(1, 2), { -0.5, 0.0, 0.5 }, 0.5));
+    EXPECT_TRUE(mark.IsClean());
+
+    EXPECT_TRUE(UsdMayaFrameSampler::GetTimeSamples(GfInterval(1, 3), {}, 0.0).empty());
+    EXPECT_FALSE(mark.IsClean());
+    mark.Clear();
+}
+
+TEST(FrameSampler, subframeTimeSamples)
+{
+    const std::vector<double> thirds = UsdMayaFrameSampler::GetSubframeTimeSamples(1, 2, 3);
+    ASSERT_EQ(4u, thirds.size());
+    EXPECT_EQ(1.0, thirds[0]);
+    EXPECT_DOUBLE_EQ(1.0 + 1.0 / 3.0, thirds[1]);
+    EXPECT_DOUBLE_EQ(1.0 + 2.0 / 3.0, thirds[2]);
+    EXPECT_EQ(2.0, thirds[3]);
+
+    // Zero subsamples is the same as one, and no sample goes past the last frame.
+    EXPECT_EQ(
+        std::vector<double>({ 1, 2 }), UsdMayaFrameSampler::GetSubframeTimeSamples(1, 2.5, 0));
+    EXPECT_EQ(std::vector<double>({ 5 }), UsdMayaFrameSampler::GetSubframeTimeSamples(5, 5, 4));
+    EXPECT_TRUE(UsdMayaFrameSampler::GetSubframeTimeSamples(2, 1, 1).empty());
+}
+
+TEST(FrameSampler, longRanges)
+{
+    // Adding up a third of a frame a hundred thousand times drifts away from
+    // the whole frames; the samples from ticks land on them exactly.
+    constexpr int kNumFrames = 100000;
+    for (unsigned int subSamples : { 3u, 7u, 9u }) {
+        SCOPED_TRACE(subSamples);
+        const std::vector<double> samples
+            = UsdMayaFrameSampler::GetSubframeTimeSamples(1, 1 + kNumFrames, subSamples);
+        ASSERT_EQ(size_t(kNumFrames) * subSamples + 1, samples.size());
+        EXPECT_TRUE(isStrictlyIncreasing(samples));
+        for (int frame = 0; frame <= kNumFrames; ++frame) {
+            ASSERT_EQ(1.0 + frame, samples[size_t(frame) * subSamples]);
+        }
+
+        // Subframes are at the same offsets in every frame.
+        for (unsigned int s = 1; s < subSamples; ++s) {
+            const double lastFrameSample = samples[size_t(kNumFrames - 1) * subSamples + s];
+            EXPECT_NEAR(samples[s] - samples[0], lastFrameSample - kNumFrames, 1e-9);
+        }
+    }
+
+    const std::vector<double> tenths
+        = UsdMayaFrameSampler::GetTimeSamples(GfInterval(0, kNumFrames), {}, 0.1);
+    ASSERT_EQ(size_t(kNumFrames) * 10 + 1, tenths.size());
+    EXPECT_TRUE(isStrictlyIncreasing(tenths));
+    for (int frame = 0; frame <= kNumFrames; ++frame) {
+        ASSERT_EQ(double(frame), tenths[size_t(frame) * 10]);
+    }
+}
@@ -0,0 +1,140 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2025 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import mayaUsd.lib as mayaUsdLib
+
+from maya import cmds
+from maya import standalone
+
+import fixturesUtils
+
+import time
+import unittest
+
+
+class testNodeObserver(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+        cmds.group(empty=True, name='top')
+        cmds.group(empty=True, name='middle', parent='top')
+        cmds.group(empty=True, name='newTop')
+
+    def _nodesNotified(self, observer, kind):
+        return [name for notifiedKind, name in observer.getNotifications() if notifiedKind == kind]
+
+    def testAncestorNotifications(self):
+        '''
+        Verify that the observer is notified of the changes of the ancestors of
+        the node, and no longer of its former ancestors once reparented.
+        '''
+        cmds.createNode('transform', name='node', parent='|top|middle')
+        observer = mayaUsdLib.NodeObserver('node')
+
+        cmds.rename('top', 'renamedTop')
+        self.assertIn('top', self._nodesNotified(observer, 'renamed'))
+
+        cmds.setAttr('renamedTop.visibility', False)
+        self.assertIn('renamedTop', self._nodesNotified(observer, 'plugDirty'))
+
+        observer.clearNotifications()
+        cmds.parent('|renamedTop|middle', '|newTop')
+        self.assertEqual(['middle'], self._nodesNotified(observer, 'parentAdded'))
+
+        # The former ancestor is no longer watched, right after the reparenting.
+        observer.clearNotifications()
+        cmds.setAttr('renamedTop.visibility', True)
+        cmds.rename('renamedTop', 'formerTop')
+        self.assertEqual([], observer.getNotifications())
+
+        cmds.setAttr('newTop.visibility', False)
+        self.assertIn('newTop', self._nodesNotified(observer, 'plugDirty'))
+
+        observer.clearNotifications()
+        observer.stopObserving()
+        cmds.setAttr('newTop.visibility', True)
+        cmds.rename('node', 'renamedNode')
+        self.assertEqual([], observer.getNotifications())
+
+    def testManyObservedNodes(self):
+        '''
+        Verify that thousands of nodes observed under shared ancestors are all
+        notified of the changes of these ancestors, and none of the changes of a
+        former ancestor.
+        '''
+        nodeCount = 10000
+        observers = []
+        for i in range(nodeCount):
+            node = cmds.createNode('transform', name='node%d' % i, parent='|top|middle')
+            observers.append(mayaUsdLib.NodeObserver(node))
+
+        cmds.rename('top', 'renamedTop')
+        for observer in observers:
+            self.assertIn('top', self._nodesNotified(observer, 'renamed'))
+            observer.clearNotifications()
+
+        cmds.parent('|renamedTop|middle', '|newTop')
+        for observer in observers:
+            self.assertEqual(['middle'], self._nodesNotified(observer, 'parentAdded'))
+            observer.clearNotifications()
+
+        cmds.setAttr('renamedTop.visibility', False)
+        cmds.rename('renamedTop', 'formerTop')
+        for observer in observers:
+            self.assertEqual([], observer.getNotifications())
+
+        cmds.setAttr('newTop.visibility', False)
+        for observer in observers:
+            self.assertIn('newTop', self._nodesNotified(observer, 'plugDirty'))
+            self.assertNotIn('formerTop', self._nodesNotified(observer, 'plugDirty'))
+
+    def testManyObservedNodesPerformance(self):
+        '''
+        Measures the rate at which the plug changes of an ancestor shared by
+        10k observed nodes are dispatched to their observers. The rate is only
+        reported, not validated.
+        '''
+        nodeCount = 10000
+        observers = []
+        for i in range(nodeCount):
+            node = cmds.createNode('transform', name='node%d' % i, parent='|top|middle')
+            observers.append(mayaUsdLib.NodeObserver(node))
+
+        changeCount = 10
+        start = time.perf_counter()
+        for i in range(changeCount):
+            cmds.setAttr('top.translateX', i)
+            # Evaluate the plugs dirtied by the change, so that the next change dirties them again.
+            cmds.getAttr('top.worldMatrix')
+        elapsed = time.perf_counter() - start
+
+        for observer in observers:
+            self.assertIn('top', self._nodesNotified(observer, 'plugDirty'))
+        print('Dispatched %d plug changes to %d observers at %.1f changes per second'
+            % (changeCount, nodeCount, changeCount / elapsed))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
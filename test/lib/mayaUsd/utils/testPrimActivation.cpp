@@ -0,0 +1,285 @@
+#include <mayaUsd/utils/primActivation.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Counts the changes notified by a stage, each of which follows a recomposition.
+class ChangeCounter : public TfWeakBase
+{
+public:
+    explicit ChangeCounter(const UsdStagePtr& stage)
+    {
+        _key = TfNotice::Register(TfCreateWeakPtr(this), &ChangeCounter::_onChange, stage);
+    }
+
+    ~ChangeCounter() { TfNotice::Revoke(_key); }
+
+    int count = 0;
+
+private:
+    void _onChange(const UsdNotice::ObjectsChanged&, const UsdStageWeakPtr&) { ++count; }
+
+    TfNotice::Key _key;
+};
+
+// The activation done before the ancestors were activated all at once: one
+// ancestor at a time, each recomposing the stage. PrimActivation must leave the
+// same opinions in the session layer, which matchesOneAtATime checks.
+void referenceActivate(
+    const UsdStagePtr& stage,
+    const SdfPath&     path,
+    SdfPathSet&        previouslyInactive,
+    SdfPathSet&        forcedActive)
+{
+    SdfLayerHandle sessionLayer = stage->GetSessionLayer();
+    UsdEditContext editContext(stage, sessionLayer);
+
+    SdfPathVector prefixes = path.GetPrefixes();
+    prefixes.pop_back();
+    for (const SdfPath& prefixPath : prefixes) {
+        UsdPrim prim = stage->GetPrimAtPath(prefixPath);
+        if (prim.IsActive())
+            continue;
+
+        if (sessionLayer->HasField(prefixPath, SdfFieldKeys->Active)) {
+            previouslyInactive.insert(prefixPath);
+        } else {
+            forcedActive.insert(prefixPath);
+        }
+        prim.SetActive(true);
+    }
+}
+
+void referenceRestore(
+    const UsdStagePtr& stage,
+    SdfPathSet&        previouslyInactive,
+    SdfPathSet&        forcedActive)
+{
+    UsdEditContext editContext(stage, stage->GetSessionLayer());
+    for (const SdfPath& path : previouslyInactive) {
+        stage->GetPrimAtPath(path).SetActive(false);
+    }
+    for (const SdfPath& path : forcedActive) {
+        stage->GetPrimAtPath(path).ClearActive();
+    }
+    previouslyInactive.clear();
+    forcedActive.clear();
+}
+
+// Create a chain of prims, every other one inactive, each with leaf siblings.
+SdfLayerRefPtr createDeepLayer(int depth, int siblings, SdfPath* leafPath)
+{
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous();
+    {
+        SdfChangeBlock    changeBlock;
+        SdfPrimSpecHandle parent;
+        for (int level = 0; level < depth; ++level) {
+            const std::string name = TfStringPrintf("L%d", level);
+            SdfPrimSpecHandle spec = parent ? SdfPrimSpec::New(parent, name, SdfSpecifierDef)
+                                            : SdfPrimSpec::New(layer, name, SdfSpecifierDef);
+            if (level % 2 == 0)
+                spec->SetActive(false);
+
+            for (int sibling = 0; sibling < siblings; ++sibling) {
+                SdfPrimSpec::New(spec, TfStringPrintf("S%d", sibling), SdfSpecifierDef);
+            }
+            parent = spec;
+        }
+        *leafPath = SdfPrimSpec::New(parent, "Leaf", SdfSpecifierDef)->GetPath();
+    }
+    return layer;
+}
+
+bool allAncestorsActive(const UsdStagePtr& stage, const SdfPath& path)
+{
+    for (const SdfPath& prefix : path.GetPrefixes()) {
+        const UsdPrim prim = stage->GetPrimAtPath(prefix);
+        if (!prim || !prim.IsActive())
+            return false;
+    }
+    return true;
+}
+
+bool hasActiveOpinions(const SdfLayerHandle& layer)
+{
+    bool found = false;
+    layer->Traverse(SdfPath::AbsoluteRootPath(), [&layer, &found](const SdfPath& path) {
+        found = found || layer->HasField(path, SdfFieldKeys->Active);
+    });
+    return found;
+}
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST(PrimActivation, deepHierarchy)
+{
+    SdfPath        leafPath;
+    UsdStageRefPtr stage = UsdStage::Open(createDeepLayer(10, 2, &leafPath));
+    EXPECT_FALSE(stage->GetPrimAtPath(leafPath));
+
+    ChangeCounter counter(stage);
+    {
+        MayaUsd::PrimActivation activation(stage, leafPath);
+        EXPECT_TRUE(allAncestorsActive(stage, leafPath));
+        EXPECT_EQ(1, counter.count);
+    }
+    EXPECT_EQ(2, counter.count);
+    EXPECT_FALSE(stage->GetPrimAtPath(leafPath));
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/L0")).IsActive());
+    EXPECT_FALSE(hasActiveOpinions(stage->GetSessionLayer()));
+}
+
+TEST(PrimActivation, sessionLayerOpinions)
+{
+    SdfPath        leafPath;
+    UsdStageRefPtr stage = UsdStage::Open(createDeepLayer(4, 0, &leafPath));
+
+    // Deactivate a prim active in the root layer from the session layer.
+    const SdfPath sessionInactivePath("/L0/L1");
+    {
+        UsdEditContext editContext(stage, stage->GetSessionLayer());
+        stage->OverridePrim(sessionInactivePath);
+    }
+    stage->GetSessionLayer()->SetField(sessionInactivePath, SdfFieldKeys->Active, false);
+
+    MayaUsd::PrimActivation activation(stage, leafPath);
+    EXPECT_TRUE(allAncestorsActive(stage, leafPath));
+
+    activation.restore();
+    EXPECT_FALSE(stage->GetPrimAtPath(leafPath));
+    EXPECT_EQ(
+        VtValue(false),
+        stage->GetSessionLayer()->GetField(sessionInactivePath, SdfFieldKeys->Active));
+    EXPECT_FALSE(stage->GetSessionLayer()->HasField(SdfPath("/L0"), SdfFieldKeys->Active));
+}
+
+TEST(PrimActivation, referencedOpinions)
+{
+    // The inactive opinion on /A/B comes from a reference, so it can only be
+    // seen once /A is active.
+    SdfLayerRefPtr referenced = SdfLayer::CreateAnonymous();
+    {
+        SdfPrimSpecHandle ref = SdfPrimSpec::New(referenced, "Ref", SdfSpecifierDef);
+        SdfPrimSpecHandle b = SdfPrimSpec::New(ref, "B", SdfSpecifierDef);
+        b->SetActive(false);
+        SdfPrimSpec::New(b, "C", SdfSpecifierDef);
+    }
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim        a = stage->DefinePrim(SdfPath("/A"));
+    a.GetReferences().AddReference(referenced->GetIdentifier(), SdfPath("/Ref"));
+    a.SetActive(false);
+
+    const SdfPath leafPath("/A/B/C");
+    {
+        MayaUsd::PrimActivation activation(stage, leafPath);
+        EXPECT_TRUE(allAncestorsActive(stage, leafPath));
+    }
+    EXPECT_FALSE(stage->GetPrimAtPath(leafPath));
+    EXPECT_FALSE(hasActiveOpinions(stage->GetSessionLayer()));
+}
+
+TEST(PrimActivation, matchesOneAtATime)
+{
+    SdfPath        leafPath;
+    UsdStageRefPtr referenceStage = UsdStage::Open(createDeepLayer(10, 2, &leafPath));
+    UsdStageRefPtr stage = UsdStage::Open(createDeepLayer(10, 2, &leafPath));
+
+    // Deactivate an active ancestor from the session layer, so that both the opinions
+    // to clear and the opinions to restore are covered.
+    const SdfPath sessionInactivePath("/L0/L1");
+    for (const UsdStageRefPtr& testStage : { referenceStage, stage }) {
+        {
+            UsdEditContext editContext(testStage, testStage->GetSessionLayer());
+            testStage->OverridePrim(sessionInactivePath);
+        }
+        testStage->GetSessionLayer()->SetField(sessionInactivePath, SdfFieldKeys->Active, false);
+    }
+
+    std::string referenceSession;
+    std::string session;
+    SdfPathSet  previouslyInactive;
+    SdfPathSet  forcedActive;
+    referenceActivate(referenceStage, leafPath, previouslyInactive, forcedActive);
+    referenceStage->GetSessionLayer()->ExportToString(&referenceSession);
+    {
+        MayaUsd::PrimActivation activation(stage, leafPath);
+        stage->GetSessionLayer()->ExportToString(&session);
+    }
+    EXPECT_EQ(referenceSession, session);
+
+    referenceRestore(referenceStage, previouslyInactive, forcedActive);
+    referenceStage->GetSessionLayer()->ExportToString(&referenceSession);
+    stage->GetSessionLayer()->ExportToString(&session);
+    EXPECT_EQ(referenceSession, session);
+}
+
+// Times reaching a deeply nested prim one ancestor at a time and all at once.
+// With 50 levels of 100 siblings this is a benchmark rather than a unit test,
+// so it is disabled; --gtest_also_run_disabled_tests runs it, and the times
+// and change counts go to the test properties of the --gtest_output=xml report.
+TEST(PrimActivation, DISABLED_benchmark)
+{
+    // Reach a prim under 25 inactive ancestors, each with 100 siblings, 20 times.
+    constexpr int  kRepeats = 20;
+    SdfPath        leafPath;
+    UsdStageRefPtr referenceStage = UsdStage::Open(createDeepLayer(50, 100, &leafPath));
+    UsdStageRefPtr stage = UsdStage::Open(createDeepLayer(50, 100, &leafPath));
+
+    ChangeCounter referenceCounter(referenceStage);
+    std::string   referenceSession;
+    SdfPathSet    previouslyInactive;
+    SdfPathSet    forcedActive;
+    auto          start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRepeats; ++i) {
+        referenceActivate(referenceStage, leafPath, previouslyInactive, forcedActive);
+        ASSERT_TRUE(referenceStage->GetPrimAtPath(leafPath));
+        referenceStage->GetSessionLayer()->ExportToString(&referenceSession);
+        referenceRestore(referenceStage, previouslyInactive, forcedActive);
+    }
+    const double referenceTime = secondsSince(start);
+
+    ChangeCounter counter(stage);
+    std::string   session;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRepeats; ++i) {
+        MayaUsd::PrimActivation activation(stage, leafPath);
+        ASSERT_TRUE(stage->GetPrimAtPath(leafPath));
+        stage->GetSessionLayer()->ExportToString(&session);
+    }
+    const double batchedTime = secondsSince(start);
+
+    EXPECT_EQ(referenceSession, session);
+    EXPECT_EQ(2 * kRepeats, counter.count);
+    EXPECT_FALSE(stage->GetPrimAtPath(leafPath));
+
+    ::testing::Test::RecordProperty("activations", kRepeats);
+    ::testing::Test::RecordProperty("oneAtATimeSeconds", TfStringPrintf("%.3f", referenceTime));
+    ::testing::Test::RecordProperty("oneAtATimeChanges", referenceCounter.count);
+    ::testing::Test::RecordProperty("batchedSeconds", TfStringPrintf("%.3f", batchedTime));
+    ::testing::Test::RecordProperty("batchedChanges", counter.count);
+}
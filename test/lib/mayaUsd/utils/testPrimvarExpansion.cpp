@@ -0,0 +1,297 @@
+#include <mayaUsd/render/vp2RenderDelegate/primvarExpansion.h>
+
+#include <pxr/base/gf/vec2i.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec4i.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/imaging/hd/basisCurvesTopology.h>
+#include <pxr/imaging/hd/tokens.h>
+
+#include <maya/MColor.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// The serial index builders of HdVP2BasisCurves before they moved to
+// primvarExpansion.h. The curveIndices test checks the shared builders against
+// them for every basis and wrap, with and without curve indices.
+int referenceMapIndex(const VtIntArray& curveIndices, int index)
+{
+    if (curveIndices.empty()) {
+        return index;
+    }
+    return curveIndices[std::min(index, static_cast<int>(curveIndices.size()) - 1)];
+}
+
+VtVec4iArray referenceCubicIndices(const HdBasisCurvesTopology& topology)
+{
+    std::vector<GfVec4i> indices;
+
+    const VtArray<int> vertexCounts = topology.GetCurveVertexCounts();
+    bool               wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    int                vStep = topology.GetCurveBasis() == HdTokens->bezier ? 3 : 1;
+
+    int vertexIndex = 0;
+    for (int count : vertexCounts) {
+        int numSegs = wrap ? count / vStep : ((count - 4) / vStep) + 1;
+        for (int i = 0; i < numSegs; ++i) {
+            GfVec4i seg;
+            int     offset = i * vStep;
+            for (int v = 0; v < 4; ++v) {
+                seg[v] = wrap ? vertexIndex + ((offset + v) % count)
+                              : vertexIndex + std::min(offset + v, (count - 1));
+            }
+            indices.push_back(seg);
+        }
+        vertexIndex += count;
+    }
+
+    VtVec4iArray finalIndices(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        for (int v = 0; v < 4; ++v) {
+            finalIndices[i][v] = referenceMapIndex(topology.GetCurveIndices(), indices[i][v]);
+        }
+    }
+    return finalIndices;
+}
+
+VtVec2iArray referenceLinesIndices(const HdBasisCurvesTopology& topology)
+{
+    std::vector<GfVec2i> indices;
+
+    int vertexIndex = 0;
+    for (int count : topology.GetCurveVertexCounts()) {
+        for (int i = 0; i < count; i += 2) {
+            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
+            vertexIndex += 2;
+        }
+    }
+
+    VtVec2iArray finalIndices(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        finalIndices[i].Set(
+            referenceMapIndex(topology.GetCurveIndices(), indices[i][0]),
+            referenceMapIndex(topology.GetCurveIndices(), indices[i][1]));
+    }
+    return finalIndices;
+}
+
+VtVec2iArray referenceLineSegmentIndices(const HdBasisCurvesTopology& topology)
+{
+    const bool skipFirstAndLastSegs = (topology.GetCurveBasis() == HdTokens->catmullRom);
+
+    std::vector<GfVec2i> indices;
+    bool                 wrap = topology.GetCurveWrap() == HdTokens->periodic;
+    int                  vertexIndex = 0;
+    for (int count : topology.GetCurveVertexCounts()) {
+        int       v0 = vertexIndex;
+        const int firstVert = v0;
+        ++vertexIndex;
+        for (int i = 1; i < count; ++i) {
+            int v1 = vertexIndex;
+            ++vertexIndex;
+            if (!skipFirstAndLastSegs || (i > 1 && i < count - 1)) {
+                indices.push_back(GfVec2i(v0, v1));
+            }
+            v0 = v1;
+        }
+        if (wrap) {
+            indices.push_back(GfVec2i(v0, firstVert));
+        }
+    }
+
+    VtVec2iArray finalIndices(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        finalIndices[i].Set(
+            referenceMapIndex(topology.GetCurveIndices(), indices[i][0]),
+            referenceMapIndex(topology.GetCurveIndices(), indices[i][1]));
+    }
+    return finalIndices;
+}
+
+// Curves with counts covering the degenerate cases of each basis.
+HdBasisCurvesTopology
+makeTopology(const TfToken& basis, const TfToken& wrap, const VtIntArray& curveIndices = {})
+{
+    const VtIntArray vertexCounts { 4, 7, 2, 10, 3, 5, 1, 6 };
+    return HdBasisCurvesTopology(
+        basis == HdTokens->linear ? HdTokens->linear : HdTokens->cubic,
+        basis == HdTokens->linear ? TfToken() : basis,
+        wrap,
+        vertexCounts,
+        curveIndices);
+}
+
+std::vector<HdBasisCurvesTopology> allTopologies()
+{
+    VtIntArray curveIndices(30);
+    for (size_t i = 0; i < curveIndices.size(); ++i) {
+        curveIndices[i] = static_cast<int>(curveIndices.size() - i);
+    }
+
+    std::vector<HdBasisCurvesTopology> topologies;
+    for (const TfToken& basis :
+         { HdTokens->linear, HdTokens->bezier, HdTokens->bSpline, HdTokens->catmullRom }) {
+        for (const TfToken& wrap :
+             { HdTokens->nonperiodic, HdTokens->periodic, HdTokens->segmented }) {
+            topologies.push_back(makeTopology(basis, wrap));
+            topologies.push_back(makeTopology(basis, wrap, curveIndices));
+        }
+    }
+    return topologies;
+}
+
+// Hair-scale topology: a million curves with ten vertices each.
+HdBasisCurvesTopology makeHairTopology(const TfToken& basis)
+{
+    return HdBasisCurvesTopology(
+        HdTokens->cubic, basis, HdTokens->nonperiodic, VtIntArray(1000000, 10), VtIntArray());
+}
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST(PrimvarExpansion, expandPrimvar)
+{
+    VtFloatArray result;
+    EXPECT_TRUE(HdVP2ExpandPrimvar(3, VtFloatArray { 2.0f }, &result));
+    EXPECT_EQ(VtFloatArray({ 2.0f, 2.0f, 2.0f }), result);
+
+    const VtFloatArray perVertex { 1.0f, 2.0f, 3.0f };
+    EXPECT_TRUE(HdVP2ExpandPrimvar(3, perVertex, &result));
+    EXPECT_TRUE(result.IsIdentical(perVertex));
+
+    result.clear();
+    EXPECT_FALSE(HdVP2ExpandPrimvar(4, perVertex, &result));
+    EXPECT_TRUE(result.empty());
+}
+
+TEST(PrimvarExpansion, fillColorAndOpacity)
+{
+    const VtVec3fArray colors { GfVec3f(1.0f, 2.0f, 3.0f), GfVec3f(4.0f, 5.0f, 6.0f) };
+
+    std::vector<float> rgba(8);
+    HdVP2FillColorAndOpacity(rgba.data(), 2, colors, VtFloatArray { 0.5f });
+    EXPECT_EQ(std::vector<float>({ 1.0f, 2.0f, 3.0f, 0.5f, 4.0f, 5.0f, 6.0f, 0.5f }), rgba);
+
+    HdVP2FillColorAndOpacity(
+        rgba.data(), 2, VtVec3fArray { GfVec3f(7.0f) }, VtFloatArray { 0.1f, 0.2f });
+    EXPECT_EQ(std::vector<float>({ 7.0f, 7.0f, 7.0f, 0.1f, 7.0f, 7.0f, 7.0f, 0.2f }), rgba);
+
+    std::vector<float> instanceRgba(12);
+    HdVP2FillInstanceColorAndOpacity(
+        instanceRgba.data(), VtIntArray { 1, 0, 1 }, colors, VtFloatArray { 0.5f });
+    EXPECT_EQ(
+        std::vector<float>(
+            { 4.0f, 5.0f, 6.0f, 0.5f, 1.0f, 2.0f, 3.0f, 0.5f, 4.0f, 5.0f, 6.0f, 0.5f }),
+        instanceRgba);
+}
+
+TEST(PrimvarExpansion, instanceColors)
+{
+    std::vector<unsigned char> colorIndices(4, 0);
+
+    HdSelection::PrimSelectionState state;
+    state.instanceIndices.push_back(VtIntArray { 1, 3, 42, -1 });
+    HdVP2MarkSelectedInstances<unsigned char>(colorIndices, &state, 1);
+    HdVP2MarkSelectedInstances<unsigned char>(colorIndices, nullptr, 1);
+    colorIndices[2] = 2;
+    EXPECT_EQ(std::vector<unsigned char>({ 0, 1, 2, 1 }), colorIndices);
+
+    const MColor       colors[] = { MColor(0.0f, 0.0f, 0.0f, 0.0f), MColor(1.0f, 1.0f, 1.0f) };
+    std::vector<float> rgba(16, 9.0f);
+    HdVP2FillInstanceColors(rgba.data(), colorIndices, colors, 2);
+    EXPECT_EQ(
+        std::vector<float>({ 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 9.0f, 9.0f, 9.0f,
+                             9.0f, 1.0f, 1.0f, 1.0f, 1.0f }),
+        rgba);
+}
+
+TEST(PrimvarExpansion, curveIndices)
+{
+    for (const HdBasisCurvesTopology& topology : allTopologies()) {
+        SCOPED_TRACE(
+            topology.GetCurveBasis().GetString() + " " + topology.GetCurveWrap().GetString());
+        EXPECT_EQ(referenceCubicIndices(topology), HdVP2BuildCubicCurveIndices(topology));
+        EXPECT_EQ(referenceLinesIndices(topology), HdVP2BuildLinesCurveIndices(topology));
+        EXPECT_EQ(
+            referenceLineSegmentIndices(topology), HdVP2BuildLineSegmentCurveIndices(topology));
+    }
+}
+
+// Compares the serial and the shared expansions of hair-scale curves. Building
+// ten million curve vertices several times takes seconds, so this test is
+// disabled: run it with --gtest_also_run_disabled_tests, and read the times
+// from the properties that --gtest_output=xml records.
+TEST(PrimvarExpansion, DISABLED_benchmark)
+{
+    // Ten million curve vertices.
+    const HdBasisCurvesTopology hair = makeHairTopology(HdTokens->bSpline);
+    const size_t                numVertices = hair.CalculateNeededNumberOfControlPoints();
+
+    auto start = std::chrono::steady_clock::now();
+    const VtVec4iArray referenceCubic = referenceCubicIndices(hair);
+    const double       referenceCubicTime = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    EXPECT_EQ(referenceCubic, HdVP2BuildCubicCurveIndices(hair));
+    const double cubicTime = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    const VtVec2iArray referenceSegments = referenceLineSegmentIndices(hair);
+    const double       referenceSegmentsTime = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    EXPECT_EQ(referenceSegments, HdVP2BuildLineSegmentCurveIndices(hair));
+    const double segmentsTime = secondsSince(start);
+
+    // Per-vertex colors with a constant opacity, expanded as the curves did.
+    VtVec3fArray colors(numVertices, GfVec3f(0.5f));
+    VtFloatArray opacities { 1.0f };
+
+    std::vector<float> rgba(numVertices * 4);
+    start = std::chrono::steady_clock::now();
+    {
+        VtFloatArray expandedOpacities(numVertices);
+        for (size_t i = 0; i < numVertices; ++i) {
+            expandedOpacities[i] = opacities[0];
+        }
+        unsigned int offset = 0;
+        for (size_t v = 0; v < numVertices; v++) {
+            const GfVec3f& color = colors[v];
+            rgba[offset++] = color[0];
+            rgba[offset++] = color[1];
+            rgba[offset++] = color[2];
+            rgba[offset++] = expandedOpacities[v];
+        }
+    }
+    const double referenceColorTime = secondsSince(start);
+
+    std::vector<float> expandedRgba(numVertices * 4);
+    start = std::chrono::steady_clock::now();
+    HdVP2FillColorAndOpacity(expandedRgba.data(), numVertices, colors, opacities);
+    const double colorTime = secondsSince(start);
+    EXPECT_EQ(rgba, expandedRgba);
+
+    ::testing::Test::RecordProperty("curveVertices", static_cast<int>(numVertices));
+    ::testing::Test::RecordProperty(
+        "referenceCubicSeconds", TfStringPrintf("%.3f", referenceCubicTime));
+    ::testing::Test::RecordProperty("cubicSeconds", TfStringPrintf("%.3f", cubicTime));
+    ::testing::Test::RecordProperty(
+        "referenceSegmentsSeconds", TfStringPrintf("%.3f", referenceSegmentsTime));
+    ::testing::Test::RecordProperty("segmentsSeconds", TfStringPrintf("%.3f", segmentsTime));
+    ::testing::Test::RecordProperty(
+        "referenceColorSeconds", TfStringPrintf("%.3f", referenceColorTime));
+    ::testing::Test::RecordProperty("colorSeconds", TfStringPrintf("%.3f", colorTime));
+}
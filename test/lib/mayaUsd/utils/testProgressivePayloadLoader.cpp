@@ -0,0 +1,177 @@
+#include <mayaUsd/utils/progressivePayloadLoader.h>
+
+#include <pxr/base/gf/frustum.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/payload.h>
+#include <pxr/usd/usd/modelAPI.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/modelAPI.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xform.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+class PrioritizePayloads : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _assetLayer = SdfLayer::CreateAnonymous("asset.usda");
+        UsdStageRefPtr assetStage = UsdStage::Open(_assetLayer);
+        UsdGeomXform::Define(assetStage, SdfPath("/Asset/Geom"));
+
+        SdfLayerRefPtr rootLayer = SdfLayer::CreateAnonymous("root.usda");
+        {
+            UsdStageRefPtr stage = UsdStage::Open(rootLayer);
+            UsdModelAPI(UsdGeomXform::Define(stage, SdfPath("/World")).GetPrim())
+                .SetKind(KindTokens->group);
+
+            // The camera is at the origin, looking down the -Z axis.
+            addPayload(stage, "Near", GfVec3d(0.0, 0.0, -5.0), true);
+            addPayload(stage, "Far", GfVec3d(0.0, 0.0, -50.0), true);
+            addPayload(stage, "Behind", GfVec3d(0.0, 0.0, 50.0), true);
+            addPayload(stage, "Aside", GfVec3d(100.0, 0.0, -5.0), true);
+            addPayload(stage, "NoBounds", GfVec3d(0.0, 0.0, -5.0), false);
+        }
+
+        _stage = UsdStage::Open(rootLayer, UsdStage::LoadNone);
+
+        GfFrustum frustum;
+        frustum.SetPerspective(60.0, 1.0, 0.1, 1000.0);
+        _stageToClip = frustum.ComputeViewMatrix() * frustum.ComputeProjectionMatrix();
+    }
+
+    void addPayload(
+        const UsdStageRefPtr& stage,
+        const std::string&    name,
+        const GfVec3d&        position,
+        bool                  withBounds)
+    {
+        UsdGeomXform xform
+            = UsdGeomXform::Define(stage, SdfPath("/World").AppendChild(TfToken(name)));
+        xform.AddTranslateOp().Set(position);
+
+        UsdPrim prim = xform.GetPrim();
+        UsdModelAPI(prim).SetKind(KindTokens->component);
+        prim.GetPayloads().AddPayload(SdfPayload(_assetLayer->GetIdentifier(), SdfPath("/Asset")));
+
+        if (withBounds) {
+            UsdGeomModelAPI(prim).SetExtentsHint(
+                VtVec3fArray { GfVec3f(-1.0f, -1.0f, -1.0f), GfVec3f(1.0f, 1.0f, 1.0f) });
+        }
+    }
+
+    std::vector<std::string> prioritize(double minScreenSize = 0.0) const
+    {
+        std::vector<std::string> names;
+        for (const MayaUsd::PayloadPriority& priority : MayaUsd::prioritizePayloads(
+                 _stage,
+                 _stageToClip,
+                 UsdTimeCode::Default(),
+                 { UsdGeomTokens->default_ },
+                 minScreenSize)) {
+            names.push_back(priority.path.GetName());
+        }
+        return names;
+    }
+
+    SdfLayerRefPtr _assetLayer;
+    UsdStageRefPtr _stage;
+    GfMatrix4d     _stageToClip;
+};
+
+} // namespace
+
+TEST_F(PrioritizePayloads, biggestOnScreenFirst)
+{
+    const std::vector<std::string> expected { "Near", "Far", "NoBounds" };
+    EXPECT_EQ(expected, prioritize());
+}
+
+TEST_F(PrioritizePayloads, minScreenSize)
+{
+    const std::vector<std::string> expected { "Near", "NoBounds" };
+    EXPECT_EQ(expected, prioritize(0.01));
+}
+
+TEST_F(PrioritizePayloads, skipLoaded)
+{
+    _stage->Load(SdfPath("/World/Near"));
+
+    const std::vector<std::string> expected { "Far", "NoBounds" };
+    EXPECT_EQ(expected, prioritize());
+}
+
+TEST_F(PrioritizePayloads, layerPaths)
+{
+    const std::vector<MayaUsd::PayloadPriority> priorities = MayaUsd::prioritizePayloads(
+        _stage, _stageToClip, UsdTimeCode::Default(), { UsdGeomTokens->default_ });
+    ASSERT_FALSE(priorities.empty());
+
+    for (const MayaUsd::PayloadPriority& priority : priorities) {
+        ASSERT_EQ(1u, priority.layerPaths.size());
+        EXPECT_TRUE(SdfLayer::Find(priority.layerPaths[0]));
+    }
+}
+
+TEST_F(PrioritizePayloads, screenSize)
+{
+    const std::vector<MayaUsd::PayloadPriority> priorities = MayaUsd::prioritizePayloads(
+        _stage, _stageToClip, UsdTimeCode::Default(), { UsdGeomTokens->default_ });
+    ASSERT_EQ(3u, priorities.size());
+
+    // With a 60 degrees field of view, a 2 units box 5 units away covers
+    // about a fifth of the screen, and less than a hundredth 50 units away.
+    EXPECT_GT(priorities[0].screenSize, 0.1);
+    EXPECT_LT(priorities[0].screenSize, 0.2);
+    EXPECT_GT(priorities[1].screenSize, 0.0);
+    EXPECT_LT(priorities[1].screenSize, 0.01);
+    EXPECT_EQ(0.0, priorities[2].screenSize);
+}
+
+TEST_F(PrioritizePayloads, nestedPayloads)
+{
+    // Give the asset a payload of its own.
+    SdfLayerRefPtr innerLayer = SdfLayer::CreateAnonymous("inner.usda");
+    {
+        UsdStageRefPtr innerStage = UsdStage::Open(innerLayer);
+        UsdGeomXform::Define(innerStage, SdfPath("/Inner/Geom"));
+
+        UsdStageRefPtr assetStage = UsdStage::Open(_assetLayer);
+        UsdGeomXform::Define(assetStage, SdfPath("/Asset/Inner"))
+            .GetPrim()
+            .GetPayloads()
+            .AddPayload(SdfPayload(innerLayer->GetIdentifier(), SdfPath("/Inner")));
+    }
+
+    const SdfPath    nearPath("/World/Near");
+    const SdfPath    innerPath("/World/Near/Inner");
+    const SdfPathSet roots { nearPath };
+
+    // Loading the asset without its descendants exposes its payload, and only that one is
+    // under the loaded asset.
+    _stage->LoadAndUnload(roots, SdfPathSet(), UsdLoadWithoutDescendants);
+    std::vector<MayaUsd::PayloadPriority> priorities = MayaUsd::prioritizePayloads(
+        _stage, roots, _stageToClip, UsdTimeCode::Default(), { UsdGeomTokens->default_ });
+    ASSERT_EQ(1u, priorities.size());
+    EXPECT_EQ(innerPath, priorities[0].path);
+    ASSERT_EQ(1u, priorities[0].layerPaths.size());
+    EXPECT_TRUE(SdfLayer::Find(priorities[0].layerPaths[0]));
+
+    _stage->Load(innerPath);
+    priorities = MayaUsd::prioritizePayloads(
+        _stage, roots, _stageToClip, UsdTimeCode::Default(), { UsdGeomTokens->default_ });
+    EXPECT_TRUE(priorities.empty());
+}
@@ -0,0 +1,249 @@
+#include <mayaUsd/base/tokens.h>
+#include <mayaUsd/utils/selectability.h>
+
+#include <usdUfe/base/tokens.h>
+
+#include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+void setSelectability(const UsdStageRefPtr& stage, const char* path, const TfToken& value)
+{
+    stage->GetPrimAtPath(SdfPath(path)).SetMetadata(MayaUsdMetadata->Selectability, value);
+}
+
+// The selectability computation done before the cache was kept across
+// selections, with a cache that only lives for one selection. The persistent
+// cache must give the same results after any metadata change, which the
+// matchesPerSelectionCache test checks against it.
+using ReferenceCache = TfHashMap<UsdPrim, bool, TfHash>;
+
+bool referenceIsSelectable(ReferenceCache& cache, const UsdPrim& prim)
+{
+    if (!prim.IsValid())
+        return true;
+
+    const auto pos = cache.find(prim);
+    if (pos != cache.end())
+        return pos->second;
+
+    bool selectable = true;
+    switch (Selectability::getLocalState(prim)) {
+    case Selectability::kOn: selectable = true; break;
+    case Selectability::kOff: selectable = false; break;
+    default: selectable = referenceIsSelectable(cache, prim.GetParent()); break;
+    }
+    cache[prim] = selectable;
+    return selectable;
+}
+
+// Create a stage with the given number of groups of 10 sets of 100 prims, every other set
+// unselectable.
+UsdStageRefPtr createLargeStage(int groupCount, std::vector<UsdPrim>& leaves)
+{
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous();
+    {
+        SdfChangeBlock    changeBlock;
+        SdfPrimSpecHandle world = SdfPrimSpec::New(layer, "World", SdfSpecifierDef);
+        for (int group = 0; group < groupCount; ++group) {
+            SdfPrimSpecHandle groupSpec
+                = SdfPrimSpec::New(world, TfStringPrintf("G%d", group), SdfSpecifierDef);
+            for (int set = 0; set < 10; ++set) {
+                SdfPrimSpecHandle setSpec
+                    = SdfPrimSpec::New(groupSpec, TfStringPrintf("S%d", set), SdfSpecifierDef);
+                if (set % 2)
+                    setSpec->SetInfo(
+                        MayaUsdMetadata->Selectability, VtValue(UsdUfe::GenericTokens->Off));
+
+                for (int leaf = 0; leaf < 100; ++leaf) {
+                    SdfPrimSpec::New(setSpec, TfStringPrintf("P%d", leaf), SdfSpecifierDef);
+                }
+            }
+        }
+    }
+
+    UsdStageRefPtr stage = UsdStage::Open(layer);
+    for (const UsdPrim& prim : stage->Traverse()) {
+        if (prim.GetChildren().empty())
+            leaves.push_back(prim);
+    }
+    return stage;
+}
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST(Selectability, inherited)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/A/B/C"));
+    stage->DefinePrim(SdfPath("/D"));
+    setSelectability(stage, "/A", UsdUfe::GenericTokens->Off);
+    setSelectability(stage, "/A/B/C", UsdUfe::GenericTokens->On);
+
+    Selectability::prepareForSelection();
+    EXPECT_FALSE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A"))));
+    EXPECT_FALSE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B"))));
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B/C"))));
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/D"))));
+    EXPECT_TRUE(Selectability::isSelectable(UsdPrim()));
+}
+
+TEST(Selectability, metadataChanges)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/A/B/C"));
+    stage->DefinePrim(SdfPath("/D/E"));
+
+    Selectability::prepareForSelection();
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B/C"))));
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/D/E"))));
+
+    // The cache survives across selections, but not across metadata changes.
+    setSelectability(stage, "/A", UsdUfe::GenericTokens->Off);
+    Selectability::prepareForSelection();
+    EXPECT_FALSE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B/C"))));
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/D/E"))));
+
+    setSelectability(stage, "/A/B", UsdUfe::GenericTokens->On);
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B/C"))));
+    EXPECT_FALSE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A"))));
+
+    stage->GetPrimAtPath(SdfPath("/A/B")).ClearMetadata(MayaUsdMetadata->Selectability);
+    EXPECT_FALSE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B/C"))));
+}
+
+TEST(Selectability, resync)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/A/B"));
+    setSelectability(stage, "/A", UsdUfe::GenericTokens->Off);
+
+    Selectability::prepareForSelection();
+    EXPECT_FALSE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B"))));
+
+    // Recreate the prims without the metadata.
+    stage->RemovePrim(SdfPath("/A"));
+    stage->DefinePrim(SdfPath("/A/B"));
+    EXPECT_TRUE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B"))));
+
+    // Bring the metadata back from a sublayer.
+    SdfLayerRefPtr sublayer = SdfLayer::CreateAnonymous();
+    {
+        UsdStageRefPtr sublayerStage = UsdStage::Open(sublayer);
+        sublayerStage->DefinePrim(SdfPath("/A"));
+        setSelectability(sublayerStage, "/A", UsdUfe::GenericTokens->Off);
+    }
+    stage->GetRootLayer()->InsertSubLayerPath(sublayer->GetIdentifier());
+    EXPECT_FALSE(Selectability::isSelectable(stage->GetPrimAtPath(SdfPath("/A/B"))));
+}
+
+TEST(Selectability, separateStages)
+{
+    UsdStageRefPtr stage1 = UsdStage::CreateInMemory();
+    UsdStageRefPtr stage2 = UsdStage::CreateInMemory();
+    stage1->DefinePrim(SdfPath("/A"));
+    stage2->DefinePrim(SdfPath("/A"));
+    setSelectability(stage1, "/A", UsdUfe::GenericTokens->Off);
+
+    Selectability::prepareForSelection();
+    EXPECT_FALSE(Selectability::isSelectable(stage1->GetPrimAtPath(SdfPath("/A"))));
+    EXPECT_TRUE(Selectability::isSelectable(stage2->GetPrimAtPath(SdfPath("/A"))));
+
+    // Stages allocated after others are released must not see their selectability.
+    stage1.Reset();
+    Selectability::prepareForSelection();
+    UsdStageRefPtr stage3 = UsdStage::CreateInMemory();
+    stage3->DefinePrim(SdfPath("/A"));
+    EXPECT_TRUE(Selectability::isSelectable(stage3->GetPrimAtPath(SdfPath("/A"))));
+}
+
+TEST(Selectability, matchesPerSelectionCache)
+{
+    std::vector<UsdPrim> leaves;
+    UsdStageRefPtr       stage = createLargeStage(5, leaves);
+    ASSERT_EQ(5000u, leaves.size());
+
+    const auto verify = [&stage]() {
+        ReferenceCache cache;
+        Selectability::prepareForSelection();
+        for (const UsdPrim& prim : stage->Traverse()) {
+            EXPECT_EQ(referenceIsSelectable(cache, prim), Selectability::isSelectable(prim))
+                << prim.GetPath().GetString();
+        }
+    };
+
+    verify();
+    setSelectability(stage, "/World/G1", UsdUfe::GenericTokens->Off);
+    verify();
+    setSelectability(stage, "/World/G1/S3", UsdUfe::GenericTokens->On);
+    verify();
+    setSelectability(stage, "/World/G2/S4/P7", UsdUfe::GenericTokens->Off);
+    verify();
+    setSelectability(stage, "/World", UsdUfe::GenericTokens->Off);
+    verify();
+    stage->GetPrimAtPath(SdfPath("/World/G1")).ClearMetadata(MayaUsdMetadata->Selectability);
+    verify();
+
+    // Recreate a set without its metadata.
+    stage->RemovePrim(SdfPath("/World/G3/S1"));
+    stage->DefinePrim(SdfPath("/World/G3/S1/P0"));
+    verify();
+}
+
+// Compares the per-selection and the persistent caches over repeated marquee
+// selections of a large stage. It takes too long for the unit test suite, so
+// it is disabled: --gtest_also_run_disabled_tests runs it, and the times are
+// recorded as properties of the test in the --gtest_output=xml report.
+TEST(Selectability, DISABLED_benchmark)
+{
+    // Marquee-select the 100,000 leaf prims of a stage ten times in a row.
+    constexpr int        kSelections = 10;
+    std::vector<UsdPrim> leaves;
+    UsdStageRefPtr       stage = createLargeStage(100, leaves);
+    ASSERT_EQ(100000u, leaves.size());
+
+    std::vector<bool> referenceResults(leaves.size());
+    auto              start = std::chrono::steady_clock::now();
+    for (int selection = 0; selection < kSelections; ++selection) {
+        ReferenceCache cache;
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            referenceResults[i] = referenceIsSelectable(cache, leaves[i]);
+        }
+    }
+    const double referenceTime = secondsSince(start);
+
+    std::vector<bool> results(leaves.size());
+    start = std::chrono::steady_clock::now();
+    for (int selection = 0; selection < kSelections; ++selection) {
+        Selectability::prepareForSelection();
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            results[i] = Selectability::isSelectable(leaves[i]);
+        }
+    }
+    const double cachedTime = secondsSince(start);
+    EXPECT_EQ(referenceResults, results);
+
+    ::testing::Test::RecordProperty("selections", kSelections);
+    ::testing::Test::RecordProperty("prims", static_cast<int>(leaves.size()));
+    ::testing::Test::RecordProperty("clearedCacheSeconds", TfStringPrintf("%.3f", referenceTime));
+    ::testing::Test::RecordProperty("persistentCacheSeconds", TfStringPrintf("%.3f", cachedTime));
+}
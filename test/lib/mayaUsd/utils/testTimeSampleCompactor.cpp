@@ -0,0 +1,236 @@
+#include <mayaUsd/utils/timeSampleCompactor.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+SdfTimeSampleMap makeSamples(const std::vector<double>& values)
+{
+    SdfTimeSampleMap samples;
+    for (size_t i = 0; i < values.size(); ++i) {
+        samples[static_cast<double>(i + 1)] = VtValue(values[i]);
+    }
+    return samples;
+}
+
+std::vector<double> sampleTimes(const SdfTimeSampleMap& samples)
+{
+    std::vector<double> times;
+    for (const auto& sample : samples) {
+        times.push_back(sample.first);
+    }
+    return times;
+}
+
+// The value of the samples at the time, held or linearly interpolated.
+double evaluate(const SdfTimeSampleMap& samples, double time, bool linear)
+{
+    const auto next = samples.lower_bound(time);
+    if (next == samples.end()) {
+        return std::prev(next)->second.Get<double>();
+    }
+    if (next->first == time || next == samples.begin()) {
+        return next->second.Get<double>();
+    }
+
+    const auto   prev = std::prev(next);
+    const double value = prev->second.Get<double>();
+    if (!linear) {
+        return value;
+    }
+    const double alpha = (time - prev->first) / (next->first - prev->first);
+    return value + (next->second.Get<double>() - value) * alpha;
+}
+
+double getDouble(const UsdAttribute& attr, double time)
+{
+    double value = 0.0;
+    attr.Get(&value, time);
+    return value;
+}
+
+MayaUsd::TimeSampleCompactorOptions linearOptions(double tolerance)
+{
+    MayaUsd::TimeSampleCompactorOptions options;
+    options.linear = true;
+    options.tolerance = tolerance;
+    return options;
+}
+
+} // namespace
+
+TEST(TimeSampleCompactor, redundant)
+{
+    SdfTimeSampleMap samples = makeSamples({ 1, 1, 1, 2, 2, 2, 3, 4, 4 });
+    EXPECT_GT(MayaUsd::compactTimeSamples(samples), 0u);
+
+    // The ends of the constant runs are needed, whether the samples are held
+    // or interpolated, except before the first sample and after the last one.
+    EXPECT_EQ(std::vector<double>({ 3, 4, 6, 7, 8 }), sampleTimes(samples));
+
+    samples = makeSamples({ 1, 2, 3 });
+    EXPECT_EQ(0u, MayaUsd::compactTimeSamples(samples));
+    EXPECT_EQ(3u, samples.size());
+
+    samples = makeSamples({ 5, 5, 5, 5 });
+    MayaUsd::compactTimeSamples(samples);
+    EXPECT_EQ(1u, samples.size());
+}
+
+TEST(TimeSampleCompactor, tolerance)
+{
+    MayaUsd::TimeSampleCompactorOptions options;
+    options.tolerance = 0.125;
+
+    SdfTimeSampleMap samples = makeSamples({ 1.0, 1.0625, 0.9375, 1.0, 2.0 });
+    MayaUsd::compactTimeSamples(samples, options);
+    EXPECT_EQ(std::vector<double>({ 4, 5 }), sampleTimes(samples));
+
+    // A slow drift is reproduced within the tolerance, held or interpolated.
+    options.tolerance = 0.1;
+    const SdfTimeSampleMap drift = makeSamples({ 0.0, 0.08, 0.16, 0.24, 0.32 });
+    samples = drift;
+    MayaUsd::compactTimeSamples(samples, options);
+    EXPECT_LT(samples.size(), drift.size());
+    for (const auto& sample : drift) {
+        const double value = sample.second.Get<double>();
+        EXPECT_NEAR(value, evaluate(samples, sample.first, false), 0.1);
+        EXPECT_NEAR(value, evaluate(samples, sample.first, true), 0.1);
+    }
+}
+
+TEST(TimeSampleCompactor, linear)
+{
+    SdfTimeSampleMap samples = makeSamples({ 0, 1, 2, 3, 4, 4, 4, 2, 0 });
+    MayaUsd::compactTimeSamples(samples, linearOptions(0.0));
+    EXPECT_EQ(std::vector<double>({ 1, 5, 7, 9 }), sampleTimes(samples));
+
+    // Without the linear option, only the constant run is compacted.
+    samples = makeSamples({ 0, 1, 2, 3, 4, 4, 4, 2, 0 });
+    MayaUsd::compactTimeSamples(samples);
+    EXPECT_EQ(8u, samples.size());
+
+    // A noisy line within the tolerance.
+    std::vector<double> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i * 0.5 + (i % 2 ? 0.001 : -0.001));
+    }
+    samples = makeSamples(values);
+    MayaUsd::compactTimeSamples(samples, linearOptions(0.01));
+    EXPECT_EQ(2u, samples.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_NEAR(values[i], evaluate(samples, static_cast<double>(i + 1), true), 0.01);
+    }
+}
+
+TEST(TimeSampleCompactor, arraysAndOtherTypes)
+{
+    SdfTimeSampleMap samples;
+    samples[1.0] = VtValue(VtVec3fArray { GfVec3f(0.0f), GfVec3f(1.0f) });
+    samples[2.0] = VtValue(VtVec3fArray { GfVec3f(1.0f), GfVec3f(2.0f) });
+    samples[3.0] = VtValue(VtVec3fArray { GfVec3f(2.0f), GfVec3f(3.0f) });
+    samples[4.0] = VtValue(VtVec3fArray { GfVec3f(2.0f), GfVec3f(3.0f) });
+    SdfTimeSampleMap compacted = samples;
+    MayaUsd::compactTimeSamples(compacted, linearOptions(0.0));
+    EXPECT_EQ(std::vector<double>({ 1, 3 }), sampleTimes(compacted));
+
+    // Arrays changing size are compared for equality.
+    samples[5.0] = VtValue(VtVec3fArray { GfVec3f(2.0f) });
+    EXPECT_EQ(0u, MayaUsd::compactTimeSamples(samples, linearOptions(0.0)));
+
+    // Tokens are compared for equality, even with a tolerance.
+    samples.clear();
+    samples[1.0] = VtValue(TfToken("a"));
+    samples[2.0] = VtValue(TfToken("a"));
+    samples[3.0] = VtValue(TfToken("b"));
+    samples[4.0] = VtValue(TfToken("b"));
+    MayaUsd::compactTimeSamples(samples, linearOptions(1.0));
+    EXPECT_EQ(std::vector<double>({ 2, 3 }), sampleTimes(samples));
+
+    // NaN is never considered reproduced.
+    samples = makeSamples({ 1.0, std::nan(""), 1.0 });
+    MayaUsd::compactTimeSamples(samples, linearOptions(1.0));
+    EXPECT_EQ(3u, samples.size());
+}
+
+TEST(TimeSampleCompactor, layer)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim        prim = stage->DefinePrim(SdfPath("/A"));
+    UsdAttribute   animated = prim.CreateAttribute(TfToken("animated"), SdfValueTypeNames->Double);
+    UsdAttribute   constant = prim.CreateAttribute(TfToken("constant"), SdfValueTypeNames->Float3);
+    UsdAttribute   still = prim.CreateAttribute(TfToken("still"), SdfValueTypeNames->Int);
+    UsdAttribute   single = prim.CreateAttribute(TfToken("single"), SdfValueTypeNames->Int);
+    UsdAttribute   withDefault
+        = prim.CreateAttribute(TfToken("withDefault"), SdfValueTypeNames->Double);
+    for (int frame = 1; frame <= 100; ++frame) {
+        animated.Set(frame < 50 ? 0.0 : 1.0, frame);
+        constant.Set(GfVec3f(1.0f, 2.0f, 3.0f), frame);
+        withDefault.Set(2.0, frame);
+    }
+    still.Set(7);
+    single.Set(3, 10.0);
+    withDefault.Set(1.0);
+
+    // By default, the constant attributes keep a time sample.
+    MayaUsd::TimeSampleCompactorStats stats = MayaUsd::compactTimeSamples(stage->GetRootLayer());
+    EXPECT_EQ(4u, stats.attributes);
+    EXPECT_EQ(98u + 99u + 99u, stats.removedSamples);
+    EXPECT_EQ(0u, stats.collapsedAttributes);
+    EXPECT_EQ(1u, constant.GetNumTimeSamples());
+    EXPECT_FALSE(stage->GetRootLayer()->HasField(constant.GetPath(), SdfFieldKeys->Default));
+
+    // Collapsing them only replaces the samples of the attributes which had more
+    // than one sample and no default value.
+    for (int frame = 1; frame <= 100; ++frame) {
+        constant.Set(GfVec3f(1.0f, 2.0f, 3.0f), frame);
+        withDefault.Set(2.0, frame);
+    }
+    MayaUsd::TimeSampleCompactorOptions options;
+    options.collapseConstant = true;
+    stats = MayaUsd::compactTimeSamples(stage->GetRootLayer(), options);
+    EXPECT_EQ(4u, stats.attributes);
+    EXPECT_EQ(99u + 99u, stats.removedSamples);
+    EXPECT_EQ(1u, stats.collapsedAttributes);
+    EXPECT_GT(stats.bytesSaved, (99u + 99u) * sizeof(double));
+
+    EXPECT_EQ(2u, animated.GetNumTimeSamples());
+    EXPECT_EQ(0.0, getDouble(animated, 25.0));
+    EXPECT_EQ(0.0, getDouble(animated, 49.0));
+    EXPECT_EQ(1.0, getDouble(animated, 50.0));
+
+    EXPECT_EQ(0u, constant.GetNumTimeSamples());
+    GfVec3f value;
+    EXPECT_TRUE(constant.Get(&value, UsdTimeCode(42.0)));
+    EXPECT_EQ(GfVec3f(1.0f, 2.0f, 3.0f), value);
+
+    int stillValue = 0;
+    EXPECT_TRUE(still.Get(&stillValue));
+    EXPECT_EQ(7, stillValue);
+
+    // A single time sample is kept as authored.
+    EXPECT_EQ(1u, single.GetNumTimeSamples());
+    EXPECT_FALSE(stage->GetRootLayer()->HasField(single.GetPath(), SdfFieldKeys->Default));
+
+    // An authored default value is never overwritten.
+    EXPECT_EQ(1u, withDefault.GetNumTimeSamples());
+    EXPECT_EQ(2.0, getDouble(withDefault, 42.0));
+    EXPECT_EQ(
+        VtValue(1.0),
+        stage->GetRootLayer()->GetField(withDefault.GetPath(), SdfFieldKeys->Default));
+}
@@ -0,0 +1,355 @@
+#include <mayaUsd/utils/traverseLayer.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/sdf/relationshipSpec.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/sdf/variantSetSpec.h>
+#include <pxr/usd/sdf/variantSpec.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// The recursive traversal that traverseLayer() replaced. It walks the children
+// fields listed by each spec, independently of the iterative traversal, so the
+// paths it visits are the expected results of the tests below.
+void referenceTraverse(
+    const SdfLayerHandle&           layer,
+    const SdfPath&                  path,
+    std::set<SdfPath>&              traversed,
+    const MayaUsd::TraverseLayerFn& fn);
+
+template <typename ChildPolicy>
+void referenceTraverseChildren(
+    const SdfLayerHandle&           layer,
+    const SdfPath&                  path,
+    std::set<SdfPath>&              traversed,
+    const MayaUsd::TraverseLayerFn& fn)
+{
+    std::vector<typename ChildPolicy::FieldType> children
+        = layer->GetFieldAs<std::vector<typename ChildPolicy::FieldType>>(
+            path, ChildPolicy::GetChildrenToken(path));
+
+    for (const auto& child : children) {
+        referenceTraverse(layer, ChildPolicy::GetChildPath(path, child), traversed, fn);
+    }
+}
+
+void referenceTraverse(
+    const SdfLayerHandle&           layer,
+    const SdfPath&                  path,
+    std::set<SdfPath>&              traversed,
+    const MayaUsd::TraverseLayerFn& fn)
+{
+    if (!traversed.insert(path).second)
+        return;
+
+    if (!fn(path))
+        return;
+
+    auto specHandle = layer->GetObjectAtPath(path);
+    if (!specHandle)
+        return;
+
+    for (const TfToken& field : specHandle->ListFields()) {
+        if (field == SdfChildrenKeys->PrimChildren) {
+            referenceTraverseChildren<Sdf_PrimChildPolicy>(layer, path, traversed, fn);
+        } else if (field == SdfChildrenKeys->PropertyChildren) {
+            referenceTraverseChildren<Sdf_PropertyChildPolicy>(layer, path, traversed, fn);
+        } else if (field == SdfChildrenKeys->VariantChildren) {
+            referenceTraverseChildren<Sdf_VariantChildPolicy>(layer, path, traversed, fn);
+        } else if (field == SdfChildrenKeys->VariantSetChildren) {
+            referenceTraverseChildren<Sdf_VariantSetChildPolicy>(layer, path, traversed, fn);
+        } else if (field == SdfChildrenKeys->MapperChildren) {
+            referenceTraverseChildren<Sdf_MapperChildPolicy>(layer, path, traversed, fn);
+        } else if (field == SdfChildrenKeys->MapperArgChildren) {
+            referenceTraverseChildren<Sdf_MapperArgChildPolicy>(layer, path, traversed, fn);
+        } else if (field == SdfChildrenKeys->ConnectionChildren) {
+            referenceTraverseChildren<Sdf_AttributeConnectionChildPolicy>(
+                layer, path, traversed, fn);
+        } else if (field == SdfChildrenKeys->RelationshipTargetChildren) {
+            referenceTraverseChildren<Sdf_RelationshipTargetChildPolicy>(
+                layer, path, traversed, fn);
+        } else if (field == SdfChildrenKeys->ExpressionChildren) {
+            referenceTraverseChildren<Sdf_ExpressionChildPolicy>(layer, path, traversed, fn);
+        }
+    }
+}
+
+// Create a layer with the given number of prims, each with a variant set,
+// a relationship with a target and attributes, one of them connected.
+SdfLayerRefPtr createLayer(int primCount, int attrCount)
+{
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous();
+    SdfChangeBlock changeBlock;
+
+    SdfPrimSpecHandle root = SdfPrimSpec::New(layer, "root", SdfSpecifierDef);
+    SdfPrimSpecHandle group;
+    for (int i = 0; i < primCount; ++i) {
+        if (i % 100 == 0)
+            group = SdfPrimSpec::New(root, TfStringPrintf("group%d", i / 100), SdfSpecifierDef);
+
+        SdfPrimSpecHandle prim
+            = SdfPrimSpec::New(group, TfStringPrintf("prim%d", i), SdfSpecifierDef, "Xform");
+
+        SdfVariantSetSpecHandle variantSet = SdfVariantSetSpec::New(prim, "look");
+        SdfVariantSpecHandle    variant = SdfVariantSpec::New(variantSet, "red");
+        SdfPrimSpec::New(variant->GetPrimSpec(), "inVariant", SdfSpecifierDef);
+
+        SdfRelationshipSpecHandle rel = SdfRelationshipSpec::New(prim, "rel");
+        rel->GetTargetPathList().Add(root->GetPath());
+
+        for (int j = 0; j < attrCount; ++j) {
+            SdfAttributeSpecHandle attr = SdfAttributeSpec::New(
+                prim, TfStringPrintf("attr%d", j), SdfValueTypeNames->Float);
+            if (j == 0)
+                attr->GetConnectionPathList().Add(root->GetPath().AppendProperty(TfToken("out")));
+        }
+    }
+    return layer;
+}
+
+std::set<SdfPath> referencePaths(const SdfLayerHandle& layer, const SdfPath& root)
+{
+    std::set<SdfPath> paths;
+    std::set<SdfPath> traversed;
+    referenceTraverse(layer, root, traversed, [&paths](const SdfPath& path) {
+        paths.insert(path);
+        return true;
+    });
+    return paths;
+}
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST(TraverseLayer, visitOrder)
+{
+    SdfLayerRefPtr layer = createLayer(2, 2);
+
+    // Child prims first, then variant sets, then properties.
+    const std::vector<std::string> expected = {
+        "/",
+        "/root",
+        "/root/group0",
+        "/root/group0/prim0",
+        "/root/group0/prim0{look=}",
+        "/root/group0/prim0{look=red}",
+        "/root/group0/prim0{look=red}inVariant",
+        "/root/group0/prim0.rel",
+        "/root/group0/prim0.rel[/root]",
+        "/root/group0/prim0.attr0",
+        "/root/group0/prim0.attr0[/root.out]",
+        "/root/group0/prim0.attr1",
+        "/root/group0/prim1",
+        "/root/group0/prim1{look=}",
+        "/root/group0/prim1{look=red}",
+        "/root/group0/prim1{look=red}inVariant",
+        "/root/group0/prim1.rel",
+        "/root/group0/prim1.rel[/root]",
+        "/root/group0/prim1.attr0",
+        "/root/group0/prim1.attr0[/root.out]",
+        "/root/group0/prim1.attr1",
+    };
+
+    std::vector<std::string> visited;
+    EXPECT_TRUE(MayaUsd::traverseLayer(
+        layer, SdfPath::AbsoluteRootPath(), [&visited](const SdfPath& path) {
+            visited.push_back(path.GetString());
+            return true;
+        }));
+    EXPECT_EQ(visited, expected);
+
+    std::vector<std::string> visitedSpecs;
+    EXPECT_TRUE(MayaUsd::traverseLayerSpecs(
+        layer, SdfPath::AbsoluteRootPath(), [&visitedSpecs](const SdfPath& path, SdfSpecType) {
+            visitedSpecs.push_back(path.GetString());
+            return true;
+        }));
+    EXPECT_EQ(visitedSpecs, expected);
+
+    // The former traversal visited the same specs.
+    const std::set<SdfPath> referenceSet = referencePaths(layer, SdfPath::AbsoluteRootPath());
+    EXPECT_EQ(referenceSet.size(), expected.size());
+    for (const std::string& path : expected) {
+        EXPECT_TRUE(referenceSet.count(SdfPath(path))) << path;
+    }
+}
+
+TEST(TraverseLayer, visitsAllSpecs)
+{
+    SdfLayerRefPtr layer = createLayer(250, 3);
+
+    const std::set<SdfPath> expected = referencePaths(layer, SdfPath::AbsoluteRootPath());
+
+    std::vector<SdfPath> visited;
+    EXPECT_TRUE(MayaUsd::traverseLayer(
+        layer, SdfPath::AbsoluteRootPath(), [&visited](const SdfPath& path) {
+            visited.push_back(path);
+            return true;
+        }));
+
+    // Every spec is visited exactly once.
+    EXPECT_EQ(visited.size(), expected.size());
+    EXPECT_EQ(std::set<SdfPath>(visited.begin(), visited.end()), expected);
+
+    // Parents are visited before their children.
+    std::set<SdfPath> seen;
+    for (const SdfPath& path : visited) {
+        if (!path.IsAbsoluteRootPath()) {
+            EXPECT_TRUE(seen.count(path.GetParentPath())) << path.GetString();
+        }
+        seen.insert(path);
+    }
+}
+
+TEST(TraverseLayer, parallelVisitsAllSpecs)
+{
+    SdfLayerRefPtr layer = createLayer(250, 3);
+
+    const std::set<SdfPath> expected = referencePaths(layer, SdfPath::AbsoluteRootPath());
+
+    std::mutex                     mutex;
+    std::map<SdfPath, SdfSpecType> visited;
+    EXPECT_TRUE(MayaUsd::traverseLayerSpecs(
+        layer,
+        SdfPath::AbsoluteRootPath(),
+        [&mutex, &visited](const SdfPath& path, SdfSpecType specType) {
+            std::lock_guard<std::mutex> lock(mutex);
+            EXPECT_TRUE(visited.emplace(path, specType).second) << path.GetString();
+            return true;
+        },
+        true));
+
+    EXPECT_EQ(visited.size(), expected.size());
+    for (const auto& pathAndType : visited) {
+        EXPECT_TRUE(expected.count(pathAndType.first)) << pathAndType.first.GetString();
+        EXPECT_EQ(pathAndType.second, layer->GetSpecType(pathAndType.first));
+    }
+}
+
+TEST(TraverseLayer, prune)
+{
+    SdfLayerRefPtr layer = createLayer(250, 3);
+    const SdfPath  pruned("/root/group1");
+
+    for (bool parallel : { false, true }) {
+        std::atomic<size_t> count { 0 };
+        EXPECT_TRUE(MayaUsd::traverseLayerSpecs(
+            layer,
+            SdfPath::AbsoluteRootPath(),
+            [&pruned, &count](const SdfPath& path, SdfSpecType) {
+                EXPECT_FALSE(path.HasPrefix(pruned) && path != pruned) << path.GetString();
+                ++count;
+                return path != pruned;
+            },
+            parallel));
+
+        size_t expected = 0;
+        for (const SdfPath& path : referencePaths(layer, SdfPath::AbsoluteRootPath())) {
+            if (!path.HasPrefix(pruned) || path == pruned)
+                ++expected;
+        }
+        EXPECT_EQ(count.load(), expected);
+    }
+}
+
+TEST(TraverseLayer, failure)
+{
+    SdfLayerRefPtr layer = createLayer(250, 3);
+    const SdfPath  failing("/root/group1/prim150");
+
+    for (bool parallel : { false, true }) {
+        EXPECT_FALSE(MayaUsd::traverseLayerSpecs(
+            layer,
+            SdfPath::AbsoluteRootPath(),
+            [&failing](const SdfPath& path, SdfSpecType) {
+                if (path == failing)
+                    throw MayaUsd::TraversalFailure("Expected failure", path);
+                return true;
+            },
+            parallel));
+    }
+}
+
+// Times the recursive, iterative and parallel traversals of a layer with about
+// a million specs. It is too slow for the unit test suite, so it only runs when
+// requested with --gtest_also_run_disabled_tests, and it reports the times as
+// test properties, written with --gtest_output=xml.
+TEST(TraverseLayer, DISABLED_benchmark)
+{
+    // 100,000 prims with 10 specs each gives about a million specs.
+    SdfLayerRefPtr layer = createLayer(100000, 3);
+
+    std::vector<SdfPath> referenceVisited;
+    auto                 start = std::chrono::steady_clock::now();
+    {
+        std::set<SdfPath> traversed;
+        referenceTraverse(
+            layer,
+            SdfPath::AbsoluteRootPath(),
+            traversed,
+            [&referenceVisited](const SdfPath& path) {
+                referenceVisited.push_back(path);
+                return true;
+            });
+    }
+    const double referenceTime = secondsSince(start);
+
+    std::vector<SdfPath> visited;
+    visited.reserve(referenceVisited.size());
+    start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(MayaUsd::traverseLayer(
+        layer, SdfPath::AbsoluteRootPath(), [&visited](const SdfPath& path) {
+            visited.push_back(path);
+            return true;
+        }));
+    const double sequentialTime = secondsSince(start);
+
+    std::mutex           mutex;
+    std::vector<SdfPath> parallelVisited;
+    parallelVisited.reserve(referenceVisited.size());
+    start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(MayaUsd::traverseLayerSpecs(
+        layer,
+        SdfPath::AbsoluteRootPath(),
+        [&mutex, &parallelVisited](const SdfPath& path, SdfSpecType) {
+            std::lock_guard<std::mutex> lock(mutex);
+            parallelVisited.push_back(path);
+            return true;
+        },
+        true));
+    const double parallelTime = secondsSince(start);
+
+    // All the traversals visit the same specs, each exactly once.
+    const std::set<SdfPath> referenceSet(referenceVisited.begin(), referenceVisited.end());
+    EXPECT_GE(referenceSet.size(), 1000000u);
+    EXPECT_EQ(referenceSet.size(), referenceVisited.size());
+    EXPECT_EQ(visited.size(), referenceVisited.size());
+    EXPECT_EQ(std::set<SdfPath>(visited.begin(), visited.end()), referenceSet);
+    EXPECT_EQ(parallelVisited.size(), referenceVisited.size());
+    EXPECT_EQ(std::set<SdfPath>(parallelVisited.begin(), parallelVisited.end()), referenceSet);
+
+    ::testing::Test::RecordProperty("specs", static_cast<int>(referenceVisited.size()));
+    ::testing::Test::RecordProperty("recursiveSeconds", TfStringPrintf("%.3f", referenceTime));
+    ::testing::Test::RecordProperty("iterativeSeconds", TfStringPrintf("%.3f", sequentialTime));
+    ::testing::Test::RecordProperty("parallelSeconds", TfStringPrintf("%.3f", parallelTime));
+}
@@ -0,0 +1,367 @@
+#include <mayaUsd/render/vp2RenderDelegate/instancer.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/imaging/hd/changeTracker.h>
+#include <pxr/imaging/hd/renderDelegate.h>
+#include <pxr/imaging/hd/renderIndex.h>
+#include <pxr/imaging/hd/renderPass.h>
+#include <pxr/imaging/hd/resourceRegistry.h>
+#include <pxr/imaging/hd/rprimCollection.h>
+#include <pxr/imaging/hd/sceneDelegate.h>
+#include <pxr/imaging/hd/tokens.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+const TfToken& translationsToken()
+{
+#if HD_API_VERSION < 56
+    return HdInstancerTokens->translate;
+#else
+    return HdInstancerTokens->instanceTranslations;
+#endif
+}
+
+// Render delegate only creating VP2 instancers.
+class TestRenderDelegate : public HdRenderDelegate
+{
+public:
+    const TfTokenVector& GetSupportedRprimTypes() const override { return _noTypes; }
+    const TfTokenVector& GetSupportedSprimTypes() const override { return _noTypes; }
+    const TfTokenVector& GetSupportedBprimTypes() const override { return _noTypes; }
+
+    HdResourceRegistrySharedPtr GetResourceRegistry() const override { return _resourceRegistry; }
+
+    HdRenderPassSharedPtr CreateRenderPass(HdRenderIndex*, HdRprimCollection const&) override
+    {
+        return nullptr;
+    }
+
+#if defined(HD_API_VERSION) && HD_API_VERSION >= 36
+    HdInstancer* CreateInstancer(HdSceneDelegate* delegate, SdfPath const& id) override
+    {
+        return new HdVP2Instancer(delegate, id);
+    }
+#else
+    HdInstancer* CreateInstancer(
+        HdSceneDelegate* delegate,
+        SdfPath const&   id,
+        SdfPath const&   instancerId) override
+    {
+        return new HdVP2Instancer(delegate, id, instancerId);
+    }
+#endif
+    void DestroyInstancer(HdInstancer* instancer) override { delete instancer; }
+
+#if defined(HD_API_VERSION) && HD_API_VERSION >= 36
+    HdRprim* CreateRprim(TfToken const&, SdfPath const&) override { return nullptr; }
+#else
+    HdRprim* CreateRprim(TfToken const&, SdfPath const&, SdfPath const&) override
+    {
+        return nullptr;
+    }
+#endif
+    void DestroyRprim(HdRprim*) override { }
+
+    HdSprim* CreateSprim(TfToken const&, SdfPath const&) override { return nullptr; }
+    HdSprim* CreateFallbackSprim(TfToken const&) override { return nullptr; }
+    void     DestroySprim(HdSprim*) override { }
+
+    HdBprim* CreateBprim(TfToken const&, SdfPath const&) override { return nullptr; }
+    HdBprim* CreateFallbackBprim(TfToken const&) override { return nullptr; }
+    void     DestroyBprim(HdBprim*) override { }
+
+    void CommitResources(HdChangeTracker*) override { }
+
+private:
+    TfTokenVector               _noTypes;
+    HdResourceRegistrySharedPtr _resourceRegistry = std::make_shared<HdResourceRegistry>();
+};
+
+// Scene delegate providing instancers translating their instances.
+class TestSceneDelegate : public HdSceneDelegate
+{
+public:
+    struct Instancer
+    {
+        SdfPath                       parentId;
+        SdfPathVector                 prototypes;
+        std::map<SdfPath, VtIntArray> instanceIndices;
+        VtVec3fArray                  translations;
+        VtVec3fArray                  colors;
+    };
+
+    explicit TestSceneDelegate(HdRenderIndex* renderIndex)
+        : HdSceneDelegate(renderIndex, SdfPath::AbsoluteRootPath())
+    {
+    }
+
+    std::map<SdfPath, Instancer> instancers;
+    int                          instancerTransformQueries = 0;
+
+    SdfPathVector GetInstancerPrototypes(SdfPath const& instancerId) override
+    {
+        const Instancer* instancer = find(instancerId);
+        return instancer ? instancer->prototypes : SdfPathVector();
+    }
+
+    VtIntArray GetInstanceIndices(SdfPath const& instancerId, SdfPath const& prototypeId) override
+    {
+        const Instancer* instancer = find(instancerId);
+        if (!instancer) {
+            return {};
+        }
+        auto it = instancer->instanceIndices.find(prototypeId);
+        return it != instancer->instanceIndices.end() ? it->second : VtIntArray();
+    }
+
+    SdfPath GetInstancerId(SdfPath const& primId) override
+    {
+        const Instancer* instancer = find(primId);
+        return instancer ? instancer->parentId : SdfPath();
+    }
+
+    // Queried each time the instancer recomputes its instance transforms.
+    GfMatrix4d GetInstancerTransform(SdfPath const&) override
+    {
+        ++instancerTransformQueries;
+        return GfMatrix4d(1.0);
+    }
+
+    HdPrimvarDescriptorVector
+    GetPrimvarDescriptors(SdfPath const&, HdInterpolation interpolation) override
+    {
+        if (interpolation != HdInterpolationInstance) {
+            return {};
+        }
+        return { HdPrimvarDescriptor(
+                     translationsToken(), HdInterpolationInstance, HdPrimvarRoleTokens->vector),
+                 HdPrimvarDescriptor(
+                     HdTokens->displayColor, HdInterpolationInstance, HdPrimvarRoleTokens->color) };
+    }
+
+    VtValue Get(SdfPath const& id, TfToken const& key) override
+    {
+        const Instancer* instancer = find(id);
+        if (!instancer) {
+            return {};
+        }
+        if (key == translationsToken()) {
+            return VtValue(instancer->translations);
+        }
+        if (key == HdTokens->displayColor && !instancer->colors.empty()) {
+            return VtValue(instancer->colors);
+        }
+        return {};
+    }
+
+private:
+    const Instancer* find(const SdfPath& id) const
+    {
+        auto it = instancers.find(id);
+        return it != instancers.end() ? &it->second : nullptr;
+    }
+};
+
+// Render index with the instancers of a test scene delegate.
+class TestScene
+{
+public:
+    TestScene()
+        : _renderIndex(HdRenderIndex::New(&_renderDelegate, HdDriverVector()))
+        , _sceneDelegate(std::make_unique<TestSceneDelegate>(_renderIndex.get()))
+    {
+    }
+
+    const TestSceneDelegate& sceneDelegate() const { return *_sceneDelegate; }
+
+    TestSceneDelegate::Instancer& addInstancer(const SdfPath& id, const SdfPath& parentId)
+    {
+        TestSceneDelegate::Instancer& instancer = _sceneDelegate->instancers[id];
+        instancer.parentId = parentId;
+#if defined(HD_API_VERSION) && HD_API_VERSION >= 36
+        _renderIndex->InsertInstancer(_sceneDelegate.get(), id);
+#else
+        _renderIndex->InsertInstancer(_sceneDelegate.get(), id, parentId);
+#endif
+        return instancer;
+    }
+
+    void markDirty(const SdfPath& id, HdDirtyBits dirtyBits)
+    {
+        _renderIndex->GetChangeTracker().MarkInstancerDirty(id, dirtyBits);
+    }
+
+    VtMatrix4dArray transforms(const SdfPath& instancerId, const SdfPath& prototypeId)
+    {
+        return static_cast<HdVP2Instancer*>(_renderIndex->GetInstancer(instancerId))
+            ->GetInstanceTransforms(prototypeId);
+    }
+
+private:
+    TestRenderDelegate                 _renderDelegate;
+    std::unique_ptr<HdRenderIndex>     _renderIndex;
+    std::unique_ptr<TestSceneDelegate> _sceneDelegate;
+};
+
+void expectTranslations(const VtMatrix4dArray& transforms, const std::vector<GfVec3d>& expected)
+{
+    ASSERT_EQ(transforms.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(transforms[i].ExtractTranslation(), expected[i]) << "instance " << i;
+    }
+}
+
+} // namespace
+
+TEST(VP2Instancer, instanceTransforms)
+{
+    const SdfPath instancerId("/Instancer");
+    const SdfPath prototypeA("/Instancer/A");
+    const SdfPath prototypeB("/Instancer/B");
+
+    TestScene                     scene;
+    TestSceneDelegate::Instancer& instancer = scene.addInstancer(instancerId, SdfPath());
+    instancer.prototypes = { prototypeA, prototypeB };
+    instancer.instanceIndices[prototypeA] = VtIntArray { 0, 2 };
+    instancer.instanceIndices[prototypeB] = VtIntArray { 1 };
+    instancer.translations = VtVec3fArray { GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(2, 0, 0) };
+
+    VtMatrix4dArray transformsA = scene.transforms(instancerId, prototypeA);
+    VtMatrix4dArray transformsB = scene.transforms(instancerId, prototypeB);
+    expectTranslations(transformsA, { GfVec3d(0, 0, 0), GfVec3d(2, 0, 0) });
+    expectTranslations(transformsB, { GfVec3d(1, 0, 0) });
+
+    // Nothing changed, the cached transforms are returned.
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeA).IsIdentical(transformsA));
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeB).IsIdentical(transformsB));
+
+    // Changing the transform of an instance of B leaves the transforms of A untouched.
+    instancer.translations[1] = GfVec3f(1, 1, 0);
+    scene.markDirty(instancerId, HdChangeTracker::DirtyPrimvar);
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeA).IsIdentical(transformsA));
+    transformsB = scene.transforms(instancerId, prototypeB);
+    expectTranslations(transformsB, { GfVec3d(1, 1, 0) });
+
+    instancer.translations[2] = GfVec3f(2, 2, 0);
+    scene.markDirty(instancerId, HdChangeTracker::DirtyPrimvar);
+    transformsA = scene.transforms(instancerId, prototypeA);
+    expectTranslations(transformsA, { GfVec3d(0, 0, 0), GfVec3d(2, 2, 0) });
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeB).IsIdentical(transformsB));
+
+    // Dirty bits not affecting the transforms keep the cached transforms.
+    scene.markDirty(instancerId, HdChangeTracker::DirtyVisibility);
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeA).IsIdentical(transformsA));
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeB).IsIdentical(transformsB));
+
+    // Changing only the colors does not recompute the instance transforms, although the
+    // primvars are dirty.
+    const int transformQueries = scene.sceneDelegate().instancerTransformQueries;
+    instancer.colors = VtVec3fArray { GfVec3f(1, 0, 0), GfVec3f(0, 1, 0), GfVec3f(0, 0, 1) };
+    scene.markDirty(instancerId, HdChangeTracker::DirtyPrimvar);
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeA).IsIdentical(transformsA));
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeB).IsIdentical(transformsB));
+    EXPECT_EQ(transformQueries, scene.sceneDelegate().instancerTransformQueries);
+
+    // Adding an instance.
+    instancer.instanceIndices[prototypeA] = VtIntArray { 0, 2, 3 };
+    instancer.translations.push_back(GfVec3f(3, 0, 0));
+    scene.markDirty(
+        instancerId, HdChangeTracker::DirtyInstanceIndex | HdChangeTracker::DirtyPrimvar);
+    transformsA = scene.transforms(instancerId, prototypeA);
+    expectTranslations(transformsA, { GfVec3d(0, 0, 0), GfVec3d(2, 2, 0), GfVec3d(3, 0, 0) });
+    expectTranslations(scene.transforms(instancerId, prototypeB), { GfVec3d(1, 1, 0) });
+
+    // Moving an instance from a prototype to the other.
+    instancer.instanceIndices[prototypeA] = VtIntArray { 0, 3 };
+    instancer.instanceIndices[prototypeB] = VtIntArray { 1, 2 };
+    scene.markDirty(instancerId, HdChangeTracker::DirtyInstanceIndex);
+    expectTranslations(
+        scene.transforms(instancerId, prototypeA), { GfVec3d(0, 0, 0), GfVec3d(3, 0, 0) });
+    expectTranslations(
+        scene.transforms(instancerId, prototypeB), { GfVec3d(1, 1, 0), GfVec3d(2, 2, 0) });
+
+    // Removing a prototype.
+    instancer.prototypes = { prototypeA };
+    instancer.instanceIndices.erase(prototypeB);
+    scene.markDirty(instancerId, HdChangeTracker::DirtyInstanceIndex);
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeB).empty());
+    expectTranslations(
+        scene.transforms(instancerId, prototypeA), { GfVec3d(0, 0, 0), GfVec3d(3, 0, 0) });
+}
+
+TEST(VP2Instancer, nestedInstanceTransforms)
+{
+    const SdfPath parentId("/Parent");
+    const SdfPath instancerId("/Parent/Instancer");
+    const SdfPath prototypeId("/Parent/Instancer/A");
+
+    TestScene                     scene;
+    TestSceneDelegate::Instancer& parent = scene.addInstancer(parentId, SdfPath());
+    parent.prototypes = { instancerId };
+    parent.instanceIndices[instancerId] = VtIntArray { 0, 1 };
+    parent.translations = VtVec3fArray { GfVec3f(10, 0, 0), GfVec3f(20, 0, 0) };
+
+    TestSceneDelegate::Instancer& instancer = scene.addInstancer(instancerId, parentId);
+    instancer.prototypes = { prototypeId };
+    instancer.instanceIndices[prototypeId] = VtIntArray { 0, 1, 2 };
+    instancer.translations = VtVec3fArray { GfVec3f(1, 0, 0), GfVec3f(2, 0, 0), GfVec3f(3, 0, 0) };
+
+    VtMatrix4dArray transforms = scene.transforms(instancerId, prototypeId);
+    expectTranslations(
+        transforms,
+        { GfVec3d(11, 0, 0),
+          GfVec3d(12, 0, 0),
+          GfVec3d(13, 0, 0),
+          GfVec3d(21, 0, 0),
+          GfVec3d(22, 0, 0),
+          GfVec3d(23, 0, 0) });
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeId).IsIdentical(transforms));
+
+    // Changing a parent transform.
+    parent.translations[1] = GfVec3f(30, 0, 0);
+    scene.markDirty(parentId, HdChangeTracker::DirtyPrimvar);
+    transforms = scene.transforms(instancerId, prototypeId);
+    expectTranslations(
+        transforms,
+        { GfVec3d(11, 0, 0),
+          GfVec3d(12, 0, 0),
+          GfVec3d(13, 0, 0),
+          GfVec3d(31, 0, 0),
+          GfVec3d(32, 0, 0),
+          GfVec3d(33, 0, 0) });
+
+    // Changing an instance transform.
+    instancer.translations[0] = GfVec3f(0, 1, 0);
+    scene.markDirty(instancerId, HdChangeTracker::DirtyPrimvar);
+    transforms = scene.transforms(instancerId, prototypeId);
+    expectTranslations(
+        transforms,
+        { GfVec3d(10, 1, 0),
+          GfVec3d(12, 0, 0),
+          GfVec3d(13, 0, 0),
+          GfVec3d(30, 1, 0),
+          GfVec3d(32, 0, 0),
+          GfVec3d(33, 0, 0) });
+
+    // Dirty bits not affecting the transforms keep the cached transforms.
+    scene.markDirty(parentId, HdChangeTracker::DirtyVisibility);
+    scene.markDirty(instancerId, HdChangeTracker::DirtyVisibility);
+    EXPECT_TRUE(scene.transforms(instancerId, prototypeId).IsIdentical(transforms));
+
+    // Removing a parent instance.
+    parent.instanceIndices[instancerId] = VtIntArray { 1 };
+    scene.markDirty(parentId, HdChangeTracker::DirtyInstanceIndex);
+    expectTranslations(
+        scene.transforms(instancerId, prototypeId),
+        { GfVec3d(30, 1, 0), GfVec3d(32, 0, 0), GfVec3d(33, 0, 0) });
+}
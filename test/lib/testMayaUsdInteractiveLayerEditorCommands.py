@@ -220,6 +220,139 @@ class MayaUsdInteractiveLayerEditorCommandsTestCase(unittest.TestCase):
         capsuleItem = ufe.Hierarchy.createItem(capsulePath)
         self.assertIsNone(capsuleItem)
 
+    def testIncrementalUpdateOfManySublayers(self):
+        """Edit a stage with a large sublayer stack and verify that the Layer Editor
+        only touches the rows of the sublayers affected by each change."""
+        import mayaUsd_createStageWithNewLayer
+        from pxr import Sdf
+        try:
+            from PySide6.QtWidgets import QApplication, QTreeView
+        except ImportError:
+            from PySide2.QtWidgets import QApplication, QTreeView
+
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsdLib.GetPrim(proxyShape).GetStage()
+        rootLayer = stage.GetRootLayer()
+
+        numSubLayers = 500
+        subLayers = [Sdf.Layer.CreateAnonymous('sub%d' % i) for i in range(numSubLayers)]
+        with Sdf.ChangeBlock():
+            rootLayer.subLayerPaths = [layer.identifier for layer in subLayers]
+
+        cmds.mayaUsdLayerEditorWindow('mayaUsdLayerEditor', proxyShape=proxyShape)
+
+        def processEvents():
+            # The Layer Editor applies USD changes on the next Qt event-loop turn.
+            QApplication.processEvents()
+            cmds.refresh()
+
+        processEvents()
+        models = [widget.model() for widget in QApplication.allWidgets()
+                  if isinstance(widget, QTreeView) and widget.model() is not None
+                  and widget.model().metaObject().className() == 'UsdLayerEditor::LayerTreeModel']
+        self.assertEqual(1, len(models))
+        model = models[0]
+
+        def rootLayerIndex():
+            # The root layer is always the last row, after the session layer when it is shown.
+            return model.index(model.rowCount() - 1, 0)
+
+        # Record the changes the model reports, as (parent row, first row, last row) tuples,
+        # where the parent row is None for the top-level rows.
+        changes = {'inserted': [], 'removed': [], 'dataChanged': [], 'reset': 0}
+
+        def parentRow(parent):
+            return parent.row() if parent.isValid() else None
+
+        def onRowsInserted(parent, first, last):
+            changes['inserted'].append((parentRow(parent), first, last))
+
+        def onRowsRemoved(parent, first, last):
+            changes['removed'].append((parentRow(parent), first, last))
+
+        def onDataChanged(topLeft, bottomRight, roles=None):
+            changes['dataChanged'].append((parentRow(topLeft.parent()), topLeft.row(), bottomRight.row()))
+
+        def onReset():
+            changes['reset'] += 1
+
+        model.rowsInserted.connect(onRowsInserted)
+        model.rowsRemoved.connect(onRowsRemoved)
+        model.dataChanged.connect(onDataChanged)
+        model.modelReset.connect(onReset)
+        model.layoutChanged.connect(onReset)
+
+        def clearChanges():
+            changes['inserted'] = []
+            changes['removed'] = []
+            changes['dataChanged'] = []
+            changes['reset'] = 0
+
+        def shownSubLayers():
+            rootIndex = rootLayerIndex()
+            return [model.index(row, 0, rootIndex).data() for row in range(model.rowCount(rootIndex))]
+
+        def verifyUpdate(layers, inserted=(), removed=(), dataChangedRows=()):
+            """Verify the sublayers shown after the update, and that the model inserted
+            and removed the given sublayer rows, and only changed the data of the
+            given sublayer rows or of the root layer, without ever being reset."""
+            processEvents()
+            self.assertEqual([layer.GetDisplayName() for layer in layers], shownSubLayers())
+
+            rootRow = rootLayerIndex().row()
+            self.assertEqual(0, changes['reset'])
+            self.assertEqual([(rootRow, first, last) for first, last in inserted], changes['inserted'])
+            self.assertEqual([(rootRow, first, last) for first, last in removed], changes['removed'])
+            for parent, first, last in changes['dataChanged']:
+                if parent is None:
+                    self.assertEqual((rootRow, rootRow), (first, last))
+                else:
+                    self.assertEqual(rootRow, parent)
+                    self.assertEqual(first, last)
+                    self.assertIn(first, dataChangedRows)
+            clearChanges()
+
+        def selectLayerAndVerify(layerId):
+            cmds.mayaUsdLayerEditorWindow('mayaUsdLayerEditor', edit=True, setSelectedLayers=layerId)
+            selLayers = cmds.mayaUsdLayerEditorWindow('mayaUsdLayerEditor', query=True, getSelectedLayers=True)
+            self.assertEqual([layerId], selLayers)
+            processEvents()
+            clearChanges()
+
+        self.assertEqual([layer.GetDisplayName() for layer in subLayers], shownSubLayers())
+
+        numEdits = 20
+        insertRow = numSubLayers // 2
+        for i in range(numEdits):
+            # Content edit, which only changes the data of the edited sublayer.
+            Sdf.CreatePrimInLayer(subLayers[i], '/Prim%d' % i)
+            verifyUpdate(subLayers, dataChangedRows=[i])
+
+            # Sublayer insertion in the middle of the stack.
+            newLayer = Sdf.Layer.CreateAnonymous('new%d' % i)
+            rootLayer.subLayerPaths.insert(insertRow, newLayer.identifier)
+            verifyUpdate(
+                subLayers[:insertRow] + [newLayer] + subLayers[insertRow:],
+                inserted=[(insertRow, insertRow)],
+                dataChangedRows=[insertRow])
+            selectLayerAndVerify(newLayer.identifier)
+
+            # Sublayer removal.
+            rootLayer.subLayerPaths.remove(newLayer.identifier)
+            verifyUpdate(subLayers, removed=[(insertRow, insertRow)])
+
+        # Sublayer move from the top to the bottom of the stack: no row is kept in place,
+        # so all the rows are replaced at once.
+        reordered = subLayers[1:] + subLayers[:1]
+        rootLayer.subLayerPaths = [layer.identifier for layer in reordered]
+        verifyUpdate(
+            reordered,
+            inserted=[(0, numSubLayers - 1)],
+            removed=[(0, numSubLayers - 1)],
+            dataChangedRows=range(numSubLayers))
+
+        selectLayerAndVerify(subLayers[-1].identifier)
+
 
 if __name__ == '__main__':
     fixturesUtils.runTests(globals())
\ No newline at end of file
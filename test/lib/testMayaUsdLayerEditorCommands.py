@@ -267,6 +267,48 @@ class MayaUsdLayerEditorCommandsTestCase(unittest.TestCase):
             childLayer = Sdf.Layer.Find(childLayerId)
             self.assertEqual(childLayer.subLayerPaths[0], grandChildLayerId)
 
+    def testSubLayerEditingOfManySublayers(self):
+        """ test 'mayaUsdLayerEditor' command on a large sublayer stack.
+
+        Headless counterpart of testIncrementalUpdateOfManySublayers, which needs
+        the Layer Editor window and thus the Maya UI: it applies the same edits
+        through the command and verifies the sublayers, after each edit and
+        after undo and redo. """
+        shapePath, stage = getCleanMayaStage()
+        rootLayer = stage.GetRootLayer()
+
+        numSubLayers = 500
+        subLayers = [Sdf.Layer.CreateAnonymous('sub%d' % i) for i in range(numSubLayers)]
+        subLayerIds = [layer.identifier for layer in subLayers]
+        with Sdf.ChangeBlock():
+            rootLayer.subLayerPaths = subLayerIds
+
+        def verifyUndoRedo(before, after):
+            self.assertEqual(rootLayer.subLayerPaths, after)
+            cmds.undo()
+            self.assertEqual(rootLayer.subLayerPaths, before)
+            cmds.redo()
+            self.assertEqual(rootLayer.subLayerPaths, after)
+
+        numEdits = 20
+        insertRow = numSubLayers // 2
+        for i in range(numEdits):
+            newLayer = Sdf.Layer.CreateAnonymous('new%d' % i)
+            inserted = subLayerIds[:insertRow] + [newLayer.identifier] + subLayerIds[insertRow:]
+            cmds.mayaUsdLayerEditor(
+                rootLayer.identifier, edit=True, insertSubPath=[insertRow, newLayer.identifier])
+            verifyUndoRedo(subLayerIds, inserted)
+
+            cmds.mayaUsdLayerEditor(
+                rootLayer.identifier, edit=True, removeSubPath=[insertRow, shapePath])
+            verifyUndoRedo(inserted, subLayerIds)
+
+        reordered = subLayerIds[1:] + subLayerIds[:1]
+        cmds.mayaUsdLayerEditor(
+            rootLayer.identifier, edit=True,
+            moveSubPath=[subLayerIds[0], rootLayer.identifier, numSubLayers - 1])
+        verifyUndoRedo(subLayerIds, reordered)
+
     def testRemoveEditTarget(self):
 
         shapePath, stage = getCleanMayaStage()
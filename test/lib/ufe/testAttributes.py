@@ -23,6 +23,8 @@ import usdUtils
 import testUtils
 
 import mayaUsd.lib as mayaUsdLib
+import mayaUsd.ufe
+import usdUfe
 
 from pxr import UsdGeom
 
@@ -118,6 +120,58 @@ class AttributesTestCase(unittest.TestCase):
         # Visibility should be in this list.
         self.assertIn(UsdGeom.Tokens.visibility, ball35AttrNames)
 
+    def testBatchAttributes(self):
+        '''Get and set the same attributes on many prims at once.'''
+
+        prims = [mayaUsd.ufe.ufePathToPrim(
+            '|transform1|proxyShape1,/Room_set/Props/Ball_%d' % i) for i in range(1, 11)]
+        for prim in prims:
+            self.assertTrue(prim)
+
+        names = [UsdGeom.Tokens.visibility, 'notAnAttribute']
+        batch = usdUfe.BatchAttributes(prims, names)
+        self.assertEqual(batch.itemCount(), len(prims))
+        self.assertEqual(list(batch.names()), names)
+        self.assertTrue(batch.hasAttribute(0, 0))
+        self.assertFalse(batch.hasAttribute(0, 1))
+
+        # Values come in columns, one per attribute name.
+        visibilities, missing = batch.getValues()
+        self.assertEqual(visibilities, [UsdGeom.Tokens.inherited] * len(prims))
+        self.assertEqual(missing, [None] * len(prims))
+
+        # Set every other prim invisible. None leaves a value untouched.
+        newVisibilities = [UsdGeom.Tokens.invisible if i % 2 == 0 else None
+                           for i in range(len(prims))]
+        cmd = batch.setValuesCmd([newVisibilities, [None] * len(prims)])
+        self.assertIsNotNone(cmd)
+
+        expected = [UsdGeom.Tokens.invisible if i % 2 == 0 else UsdGeom.Tokens.inherited
+                    for i in range(len(prims))]
+        cmd.execute()
+        written = [UsdGeom.Imageable(prim).GetVisibilityAttr().Get() for prim in prims]
+        self.assertEqual(written, expected)
+        self.assertEqual(batch.getValues()[0], expected)
+        self.assertEqual(UsdGeom.Imageable(prims[0]).ComputeVisibility(), UsdGeom.Tokens.invisible)
+
+        # The whole batch is undone and redone as one.
+        cmd.undo()
+        written = [UsdGeom.Imageable(prim).GetVisibilityAttr().Get() for prim in prims]
+        self.assertEqual(written, visibilities)
+        self.assertEqual(batch.getValues()[0], visibilities)
+        cmd.redo()
+        written = [UsdGeom.Imageable(prim).GetVisibilityAttr().Get() for prim in prims]
+        self.assertEqual(written, expected)
+        self.assertEqual(batch.getValues()[0], expected)
+
+        # Edits made outside of the batch are seen too.
+        UsdGeom.Imageable(prims[1]).GetVisibilityAttr().Set(UsdGeom.Tokens.invisible)
+        expected[1] = UsdGeom.Tokens.invisible
+        self.assertEqual(batch.getValues()[0], expected)
+
+        # The columns must match the names and prims.
+        self.assertIsNone(batch.setValuesCmd([newVisibilities]))
+
     @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 4, 'Test for UFE v4 or later')
     def testAddRemoveAttribute(self):
         '''Test adding and removing custom attributes'''
@@ -19,6 +19,7 @@
 import fixturesUtils
 import mayaUtils
 import testUtils
+import ufeUtils
 
 from maya import cmds
 from maya import standalone
@@ -27,6 +28,7 @@ from maya.internal.ufeSupport import ufeCmdWrapper as ufeCmd
 import mayaUsd.ufe
 
 import ufe
+import usdUfe
 
 import unittest
 import collections
@@ -118,6 +120,95 @@ class ChildFilterTestCase(unittest.TestCase):
         self.assertEqual(6, len(children))
         self.assertIn(ball3Item, children)
 
+    def testHasChildrenWithInactiveChildren(self):
+        mayaUtils.openGroupBallsScene()
+        cmds.select(clear=True)
+
+        propsPathStr = '|transform1|proxyShape1,/Ball_set/Props'
+        propsItem = ufe.Hierarchy.createItem(ufe.PathString.path(propsPathStr))
+        propsHier = ufe.Hierarchy.hierarchy(propsItem)
+        self.assertTrue(propsHier.hasChildren())
+
+        # Deactivate all the balls: Props has no children left to display.
+        for i in range(1, 7):
+            ballPrim = mayaUsd.ufe.ufePathToPrim(propsPathStr + '/Ball_%d' % i)
+            ballPrim.SetActive(False)
+        self.assertEqual(0, len(propsHier.children()))
+
+        # Before UFE v4, hasChildren() also counts inactive prims.
+        if ufeUtils.ufeFeatureSetVersion() < 4:
+            self.assertTrue(propsHier.hasChildren())
+        else:
+            self.assertFalse(propsHier.hasChildren())
+
+            usdHierHndlr = ufe.RunTimeMgr.instance().hierarchyHandler(propsItem.runTimeId())
+            cf = usdHierHndlr.childFilter()
+            cf[0].value = True
+            self.assertTrue(propsHier.hasFilteredChildren(cf))
+            cf[0].value = False
+            self.assertFalse(propsHier.hasFilteredChildren(cf))
+
+        # Reactivating the last ball is enough to have children again.
+        mayaUsd.ufe.ufePathToPrim(propsPathStr + '/Ball_6').SetActive(True)
+        self.assertTrue(propsHier.hasChildren())
+        self.assertEqual(1, len(propsHier.children()))
+
+    def testChildrenCursor(self):
+        mayaUtils.openGroupBallsScene()
+        cmds.select(clear=True)
+
+        propsPathStr = '|transform1|proxyShape1,/Ball_set/Props'
+        propsItem = ufe.Hierarchy.createItem(ufe.PathString.path(propsPathStr))
+        propsHier = ufe.Hierarchy.hierarchy(propsItem)
+
+        def pathStrings(items):
+            return [ufe.PathString.string(item.path()) for item in items]
+
+        ballPathStrs = [propsPathStr + '/Ball_%d' % i for i in range(1, 7)]
+        self.assertEqual(ballPathStrs, pathStrings(propsHier.children()))
+
+        # Pages resume where the previous one stopped.
+        cursor = usdUfe.ChildrenCursor(propsPathStr)
+        self.assertFalse(cursor.atEnd())
+        self.assertEqual([], cursor.next(0))
+        self.assertEqual(ballPathStrs[0:4], cursor.next(4))
+        self.assertFalse(cursor.atEnd())
+        self.assertEqual(ballPathStrs[4:6], cursor.next(4))
+        self.assertTrue(cursor.atEnd())
+        self.assertEqual([], cursor.next(4))
+
+        # A page ending exactly on the last child reaches the end.
+        cursor = usdUfe.ChildrenCursor(propsPathStr)
+        self.assertEqual(ballPathStrs[0:3], cursor.next(3))
+        self.assertEqual(ballPathStrs[3:6], cursor.next(3))
+        self.assertTrue(cursor.atEnd())
+
+        # Inactive children are skipped, even right at a page boundary.
+        mayaUsd.ufe.ufePathToPrim(ballPathStrs[2]).SetActive(False)
+        activePathStrs = ballPathStrs[0:2] + ballPathStrs[3:6]
+        self.assertEqual(activePathStrs, pathStrings(propsHier.children()))
+        cursor = usdUfe.ChildrenCursor(propsPathStr)
+        self.assertEqual(activePathStrs[0:2], cursor.next(2))
+        self.assertEqual(activePathStrs[2:4], cursor.next(2))
+        self.assertEqual(activePathStrs[4:5], cursor.next(2))
+        self.assertTrue(cursor.atEnd())
+
+        # The filtered cursor follows the child filter.
+        usdHierHndlr = ufe.RunTimeMgr.instance().hierarchyHandler(propsItem.runTimeId())
+        cf = usdHierHndlr.childFilter()
+        cf[0].value = True
+        self.assertEqual(ballPathStrs, pathStrings(propsHier.filteredChildren(cf)))
+        cursor = usdUfe.ChildrenCursor(propsPathStr, ['InactivePrims'])
+        self.assertEqual(ballPathStrs[0:2], cursor.next(2))
+        self.assertEqual(ballPathStrs[2:6], cursor.next(10))
+        self.assertTrue(cursor.atEnd())
+
+        cf[0].value = False
+        self.assertEqual(activePathStrs, pathStrings(propsHier.filteredChildren(cf)))
+        cursor = usdUfe.ChildrenCursor(propsPathStr, [])
+        self.assertEqual(activePathStrs, cursor.next(10))
+        self.assertTrue(cursor.atEnd())
+
     def testFilteredClassPrims(self):
         classPrimFileName = testUtils.getTestScene('classPrims', 'class-prims.usda')
         shapeNode, stage = mayaUtils.createProxyFromFile(classPrimFileName)
@@ -0,0 +1,125 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2025 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+from maya import cmds
+from maya import standalone
+
+import mayaUsd.ufe
+
+import time
+import unittest
+
+
+class UfePathResolutionCacheTestCase(unittest.TestCase):
+    '''Verify the cache of the resolution of UFE paths to USD prims.'''
+
+    pluginsLoaded = False
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = mayaUtils.isMayaUsdPluginLoaded()
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        ''' Called initially to set up the Maya test environment '''
+        self.assertTrue(self.pluginsLoaded)
+
+        self.capacity = mayaUsd.ufe.getPathResolutionCacheCapacity()
+        mayaUtils.openGroupBallsScene()
+        cmds.select(clear=True)
+        mayaUsd.ufe.clearPathResolutionCache()
+
+    def tearDown(self):
+        mayaUsd.ufe.setPathResolutionCacheCapacity(self.capacity)
+
+    def testResolutionIsCached(self):
+        '''Resolving the same path again is served from the cache.'''
+        ball3PathStr = '|transform1|proxyShape1,/Ball_set/Props/Ball_3'
+        prim = mayaUsd.ufe.ufePathToPrim(ball3PathStr)
+        self.assertTrue(prim)
+        self.assertEqual(str(prim.GetPath()), '/Ball_set/Props/Ball_3')
+
+        size, hits, misses = mayaUsd.ufe.getPathResolutionCacheStats()
+        self.assertGreaterEqual(size, 1)
+
+        self.assertEqual(prim, mayaUsd.ufe.ufePathToPrim(ball3PathStr))
+        _, newHits, newMisses = mayaUsd.ufe.getPathResolutionCacheStats()
+        self.assertEqual(hits + 1, newHits)
+        self.assertEqual(misses, newMisses)
+
+        # Property paths resolve to their prim.
+        propPrim = mayaUsd.ufe.ufePathToPrim(ball3PathStr + '.xformOpOrder')
+        self.assertEqual(prim, propPrim)
+
+    def testPrimRemove(self):
+        '''The cached resolution always looks the prim up again.'''
+        ball3PathStr = '|transform1|proxyShape1,/Ball_set/Props/Ball_3'
+        prim = mayaUsd.ufe.ufePathToPrim(ball3PathStr)
+        stage = prim.GetStage()
+        self.assertTrue(prim)
+
+        stage.RemovePrim('/Ball_set/Props/Ball_3')
+        self.assertFalse(mayaUsd.ufe.ufePathToPrim(ball3PathStr))
+
+    def testProxyShapeRename(self):
+        '''Renaming the proxy shape invalidates the cached resolutions.'''
+        oldPathStr = '|transform1|proxyShape1,/Ball_set/Props/Ball_3'
+        self.assertTrue(mayaUsd.ufe.ufePathToPrim(oldPathStr))
+
+        cmds.rename('|transform1|proxyShape1', 'potato')
+
+        self.assertFalse(mayaUsd.ufe.ufePathToPrim(oldPathStr))
+        self.assertTrue(mayaUsd.ufe.ufePathToPrim('|transform1|potato,/Ball_set/Props/Ball_3'))
+
+    def testResolutionThroughput(self):
+        '''
+        Measures the number of resolutions per second with and without the
+        cache. The rates are only reported, not validated.
+        '''
+        pathStrs = ['|transform1|proxyShape1,/Ball_set/Props/Ball_%d' % i
+                    for i in range(1, 7)]
+        iterations = 20000
+
+        def measure():
+            start = time.perf_counter()
+            for _ in range(iterations):
+                for pathStr in pathStrs:
+                    mayaUsd.ufe.ufePathToPrim(pathStr)
+            return iterations * len(pathStrs) / (time.perf_counter() - start)
+
+        mayaUsd.ufe.setPathResolutionCacheCapacity(0)
+        uncachedRate = measure()
+
+        mayaUsd.ufe.setPathResolutionCacheCapacity(self.capacity)
+        cachedRate = measure()
+
+        print('UFE path resolutions per second: %.0f uncached, %.0f cached (x%.2f)'
+              % (uncachedRate, cachedRate, cachedRate / uncachedRate))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -16,12 +16,14 @@
 #
 
 import os
+import time
 import unittest
 
 import fixturesUtils
 import maya.OpenMaya as om
 from maya import cmds
 from maya import standalone
+from pxr import Gf
 from pxr import Usd
 from pxr import UsdSkel
 
@@ -128,5 +130,126 @@ class TestUsdExportBlendshapes(unittest.TestCase):
         self.assertEqual(blendShapes[0].GetName(), "tgt1")
         self.assertEqual(blendShapes[1].GetName(), "tgt0")
 
+    def _CreateSparseBlendShapeRig(self, numTargets):
+        """
+        Create a facial-rig-like setup with the given number of targets, each of them only
+        moving a few vertices of a sphere, and select its base mesh.
+
+        Returns the vertices moved by each target and the vertices whose normals may change,
+        keyed by target shape name.
+        """
+        om.MFileIO.newFile(True)
+        base, _ = cmds.polySphere(name="base", subdivisionsX=30, subdivisionsY=30)
+        numVerts = cmds.polyEvaluate(base, vertex=True)
+
+        targets = []
+        movedVerts = {}
+        affectedVerts = {}
+        for i in range(numTargets):
+            target = cmds.duplicate(base, name="target%d" % i)[0]
+            firstVert = (i * 37) % (numVerts - 4)
+            moved = '{}.vtx[{}:{}]'.format(target, firstVert, firstVert + 3)
+            cmds.polyMoveVertex(moved, ty=0.1)
+            targetShape = cmds.listRelatives(target, shapes=True)[0]
+            movedVerts[targetShape] = set(range(firstVert, firstVert + 4))
+
+            # The normals of the vertices sharing a face with a moved vertex change too, so
+            # they are kept in the sparse target along with the moved vertices.
+            faces = cmds.polyListComponentConversion(moved, toFace=True)
+            neighbours = cmds.ls(
+                cmds.polyListComponentConversion(faces, toVertex=True), flatten=True)
+            affectedVerts[targetShape] = set(
+                int(vert.split('[')[-1].rstrip(']')) for vert in neighbours)
+            targets.append(target)
+
+        cmds.blendShape(*(targets + [base]))
+        cmds.select(base, replace=True)
+        return movedVerts, affectedVerts
+
+    def _ExportBlendShapes(self, fileName, sparse):
+        """
+        Export the selected base mesh and its targets, and return the path of the file.
+        """
+        temp_file = os.path.join(self.temp_dir, fileName)
+        cmds.mayaUSDExport(f=temp_file, sl=True, ebs=True, skl="auto", sbt=sparse)
+        return temp_file
+
+    def _ReadBlendShapes(self, temp_file, numTargets):
+        """
+        Return the components of each target of the exported base mesh, as
+        (offset, normal offset) pairs keyed by point index, keyed by target name.
+        """
+        stage = Usd.Stage.Open(temp_file)
+        prim = stage.GetPrimAtPath("/base")
+        blendShapes = [UsdSkel.BlendShape(child) for child in prim.GetChildren()
+                       if child.GetTypeName() == 'BlendShape']
+        self.assertEqual(len(blendShapes), numTargets)
+        result = {}
+        for blendShape in blendShapes:
+            indices = blendShape.GetPointIndicesAttr().Get()
+            offsets = blendShape.GetOffsetsAttr().Get()
+            normalOffsets = blendShape.GetNormalOffsetsAttr().Get()
+            self.assertEqual(len(indices), len(offsets))
+            self.assertEqual(len(indices), len(normalOffsets))
+            result[blendShape.GetPrim().GetName()] = dict(
+                (index, (offsets[i], normalOffsets[i])) for i, index in enumerate(indices))
+        return result
+
+    def testSparseBlendShapesExport(self):
+        """
+        Export a facial-rig-like setup with several targets, each of them only moving a few
+        vertices, and verify that the targets are written sparsely only when requested.
+        """
+        numTargets = 20
+        movedVerts, affectedVerts = self._CreateSparseBlendShapeRig(numTargets)
+
+        denseTargets = self._ReadBlendShapes(
+            self._ExportBlendShapes('denseBlendshapes.usda', False), numTargets)
+        sparseTargets = self._ReadBlendShapes(
+            self._ExportBlendShapes('sparseBlendshapes.usda', True), numTargets)
+
+        for name, components in sparseTargets.items():
+            indices = set(components.keys())
+            self.assertTrue(movedVerts[name].issubset(indices))
+            self.assertTrue(indices.issubset(affectedVerts[name]))
+
+            # The sparse target keeps the dense offsets of the components it lists, and the
+            # components it drops do not move.
+            denseComponents = denseTargets[name]
+            self.assertLessEqual(len(indices), len(denseComponents))
+            for index, (offset, normalOffset) in denseComponents.items():
+                if index in components:
+                    self.assertTrue(Gf.IsClose(components[index][0], offset, 1e-6))
+                    self.assertTrue(Gf.IsClose(components[index][1], normalOffset, 1e-6))
+                else:
+                    self.assertLessEqual(offset.GetLength(), 1e-6)
+                    self.assertLessEqual(normalOffset.GetLength(), 1e-6)
+
+    def testManyBlendShapesExportPerformance(self):
+        """
+        Measures the export time of a 300-target facial-rig-like setup, with dense and
+        sparse targets. The time is only reported, not validated.
+        """
+        numTargets = 300
+        movedVerts, affectedVerts = self._CreateSparseBlendShapeRig(numTargets)
+
+        elapsed = {}
+        for sparse in (False, True):
+            start = time.perf_counter()
+            temp_file = self._ExportBlendShapes(
+                'manyBlendshapes%s.usdc' % ('Sparse' if sparse else 'Dense'), sparse)
+            elapsed[sparse] = time.perf_counter() - start
+
+        # The last export is the sparse one: verify it writes the expected components.
+        targets = self._ReadBlendShapes(temp_file, numTargets)
+        for name, components in targets.items():
+            indices = set(components.keys())
+            self.assertTrue(movedVerts[name].issubset(indices))
+            self.assertTrue(indices.issubset(affectedVerts[name]))
+
+        print('Exported %d blendshape targets in %.3f seconds dense, %.3f seconds sparse'
+            % (numTargets, elapsed[False], elapsed[True]))
+
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)